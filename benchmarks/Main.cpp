@@ -0,0 +1,11 @@
+#define CATCH_CONFIG_RUNNER // Telling Catch we will define a main on our own
+#include <catch/catch.hpp>
+
+#include "RaZ/Utils/Logger.hpp"
+
+int main(int argc, char* argv[]) {
+  // Disabling all logging output to avoid disturbing the measures
+  Raz::Logger::setLoggingLevel(Raz::LoggingLevel::NONE);
+
+  return Catch::Session().run(argc, argv);
+}
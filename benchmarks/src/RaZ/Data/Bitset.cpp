@@ -0,0 +1,71 @@
+#include "RaZ/Data/Bitset.hpp"
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+/// Previous bitset implementation, storing its bits in a std::vector<bool>; kept as a reference to compare the current one against.
+class LegacyBitset {
+public:
+  explicit LegacyBitset(std::size_t bitCount) : m_bits(bitCount, false) {}
+
+  bool isEmpty() const noexcept { return (std::find(m_bits.cbegin(), m_bits.cend(), true) == m_bits.cend()); }
+  std::size_t getEnabledBitCount() const noexcept { return static_cast<std::size_t>(std::count(m_bits.cbegin(), m_bits.cend(), true)); }
+  void setBit(std::size_t position) { m_bits[position] = true; }
+
+  LegacyBitset operator&(const LegacyBitset& bitset) const {
+    LegacyBitset res(std::min(m_bits.size(), bitset.m_bits.size()));
+
+    for (std::size_t i = 0; i < res.m_bits.size(); ++i)
+      res.m_bits[i] = (m_bits[i] && bitset.m_bits[i]);
+
+    return res;
+  }
+
+private:
+  std::vector<bool> m_bits {};
+};
+
+template <typename BitsetT>
+BitsetT createBitset(std::size_t bitCount, std::size_t firstBitIndex, std::size_t step) {
+  BitsetT bitset(bitCount);
+
+  for (std::size_t bitIndex = firstBitIndex; bitIndex < bitCount; bitIndex += step)
+    bitset.setBit(bitIndex);
+
+  return bitset;
+}
+
+template <typename BitsetT>
+void runBenchmarks(std::size_t bitCount) {
+  // The even & odd bits never overlap, forcing the whole bitsets to be checked
+  const auto evenBitset = createBitset<BitsetT>(bitCount, 0, 2);
+  const auto oddBitset  = createBitset<BitsetT>(bitCount, 1, 2);
+  const auto fullBitset = createBitset<BitsetT>(bitCount, 0, 1);
+
+  BENCHMARK("AND") { return (evenBitset & fullBitset); };
+
+  if constexpr (std::is_same_v<BitsetT, Raz::Bitset>) {
+    BENCHMARK("AND any") { return evenBitset.andAny(oddBitset); };
+    BENCHMARK("Is subset") { return evenBitset.isSubsetOf(fullBitset); };
+  } else {
+    BENCHMARK("AND any") { return !(evenBitset & oddBitset).isEmpty(); };
+  }
+
+  BENCHMARK("Enabled bit count") { return evenBitset.getEnabledBitCount(); };
+}
+
+} // namespace
+
+TEST_CASE("Bitset benchmarks", "[benchmark]") {
+  for (const std::size_t bitCount : { 64, 128, 1024, 65536 }) {
+    DYNAMIC_SECTION(bitCount << " bits") {
+      SECTION("Legacy") { runBenchmarks<LegacyBitset>(bitCount); }
+      SECTION("Current") { runBenchmarks<Raz::Bitset>(bitCount); }
+    }
+  }
+}
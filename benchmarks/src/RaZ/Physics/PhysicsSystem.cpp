@@ -0,0 +1,247 @@
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <catch/catch.hpp>
+#include <PhysicsTestUtils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr float stepTime = 0.016666f;
+
+/// Creates a world holding the given number of spheres with rigid bodies, laid out on a square grid above a floor plane.
+/// \tparam BroadphaseT Type of the broadphase to be used by the physics system.
+/// \param bodyCount Number of rigid bodies to be created.
+/// \return Created world, already refreshed.
+template <typename BroadphaseT = Raz::SweepAndPruneBroadphase>
+Raz::World createFallingSpheres(std::size_t bodyCount) {
+  Raz::World world(bodyCount + 1);
+
+  world.addSystem<Raz::PhysicsSystem>().setBroadphase<BroadphaseT>();
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  const auto gridSize = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(bodyCount))));
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const Raz::Vec3f position(static_cast<float>(bodyIndex % gridSize) * 3.f, 10.f, static_cast<float>(bodyIndex / gridSize) * 3.f);
+
+    Raz::Entity& body = world.addEntityWithComponent<Raz::Transform>(position);
+    body.addComponent<Raz::RigidBody>(1.f, 0.5f);
+    body.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  }
+
+  world.refresh();
+
+  return world;
+}
+
+/// Creates a world holding a pyramid of boxes with rigid bodies lying on a floor plane, each box resting on the two below it.
+/// \param bodyCount Minimal number of rigid bodies to be created; the pyramid's base is made wide enough to hold them all.
+/// \return Created world, already refreshed.
+Raz::World createBoxPyramid(std::size_t bodyCount) {
+  std::size_t baseWidth = 1;
+  while (baseWidth * (baseWidth + 1) / 2 < bodyCount)
+    ++baseWidth;
+
+  Raz::World world(baseWidth * (baseWidth + 1) / 2 + 1);
+
+  world.addSystem<Raz::PhysicsSystem>();
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  // Rigid bodies being particles, each one is located at the bottom center of its box
+  for (std::size_t layerIndex = 0; layerIndex < baseWidth; ++layerIndex) {
+    for (std::size_t boxIndex = 0; boxIndex < baseWidth - layerIndex; ++boxIndex) {
+      const Raz::Vec3f position(static_cast<float>(boxIndex) + static_cast<float>(layerIndex) * 0.5f, static_cast<float>(layerIndex), 0.f);
+
+      Raz::Entity& box = world.addEntityWithComponent<Raz::Transform>(position);
+      box.addComponent<Raz::RigidBody>(1.f, 0.f);
+      box.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.5f, 0.f, -0.5f), Raz::Vec3f(0.5f, 1.f, 0.5f)));
+    }
+  }
+
+  world.refresh();
+
+  return world;
+}
+
+/// Creates a world holding many small & independent islands, each made of a rigid body holding a sphere on which another one falls.
+/// \param bodyCount Number of rigid bodies to be created; each island holds two of them.
+/// \return Created world, already refreshed.
+Raz::World createSmallIslands(std::size_t bodyCount) {
+  const std::size_t islandCount = bodyCount / 2;
+
+  Raz::World world(islandCount * 2 + 1);
+
+  world.addSystem<Raz::PhysicsSystem>();
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  const auto gridSize = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(islandCount))));
+
+  for (std::size_t islandIndex = 0; islandIndex < islandCount; ++islandIndex) {
+    const Raz::Vec3f position(static_cast<float>(islandIndex % gridSize) * 5.f, 0.01f, static_cast<float>(islandIndex / gridSize) * 5.f);
+
+    Raz::Entity& holder = world.addEntityWithComponent<Raz::Transform>(position);
+    holder.addComponent<Raz::RigidBody>(1.f, 0.f);
+    holder.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+    world.addEntityWithComponent<Raz::Transform>(position + Raz::Vec3f(0.f, 2.f, 0.f)).addComponent<Raz::RigidBody>(1.f, 0.5f);
+  }
+
+  world.refresh();
+
+  return world;
+}
+
+struct PhysicsScene {
+  std::string name {};
+  std::function<Raz::World(std::size_t)> create {};
+};
+
+const std::vector<PhysicsScene>& getPhysicsScenes() {
+  static const std::vector<PhysicsScene> scenes = {
+    { "Falling spheres", [] (std::size_t bodyCount) { return createFallingSpheres(bodyCount); } },
+    { "Box pyramid", createBoxPyramid },
+    { "Small islands", createSmallIslands }
+  };
+
+  return scenes;
+}
+
+/// Simulates a scene for the given number of steps, then hashes its rigid bodies' final positions.
+/// \param scene Scene to be simulated.
+/// \param bodyCount Number of rigid bodies in the scene.
+/// \param stepCount Number of steps to be executed.
+/// \return Hash of the final positions.
+std::uint64_t simulateScene(const PhysicsScene& scene, std::size_t bodyCount, std::size_t stepCount) {
+  Raz::World world = scene.create(bodyCount);
+  auto& physics    = world.getSystem<Raz::PhysicsSystem>();
+
+  for (std::size_t stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+    physics.step(stepTime);
+
+  return TestUtils::hashRigidBodyPositions(world);
+}
+
+template <typename BroadphaseT>
+void benchmarkPhysicsStep(const std::string& broadphaseName, std::size_t bodyCount) {
+  Raz::World world = createFallingSpheres<BroadphaseT>(bodyCount);
+  auto& physics    = world.getSystem<Raz::PhysicsSystem>();
+
+  BENCHMARK(broadphaseName + " - " + std::to_string(bodyCount) + " bodies") {
+    return physics.step(stepTime);
+  };
+}
+
+} // namespace
+
+TEST_CASE("PhysicsSystem broadphase benchmarks", "[benchmark]") {
+  // The brute force's cost being quadratic, it is limited to smaller counts
+  for (const std::size_t bodyCount : { 100u, 1'000u, 5'000u })
+    benchmarkPhysicsStep<Raz::BruteForceBroadphase>("Brute force", bodyCount);
+
+  for (const std::size_t bodyCount : { 100u, 1'000u, 5'000u, 10'000u, 50'000u })
+    benchmarkPhysicsStep<Raz::SweepAndPruneBroadphase>("Sweep & prune", bodyCount);
+}
+
+TEST_CASE("PhysicsSystem scene benchmarks", "[benchmark]") {
+  for (const PhysicsScene& scene : getPhysicsScenes()) {
+    for (const std::size_t bodyCount : { 1'000u, 10'000u }) {
+      Raz::World world = scene.create(bodyCount);
+      auto& physics    = world.getSystem<Raz::PhysicsSystem>();
+
+      BENCHMARK(scene.name + " - " + std::to_string(bodyCount) + " bodies") {
+        return physics.step(stepTime);
+      };
+    }
+  }
+}
+
+TEST_CASE("PhysicsSystem scaling report", "[benchmark]") {
+  // Each scene is simulated for a few seconds, going through its falling, colliding & resting phases; the step times vary much between
+  //  those, hence reporting their distribution instead of only their mean
+  constexpr std::size_t stepCount = 240;
+
+  std::cout << std::left << std::setw(16) << "Scene" << std::right << std::setw(8) << "Bodies"
+            << std::setw(11) << "p50 (ms)" << std::setw(11) << "p90 (ms)" << std::setw(11) << "p99 (ms)" << std::setw(11) << "Max (ms)"
+            << std::setw(12) << "Max pairs" << std::setw(10) << "Contacts" << std::setw(9) << "Islands" << std::setw(13) << "Memory (KiB)" << '\n';
+
+  for (const PhysicsScene& scene : getPhysicsScenes()) {
+    for (const std::size_t bodyCount : { 100u, 1'000u, 10'000u, 50'000u }) {
+      Raz::World world = scene.create(bodyCount);
+      auto& physics    = world.getSystem<Raz::PhysicsSystem>();
+
+      std::vector<double> stepDurations(stepCount);
+      std::size_t maxPairCount = 0;
+
+      for (double& stepDuration : stepDurations) {
+        const auto startTime = std::chrono::steady_clock::now();
+        physics.step(stepTime);
+        stepDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        maxPairCount = std::max(maxPairCount, physics.getBroadphasePairCount());
+      }
+
+      std::sort(stepDurations.begin(), stepDurations.end());
+
+      const auto getPercentile = [&stepDurations] (std::size_t percentile) {
+        return stepDurations[std::min(stepDurations.size() * percentile / 100, stepDurations.size() - 1)];
+      };
+
+      std::cout << std::left << std::setw(16) << scene.name << std::right << std::setw(8) << bodyCount << std::fixed << std::setprecision(3)
+                << std::setw(11) << getPercentile(50) << std::setw(11) << getPercentile(90) << std::setw(11) << getPercentile(99)
+                << std::setw(11) << stepDurations.back() << std::setw(12) << maxPairCount << std::setw(10) << physics.getContactCount()
+                << std::setw(9) << physics.getIslandCount() << std::setw(13) << physics.computeMemoryUsage() / 1024 << '\n';
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+TEST_CASE("PhysicsSystem determinism", "[benchmark]") {
+  // The scenes are large enough for their islands to be solved in parallel
+  constexpr std::size_t bodyCount = 2'000;
+  constexpr std::size_t stepCount = 120;
+
+  for (const PhysicsScene& scene : getPhysicsScenes()) {
+    INFO(scene.name);
+
+    const std::uint64_t referenceHash = simulateScene(scene, bodyCount, stepCount);
+
+    // Running the same simulation again gives the exact same positions
+    CHECK(simulateScene(scene, bodyCount, stepCount) == referenceHash);
+
+    // Simulating several worlds at once from different threads, the thread pool's threads are shared between them, thus processing
+    //  different islands than when simulated alone; the results must not depend on which thread processes which island
+    for (const unsigned int threadCount : { 2u, 4u, 8u }) {
+      INFO("Thread count: " << threadCount);
+
+      std::vector<std::uint64_t> hashes(threadCount);
+      std::vector<std::thread> threads;
+
+      for (unsigned int threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+        threads.emplace_back([&scene, &hashes, threadIndex] () {
+          hashes[threadIndex] = simulateScene(scene, bodyCount, stepCount);
+        });
+      }
+
+      for (std::thread& thread : threads)
+        thread.join();
+
+      for (const std::uint64_t hash : hashes)
+        CHECK(hash == referenceHash);
+    }
+  }
+}
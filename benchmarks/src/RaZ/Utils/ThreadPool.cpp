@@ -0,0 +1,131 @@
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <type_traits>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+/// Previous thread pool implementation, sharing a single queue of actions between all threads; kept as a reference to compare the current one against.
+class LegacyThreadPool {
+public:
+  explicit LegacyThreadPool(unsigned int threadCount) {
+    m_threads.reserve(threadCount);
+
+    for (unsigned int i = 0; i < threadCount; ++i) {
+      m_threads.emplace_back([this] () {
+        std::function<void()> action;
+
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(m_actionsMutex);
+            m_condVar.wait(lock, [this] () { return (!m_actions.empty() || m_shouldStop); });
+
+            if (m_shouldStop)
+              return;
+
+            action = std::move(m_actions.front());
+            m_actions.pop();
+          }
+
+          action();
+        }
+      });
+    }
+  }
+
+  void addAction(std::function<void()> action) {
+    {
+      std::lock_guard<std::mutex> lock(m_actionsMutex);
+      m_actions.push(std::move(action));
+    }
+
+    m_condVar.notify_one();
+  }
+
+  ~LegacyThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_actionsMutex);
+      m_shouldStop = true;
+    }
+
+    m_condVar.notify_all();
+
+    for (std::thread& thread : m_threads)
+      thread.join();
+  }
+
+private:
+  std::vector<std::thread> m_threads {};
+  bool m_shouldStop = false;
+
+  std::mutex m_actionsMutex {};
+  std::condition_variable m_condVar {};
+  std::queue<std::function<void()>> m_actions {};
+};
+
+template <typename PoolT>
+void waitFor(PoolT& pool, const std::atomic<int>& counter, int expectedValue) {
+  if constexpr (std::is_same_v<PoolT, Raz::ThreadPool>) {
+    pool.executeUntil([&counter, expectedValue] () { return (counter.load(std::memory_order_acquire) == expectedValue); });
+  } else {
+    while (counter.load(std::memory_order_acquire) != expectedValue)
+      std::this_thread::yield();
+  }
+}
+
+template <typename PoolT>
+void runBenchmarks(PoolT& pool) {
+  constexpr int actionCount = 4096;
+  constexpr int parentActionCount = 64;
+  constexpr int childActionCount = 64;
+
+  // Very fine-grained actions, for which the cost of the pool itself dominates
+  BENCHMARK("External actions") {
+    std::atomic<int> executedCount = 0;
+
+    for (int i = 0; i < actionCount; ++i)
+      pool.addAction([&executedCount] () noexcept { executedCount.fetch_add(1, std::memory_order_release); });
+
+    waitFor(pool, executedCount, actionCount);
+    return executedCount.load();
+  };
+
+  // Actions adding others, as recursive algorithms or task graphs do
+  BENCHMARK("Nested actions") {
+    std::atomic<int> executedCount = 0;
+
+    for (int i = 0; i < parentActionCount; ++i) {
+      pool.addAction([&pool, &executedCount] () {
+        for (int j = 0; j < childActionCount; ++j)
+          pool.addAction([&executedCount] () noexcept { executedCount.fetch_add(1, std::memory_order_release); });
+      });
+    }
+
+    waitFor(pool, executedCount, parentActionCount * childActionCount);
+    return executedCount.load();
+  };
+}
+
+} // namespace
+
+TEST_CASE("ThreadPool benchmarks", "[benchmark]") {
+  const unsigned int threadCount = std::max(std::thread::hardware_concurrency(), 2u);
+
+  SECTION("Legacy") {
+    LegacyThreadPool pool(threadCount);
+    runBenchmarks(pool);
+  }
+
+  SECTION("Current") {
+    Raz::ThreadPool pool(threadCount);
+    runBenchmarks(pool);
+  }
+}
+
+#endif // RAZ_THREADS_AVAILABLE
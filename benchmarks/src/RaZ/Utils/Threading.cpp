@@ -0,0 +1,107 @@
+#include "RaZ/Utils/Threading.hpp"
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+std::vector<float> createRandomValues(std::size_t valueCount) {
+  std::mt19937 randGen(42); // Using a constant seed, so that all runs process the same values
+  std::uniform_real_distribution<float> randDist(0.f, 1000.f);
+
+  std::vector<float> values(valueCount);
+  std::generate(values.begin(), values.end(), [&randGen, &randDist] () { return randDist(randGen); });
+
+  return values;
+}
+
+// Simulating a workload whose cost grows with the index, as processing submeshes of very different sizes would
+float computeImbalancedValue(std::size_t index) {
+  float value = 0.f;
+
+  for (std::size_t i = 0; i < index / 64; ++i)
+    value += std::sqrt(static_cast<float>(i));
+
+  return value;
+}
+
+} // namespace
+
+TEST_CASE("Threading parallel for benchmarks", "[benchmark]") {
+  constexpr std::size_t valueCount = 16384;
+  std::vector<float> values(valueCount);
+
+  BENCHMARK("Sequential") {
+    for (std::size_t i = 0; i < valueCount; ++i)
+      values[i] = computeImbalancedValue(i);
+
+    return values.back();
+  };
+
+  // Splitting the range in one static chunk per thread: the thread getting the last indices takes much longer than the others
+  BENCHMARK("Static split (parallelize)") {
+    Raz::Threading::parallelize(0, valueCount, [&values] (const Raz::Threading::IndexRange& range) noexcept {
+      for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+        values[i] = computeImbalancedValue(i);
+    });
+
+    return values.back();
+  };
+
+  BENCHMARK("Dynamic chunks (parallelFor)") {
+    Raz::Threading::parallelFor(0, valueCount, [&values] (const Raz::Threading::IndexRange& range) noexcept {
+      for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+        values[i] = computeImbalancedValue(i);
+    });
+
+    return values.back();
+  };
+}
+
+TEST_CASE("Threading parallel algorithms benchmarks", "[benchmark]") {
+  constexpr std::size_t valueCount = 1'000'000;
+  const std::vector<float> values = createRandomValues(valueCount);
+  std::vector<float> results(valueCount);
+
+  BENCHMARK("Reduce (std::accumulate)") { return std::accumulate(values.cbegin(), values.cend(), 0.0); };
+  BENCHMARK("Reduce (parallelReduce)") {
+    return Raz::Threading::parallelReduce(0, valueCount, 0.0, [&values] (const Raz::Threading::IndexRange& range) {
+      return std::accumulate(values.cbegin() + static_cast<std::ptrdiff_t>(range.beginIndex),
+                             values.cbegin() + static_cast<std::ptrdiff_t>(range.endIndex),
+                             0.0);
+    }, std::plus<>());
+  };
+
+  BENCHMARK("Scan (std::partial_sum)") {
+    std::partial_sum(values.cbegin(), values.cend(), results.begin());
+    return results.back();
+  };
+  BENCHMARK("Scan (parallelScan)") {
+    Raz::Threading::parallelScan(values.cbegin(), values.cend(), results.begin());
+    return results.back();
+  };
+
+  BENCHMARK_ADVANCED("Sort (std::sort)")(Catch::Benchmark::Chronometer meter) {
+    std::vector<std::vector<float>> sortedValues(static_cast<std::size_t>(meter.runs()), values);
+    meter.measure([&sortedValues] (int runIndex) {
+      std::vector<float>& runValues = sortedValues[static_cast<std::size_t>(runIndex)];
+      std::sort(runValues.begin(), runValues.end());
+    });
+  };
+  BENCHMARK_ADVANCED("Sort (parallelSort)")(Catch::Benchmark::Chronometer meter) {
+    std::vector<std::vector<float>> sortedValues(static_cast<std::size_t>(meter.runs()), values);
+    meter.measure([&sortedValues] (int runIndex) {
+      std::vector<float>& runValues = sortedValues[static_cast<std::size_t>(runIndex)];
+      Raz::Threading::parallelSort(runValues.begin(), runValues.end());
+    });
+  };
+}
+
+#endif // RAZ_THREADS_AVAILABLE
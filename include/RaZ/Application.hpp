@@ -15,13 +15,40 @@ public:
 
   const std::vector<World>& getWorlds() const { return m_worlds; }
   std::vector<World>& getWorlds() { return m_worlds; }
-  float getDeltaTime() const { return m_deltaTime; }
+  float getDeltaTime() const { return m_timeInfo.deltaTime; }
+  float getFixedTimeStep() const { return m_timeInfo.substepTime; }
+  std::size_t getMaxSubstepCount() const { return m_timeInfo.maxSubstepCount; }
+  /// Gets the progress between the last executed fixed step & the next one, allowing to interpolate between the last two simulated states when rendering.
+  /// \return Interpolation factor, between 0 & 1.
+  float getInterpolationAlpha() const { return m_timeInfo.interpolationAlpha; }
+  /// Gets the time information of the last frame, as given to the worlds.
+  /// \return Last frame's time information.
+  const FrameTimeInfo& getTimeInfo() const { return m_timeInfo; }
+  /// Gets the time each world has taken to be updated during the last frame.
+  /// \return Update times in seconds, indexed like the worlds.
+  const std::vector<float>& getWorldUpdateTimes() const { return m_worldUpdateTimes; }
+  bool isParallelUpdateEnabled() const { return m_isParallelUpdateEnabled; }
+
+  /// Sets the time of the default fixed step, executed by all systems not having their own step rate (see System::setStepRate()).
+  /// \param fixedTimeStep Time of a fixed step, in seconds. Must be strictly positive.
+  void setFixedTimeStep(float fixedTimeStep);
+  /// Sets the maximum number of fixed steps the systems can execute in a single frame.
+  /// If the frames take too long for the simulation to keep up, the time past this limit is dropped instead of being accumulated,
+  ///   preventing the steps from making each following frame even longer.
+  /// \param maxSubstepCount Maximum number of fixed steps per frame. Must be strictly positive.
+  void setMaxSubstepCount(std::size_t maxSubstepCount);
 
   /// Adds a World into the Application.
   /// \tparam Args Types of the arguments to be forwarded to the World.
   /// \param args Arguments to be forwarded to the World.
   /// \return Reference to the newly added World.
   template <typename... Args> World& addWorld(Args&&... args);
+  /// Enables or disables the concurrent update of the worlds.
+  /// When enabled, the worlds are updated in parallel on the default thread pool, except those which must be updated on the main thread
+  ///   (see World::requiresMainThread()); these are updated on the calling thread.
+  /// \note The worlds must then be independent from each other, and must not be accessed by a callback while being updated.
+  /// \param enabled True if the worlds should be updated in parallel, false otherwise.
+  void enableParallelUpdate(bool enabled = true) { m_isParallelUpdateEnabled = enabled; }
   /// Runs the application.
   void run();
   /// Runs the application and call the given callable between each cycle.
@@ -35,11 +62,29 @@ public:
   void quit() { m_isRunning = false; }
 
 private:
+  static constexpr std::size_t defaultMaxSubstepCount = 8;
+
+  static constexpr FrameTimeInfo createDefaultTimeInfo() noexcept {
+    FrameTimeInfo timeInfo;
+    timeInfo.maxSubstepCount = defaultMaxSubstepCount;
+    return timeInfo;
+  }
+
+  /// Updates the given world, measuring the time it takes.
+  /// \param worldIndex Index of the world to be updated.
+  /// \return True if the world is still active, false otherwise.
+  bool updateWorld(std::size_t worldIndex);
+  /// Updates the active worlds concurrently.
+  void updateWorldsInParallel();
+
   std::vector<World> m_worlds {};
   Bitset m_activeWorlds {};
+  std::vector<float> m_worldUpdateTimes {};
+  bool m_isParallelUpdateEnabled = false;
 
-  std::chrono::time_point<std::chrono::system_clock> m_lastFrameTime = std::chrono::system_clock::now();
-  float m_deltaTime {};
+  std::chrono::time_point<std::chrono::steady_clock> m_lastFrameTime = std::chrono::steady_clock::now();
+  FrameTimeInfo m_timeInfo = createDefaultTimeInfo();
+  float m_remainingTime {}; ///< Extra time remaining after executing the fixed steps.
   bool m_isRunning = true;
 };
 
@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef RAZ_COMMANDBUFFER_HPP
+#define RAZ_COMMANDBUFFER_HPP
+
+#include "RaZ/Entity.hpp"
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace Raz {
+
+class World;
+
+/// CommandBuffer class, recording structural changes (entities & components additions or removals) to be applied later on a World.
+/// This allows systems to request such changes while being updated, which would otherwise be unsafe when they are updated concurrently,
+///   and would modify the entities they are iterating over. The commands are applied in the order they have been recorded.
+/// \see World::getCommandBuffer()
+class CommandBuffer {
+public:
+  /// Entity which will be created when the buffer is executed. It can be used as the target of the next commands of the same buffer.
+  struct PendingEntity {
+    std::size_t index {}; ///< Index of the entity among those created by the buffer.
+  };
+
+  /// Target of a command, which is either an existing entity or one which will be created by the buffer.
+  /// If the entity referred to by a handle has been removed when the buffer is executed, the command is ignored.
+  using EntityRef = std::variant<EntityHandle, PendingEntity>;
+
+  CommandBuffer() = default;
+  CommandBuffer(const CommandBuffer&) = delete;
+  CommandBuffer(CommandBuffer&&) noexcept = default;
+
+  std::size_t getCommandCount() const noexcept { return m_commands.size(); }
+  bool isEmpty() const noexcept { return m_commands.empty(); }
+
+  /// Records the addition of an entity.
+  /// \param enabled True if the entity should be enabled once created, false otherwise.
+  /// \return Reference to the entity to be created, which can be used in the next commands of this buffer.
+  PendingEntity addEntity(bool enabled = true);
+  /// Records the addition of a component to an entity.
+  /// \tparam Comp Type of the component to be added.
+  /// \tparam Args Types of the arguments to be forwarded to the component. They are copied or moved into the buffer until its execution;
+  ///   a std::reference_wrapper is kept as is, referencing the same object when executed.
+  /// \param entity Entity to add the component to.
+  /// \param args Arguments to be forwarded to the component.
+  template <typename Comp, typename... Args> void addComponent(EntityRef entity, Args&&... args);
+  /// Records the removal of a component from an entity.
+  /// \tparam Comp Type of the component to be removed.
+  /// \param entity Entity to remove the component from.
+  template <typename Comp> void removeComponent(EntityRef entity);
+  /// Records the removal of an entity.
+  /// \param entity Entity to be removed.
+  void removeEntity(EntityRef entity);
+  /// Records the change of an entity's enabled state.
+  /// \param entity Entity to be enabled or disabled.
+  /// \param enabled True if the entity should be enabled, false if it should be disabled.
+  void enableEntity(EntityRef entity, bool enabled = true);
+  /// Records the disabling of an entity.
+  /// \param entity Entity to be disabled.
+  void disableEntity(EntityRef entity) { enableEntity(entity, false); }
+  /// Applies all the recorded commands on the given world, then clears the buffer.
+  /// \param world World to apply the commands on.
+  void execute(World& world);
+  /// Removes all the recorded commands without applying them.
+  void clear() noexcept;
+
+  CommandBuffer& operator=(const CommandBuffer&) = delete;
+  CommandBuffer& operator=(CommandBuffer&&) noexcept = default;
+
+private:
+  /// Recorded command, type-erased so that the callables it holds, along with their arguments, may be move-only.
+  class Command {
+  public:
+    Command() = default;
+    Command(const Command&) = delete;
+    Command(Command&&) noexcept = delete;
+
+    virtual void execute(World& world, std::vector<EntityHandle>& createdEntities) = 0;
+
+    Command& operator=(const Command&) = delete;
+    Command& operator=(Command&&) noexcept = delete;
+
+    virtual ~Command() = default;
+  };
+
+  template <typename FuncT>
+  class CommandImpl final : public Command {
+  public:
+    explicit CommandImpl(FuncT&& func) : m_func{ std::move(func) } {}
+
+    void execute(World& world, std::vector<EntityHandle>& createdEntities) override { m_func(world, createdEntities); }
+
+  private:
+    FuncT m_func;
+  };
+
+  /// Records a command.
+  /// \tparam FuncT Type of the callable to be recorded.
+  /// \param func Callable to be executed with the world & the entities created by the buffer so far.
+  template <typename FuncT> void recordCommand(FuncT&& func);
+
+  /// Gets the entity referred to by the given reference.
+  /// \param world World holding the entity.
+  /// \param entity Reference to the entity to be fetched.
+  /// \param createdEntities Handles of the entities created by the buffer so far.
+  /// \return Pointer to the found entity, or nullptr if it doesn't exist anymore.
+  static Entity* recoverEntity(World& world, const EntityRef& entity, const std::vector<EntityHandle>& createdEntities);
+
+  std::vector<std::unique_ptr<Command>> m_commands {};
+  std::size_t m_pendingEntityCount = 0;
+};
+
+} // namespace Raz
+
+#include "RaZ/CommandBuffer.inl"
+
+#endif // RAZ_COMMANDBUFFER_HPP
@@ -0,0 +1,41 @@
+#include <tuple>
+#include <type_traits>
+
+namespace Raz {
+
+template <typename Comp, typename... Args>
+void CommandBuffer::addComponent(EntityRef entity, Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
+
+  // std::make_tuple() would unwrap std::reference_wrapper arguments into references; the arguments are thus stored with their decayed types
+  recordCommand([entity, args = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...)] (World& world,
+                                                                                                 std::vector<EntityHandle>& createdEntities) mutable {
+    Entity* targetEntity = recoverEntity(world, entity, createdEntities);
+
+    if (targetEntity == nullptr)
+      return;
+
+    std::apply([targetEntity] (auto&&... compArgs) {
+      targetEntity->addComponent<Comp>(std::forward<decltype(compArgs)>(compArgs)...);
+    }, std::move(args));
+  });
+}
+
+template <typename FuncT>
+void CommandBuffer::recordCommand(FuncT&& func) {
+  m_commands.emplace_back(std::make_unique<CommandImpl<std::decay_t<FuncT>>>(std::forward<FuncT>(func)));
+}
+
+template <typename Comp>
+void CommandBuffer::removeComponent(EntityRef entity) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Removed component must be derived from Component.");
+
+  recordCommand([entity] (World& world, std::vector<EntityHandle>& createdEntities) {
+    Entity* targetEntity = recoverEntity(world, entity, createdEntities);
+
+    if (targetEntity != nullptr)
+      targetEntity->removeComponent<Comp>();
+  });
+}
+
+} // namespace Raz
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef RAZ_COMPONENTSTORAGE_HPP
+#define RAZ_COMPONENTSTORAGE_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Data/PagedPool.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Raz {
+
+/// ComponentPoolBase class, allowing to manipulate components without knowing their actual type.
+class ComponentPoolBase {
+public:
+  ComponentPoolBase() = default;
+  ComponentPoolBase(const ComponentPoolBase&) = delete;
+  ComponentPoolBase(ComponentPoolBase&&) noexcept = delete;
+
+  /// Gets the number of components held by the pool.
+  /// \return Number of components.
+  virtual std::size_t getComponentCount() const noexcept = 0;
+  /// Destroys the given component.
+  /// \param component Component to be destroyed. It *must* have been created by this pool.
+  virtual void erase(Component& component) = 0;
+
+  ComponentPoolBase& operator=(const ComponentPoolBase&) = delete;
+  ComponentPoolBase& operator=(ComponentPoolBase&&) noexcept = delete;
+
+  virtual ~ComponentPoolBase() = default;
+};
+
+/// ComponentPool class, storing all the components of a given type contiguously in memory.
+/// \tparam CompT Type of the components to be stored.
+template <typename CompT>
+class ComponentPool final : public ComponentPoolBase {
+  static_assert(std::is_base_of_v<Component, CompT>, "Error: A component pool can only store types derived from Component.");
+
+public:
+  std::size_t getComponentCount() const noexcept override { return m_components.getSize(); }
+
+  /// Constructs a component in the pool.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param args Arguments to be forwarded to the component.
+  /// \return Reference to the newly constructed component.
+  template <typename... Args> CompT& emplace(Args&&... args) { return m_components.emplace(std::forward<Args>(args)...); }
+  void erase(Component& component) override { m_components.erase(static_cast<CompT&>(component)); }
+  /// Calls the given action on every component held by the pool, following their storage order.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking a reference to a component as parameter.
+  template <typename FuncT> void forEach(FuncT&& action) { m_components.forEach(std::forward<FuncT>(action)); }
+
+private:
+  PagedPool<CompT> m_components {};
+};
+
+/// ComponentStorage class, holding a pool for each type of component.
+/// \note Creating or destroying components is not thread-safe; accessing existing ones from multiple threads is.
+class ComponentStorage {
+public:
+  ComponentStorage() = default;
+  ComponentStorage(const ComponentStorage&) = delete;
+  ComponentStorage(ComponentStorage&&) noexcept = delete;
+
+  /// Tells if a pool exists for the given component type.
+  /// \tparam CompT Type of the component to be checked.
+  /// \return True if a pool has already been created for the given component, false otherwise.
+  template <typename CompT> bool hasPool() const;
+  /// Gets the pool holding the components of the given type, creating it if it does not exist yet.
+  /// \tparam CompT Type of the components held by the pool.
+  /// \return Reference to the pool.
+  template <typename CompT> ComponentPool<CompT>& getPool();
+  /// Gets the number of components of the given type held by the storage.
+  /// \tparam CompT Type of the component to get the count of.
+  /// \return Number of components of the given type.
+  template <typename CompT> std::size_t getComponentCount() const;
+  /// Destroys the given component.
+  /// \param componentId ID of the component's type.
+  /// \param component Component to be destroyed. It *must* have been created by this storage.
+  void erase(std::size_t componentId, Component& component) { m_pools[componentId]->erase(component); }
+
+  ComponentStorage& operator=(const ComponentStorage&) = delete;
+  ComponentStorage& operator=(ComponentStorage&&) noexcept = delete;
+
+private:
+  std::vector<std::unique_ptr<ComponentPoolBase>> m_pools {};
+};
+
+} // namespace Raz
+
+#include "RaZ/ComponentStorage.inl"
+
+#endif // RAZ_COMPONENTSTORAGE_HPP
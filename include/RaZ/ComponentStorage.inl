@@ -0,0 +1,27 @@
+namespace Raz {
+
+template <typename CompT>
+bool ComponentStorage::hasPool() const {
+  const std::size_t compId = Component::getId<CompT>();
+  return ((compId < m_pools.size()) && m_pools[compId]);
+}
+
+template <typename CompT>
+ComponentPool<CompT>& ComponentStorage::getPool() {
+  const std::size_t compId = Component::getId<CompT>();
+
+  if (compId >= m_pools.size())
+    m_pools.resize(compId + 1);
+
+  if (m_pools[compId] == nullptr)
+    m_pools[compId] = std::make_unique<ComponentPool<CompT>>();
+
+  return static_cast<ComponentPool<CompT>&>(*m_pools[compId]);
+}
+
+template <typename CompT>
+std::size_t ComponentStorage::getComponentCount() const {
+  return (hasPool<CompT>() ? m_pools[Component::getId<CompT>()]->getComponentCount() : 0);
+}
+
+} // namespace Raz
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef RAZ_ASSETCACHE_HPP
+#define RAZ_ASSETCACHE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Raz {
+
+/// AssetCache class, holding assets shared through reference-counted handles & identified by a key (usually their file path).
+/// Loading an asset already in the cache only costs a lookup. The memory taken by the cached assets is accounted for, and once it exceeds the
+///   cache's budget, the least recently used assets which are not referenced anymore outside of the cache are evicted. Referenced assets are
+///   never evicted, their handles keeping them alive; the memory usage can thus exceed the budget.
+/// All functions can be called from any thread.
+/// \tparam T Type of the assets to be cached; can be const-qualified for the assets not to be modified once shared.
+template <typename T>
+class AssetCache {
+public:
+  using AssetPtr = std::shared_ptr<T>;
+
+  AssetCache() = default;
+  /// Creates an asset cache with a given memory budget.
+  /// \param memoryBudget Memory budget, in bytes.
+  explicit AssetCache(std::size_t memoryBudget) noexcept : m_memoryBudget{ memoryBudget } {}
+  AssetCache(const AssetCache&) = delete;
+  AssetCache(AssetCache&&) noexcept = delete;
+
+  std::size_t getAssetCount() const { std::lock_guard<std::mutex> lock(m_mutex); return m_entries.size(); }
+  /// Gets the memory taken by all the cached assets, referenced or not.
+  /// \return Memory usage, in bytes.
+  std::size_t getMemoryUsage() const { std::lock_guard<std::mutex> lock(m_mutex); return m_memoryUsage; }
+  std::size_t getMemoryBudget() const { std::lock_guard<std::mutex> lock(m_mutex); return m_memoryBudget; }
+  bool contains(const std::string& key) const { std::lock_guard<std::mutex> lock(m_mutex); return (m_entries.find(key) != m_entries.cend()); }
+
+  /// Sets the memory budget, evicting the unreferenced assets exceeding it.
+  /// \param memoryBudget Memory budget, in bytes.
+  void setMemoryBudget(std::size_t memoryBudget);
+  /// Finds an asset in the cache, marking it as the most recently used.
+  /// \param key Key of the asset to be found.
+  /// \return Handle to the asset if cached, nullptr otherwise.
+  AssetPtr find(const std::string& key);
+  /// Adds an asset into the cache, evicting the unreferenced assets exceeding the budget afterward.
+  /// \param key Key of the asset to be added.
+  /// \param asset Asset to be added.
+  /// \param memorySize Memory taken by the asset, in bytes.
+  /// \return Handle to the cached asset; if an asset was already cached with the same key, it is kept & returned instead of the given one.
+  AssetPtr insert(const std::string& key, AssetPtr asset, std::size_t memorySize);
+  /// Gets an asset from the cache, loading & adding it if not cached yet.
+  /// \note The cache is not locked while loading, so that several assets can be loaded in parallel. If the same asset is loaded at the same time
+  ///   by several threads, all of them will get the first one added.
+  /// \tparam LoadFuncT Type of the loading function.
+  /// \tparam MemorySizeFuncT Type of the memory size function.
+  /// \param key Key of the asset to be found or loaded.
+  /// \param loadFunc Function loading the asset, returning a handle to it.
+  /// \param memorySizeFunc Function computing the memory taken by the loaded asset in bytes, taking a constant reference to it as parameter.
+  /// \return Handle to the cached asset.
+  template <typename LoadFuncT, typename MemorySizeFuncT>
+  AssetPtr load(const std::string& key, LoadFuncT&& loadFunc, MemorySizeFuncT&& memorySizeFunc);
+  /// Removes an asset from the cache. If referenced, it remains valid until all of its handles are released.
+  /// \param key Key of the asset to be removed.
+  /// \return True if the asset has been removed, false if it was not cached.
+  bool remove(const std::string& key);
+  /// Evicts the least recently used unreferenced assets, until the memory usage does not exceed the given one.
+  /// \param maxMemoryUsage Memory usage to reach, in bytes; 0 evicts all unreferenced assets.
+  /// \return Number of evicted assets.
+  std::size_t evict(std::size_t maxMemoryUsage = 0);
+  /// Removes all the assets from the cache. Those referenced remain valid until all of their handles are released.
+  void clear();
+
+  AssetCache& operator=(const AssetCache&) = delete;
+  AssetCache& operator=(AssetCache&&) noexcept = delete;
+
+private:
+  struct Entry {
+    AssetPtr asset {};
+    std::size_t memorySize {};
+    typename std::list<std::string>::iterator usageIter {};
+  };
+
+  std::size_t evictUnlocked(std::size_t maxMemoryUsage);
+
+  mutable std::mutex m_mutex {};
+  std::unordered_map<std::string, Entry> m_entries {};
+  std::list<std::string> m_usageOrder {}; ///< Keys of the cached assets, from the most to the least recently used.
+  std::size_t m_memoryUsage = 0;
+  std::size_t m_memoryBudget = std::numeric_limits<std::size_t>::max();
+};
+
+} // namespace Raz
+
+#include "RaZ/Data/AssetCache.inl"
+
+#endif // RAZ_ASSETCACHE_HPP
@@ -0,0 +1,116 @@
+#include <utility>
+
+namespace Raz {
+
+template <typename T>
+void AssetCache<T>::setMemoryBudget(std::size_t memoryBudget) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_memoryBudget = memoryBudget;
+  evictUnlocked(m_memoryBudget);
+}
+
+template <typename T>
+typename AssetCache<T>::AssetPtr AssetCache<T>::find(const std::string& key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const auto entryIter = m_entries.find(key);
+
+  if (entryIter == m_entries.end())
+    return nullptr;
+
+  m_usageOrder.splice(m_usageOrder.begin(), m_usageOrder, entryIter->second.usageIter);
+  return entryIter->second.asset;
+}
+
+template <typename T>
+typename AssetCache<T>::AssetPtr AssetCache<T>::insert(const std::string& key, AssetPtr asset, std::size_t memorySize) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const auto [entryIter, isNewEntry] = m_entries.try_emplace(key);
+  Entry& entry = entryIter->second;
+
+  if (!isNewEntry) {
+    m_usageOrder.splice(m_usageOrder.begin(), m_usageOrder, entry.usageIter);
+    return entry.asset;
+  }
+
+  entry.asset      = std::move(asset);
+  entry.memorySize = memorySize;
+  entry.usageIter  = m_usageOrder.emplace(m_usageOrder.begin(), key);
+  m_memoryUsage   += memorySize;
+
+  // The handle is copied before evicting, so that the newly added asset is referenced & thus cannot be evicted right away
+  AssetPtr cachedAsset = entry.asset;
+  evictUnlocked(m_memoryBudget);
+
+  return cachedAsset;
+}
+
+template <typename T>
+template <typename LoadFuncT, typename MemorySizeFuncT>
+typename AssetCache<T>::AssetPtr AssetCache<T>::load(const std::string& key, LoadFuncT&& loadFunc, MemorySizeFuncT&& memorySizeFunc) {
+  if (AssetPtr asset = find(key))
+    return asset;
+
+  AssetPtr asset = loadFunc();
+  const std::size_t memorySize = memorySizeFunc(static_cast<const T&>(*asset));
+
+  return insert(key, std::move(asset), memorySize);
+}
+
+template <typename T>
+bool AssetCache<T>::remove(const std::string& key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const auto entryIter = m_entries.find(key);
+
+  if (entryIter == m_entries.end())
+    return false;
+
+  m_memoryUsage -= entryIter->second.memorySize;
+  m_usageOrder.erase(entryIter->second.usageIter);
+  m_entries.erase(entryIter);
+
+  return true;
+}
+
+template <typename T>
+std::size_t AssetCache<T>::evict(std::size_t maxMemoryUsage) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return evictUnlocked(maxMemoryUsage);
+}
+
+template <typename T>
+void AssetCache<T>::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_entries.clear();
+  m_usageOrder.clear();
+  m_memoryUsage = 0;
+}
+
+template <typename T>
+std::size_t AssetCache<T>::evictUnlocked(std::size_t maxMemoryUsage) {
+  std::size_t evictedCount = 0;
+
+  for (auto usageIter = m_usageOrder.end(); usageIter != m_usageOrder.begin() && m_memoryUsage > maxMemoryUsage;) {
+    --usageIter;
+
+    const Entry& entry = m_entries.at(*usageIter);
+
+    // An asset whose handle is only held by the cache cannot be referenced again without going through it, which is locked
+    if (entry.asset.use_count() > 1)
+      continue;
+
+    m_memoryUsage -= entry.memorySize;
+    m_entries.erase(*usageIter);
+    usageIter = m_usageOrder.erase(usageIter);
+
+    ++evictedCount;
+  }
+
+  return evictedCount;
+}
+
+} // namespace Raz
@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef RAZ_ASSETMANAGER_HPP
+#define RAZ_ASSETMANAGER_HPP
+
+#include "RaZ/Utils/JobSystem.hpp"
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+#include "RaZ/Data/AssetCache.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace Raz {
+
+class Image;
+class Mesh;
+class MeshRenderer;
+class UploadQueue;
+
+namespace ObjFormat { struct ObjData; }
+
+using ImageConstPtr   = std::shared_ptr<const Image>;
+using ObjDataConstPtr = std::shared_ptr<const ObjFormat::ObjData>;
+
+/// AssetManager class, loading assets asynchronously.
+/// Files are read & decoded in parallel on a thread pool, as a graph of jobs in which an asset waits for those it depends on (for example, a mesh
+///   waits for the textures referenced by its materials). Graphics objects are then created through an upload queue, which must be executed
+///   on the thread owning the graphics context.
+/// Loaded images, textures & meshes' data are kept in caches, so that requesting them again only costs a lookup; requesting an asset still
+///   being loaded returns the same one as well. The caches' memory budgets can be set to evict the least recently used assets not referenced anymore.
+/// The loading progress can be followed with the requested & finished task counts, to be shown for example with an OverlayProgressBar.
+/// \see Threading::getIoThreadPool(), RenderSystem::getUploadQueue()
+class AssetManager {
+public:
+  /// Creates an asset manager loading its assets on the I/O thread pool.
+  /// \param uploadQueue Queue to which the creation of graphics objects is added.
+  explicit AssetManager(UploadQueue& uploadQueue) : AssetManager(uploadQueue, Threading::getIoThreadPool()) {}
+  /// Creates an asset manager loading its assets on the given thread pool.
+  /// \param uploadQueue Queue to which the creation of graphics objects is added.
+  /// \param threadPool Thread pool on which to load the assets.
+  AssetManager(UploadQueue& uploadQueue, ThreadPool& threadPool) : m_uploadQueue{ uploadQueue }, m_threadPool{ threadPool }, m_jobSystem(threadPool) {}
+  AssetManager(const AssetManager&) = delete;
+  AssetManager(AssetManager&&) noexcept = delete;
+
+  /// Gets the number of tasks (file loadings & graphics objects creations) required by all the requested assets so far.
+  std::size_t getRequestedTaskCount() const noexcept { return m_requestedTaskCount.load(std::memory_order_acquire); }
+  /// Gets the number of tasks which have been finished, successfully or not.
+  std::size_t getFinishedTaskCount() const noexcept { return m_finishedTaskCount.load(std::memory_order_acquire); }
+  /// Gets the loading progress of all the requested assets so far.
+  /// \return Ratio of finished tasks, between 0 & 1; 1 if nothing has been requested.
+  float getProgress() const noexcept;
+  bool isLoading() const noexcept { return (getFinishedTaskCount() < getRequestedTaskCount()); }
+  /// Gets the cache of the loaded images, whose keys are their file paths, prefixed with "[flipped] " for those flipped vertically.
+  const AssetCache<const Image>& getImageCache() const noexcept { return m_imageCache; }
+  AssetCache<const Image>& getImageCache() noexcept { return m_imageCache; }
+  /// Gets the cache of the loaded textures, whose keys are their file paths, prefixed with "[flipped] " for those flipped vertically.
+  const AssetCache<Texture2D>& getTextureCache() const noexcept { return m_textureCache; }
+  AssetCache<Texture2D>& getTextureCache() noexcept { return m_textureCache; }
+  /// Gets the cache of the loaded meshes' data, whose keys are their file paths.
+  const AssetCache<const ObjFormat::ObjData>& getMeshDataCache() const noexcept { return m_meshDataCache; }
+  AssetCache<const ObjFormat::ObjData>& getMeshDataCache() noexcept { return m_meshDataCache; }
+
+  /// Loads an image asynchronously.
+  /// \param filePath File from which to load the image.
+  /// \param flipVertically Flip vertically the image when loading.
+  /// \return A std::shared_future holding the loaded image, or the exception thrown while loading it.
+  std::shared_future<ImageConstPtr> loadImage(const FilePath& filePath, bool flipVertically = false);
+  /// Loads a texture asynchronously. Its image is loaded on the thread pool, the texture then being created with mipmaps through the upload queue.
+  /// \param filePath File from which to load the texture.
+  /// \param flipVertically Flip vertically the texture's image when loading; true by default, since OpenGL maps images upside down.
+  /// \return A std::shared_future holding the created texture, or the exception thrown while loading it.
+  std::shared_future<Texture2DPtr> loadTexture(const FilePath& filePath, bool flipVertically = true);
+  /// Loads the data of a mesh asynchronously from an OBJ file, without creating any graphics object.
+  /// \param filePath File from which to load the mesh's data.
+  /// \return A std::shared_future holding the loaded data, or the exception thrown while loading it.
+  /// \see ObjFormat::loadData()
+  std::shared_future<ObjDataConstPtr> loadMeshData(const FilePath& filePath);
+  /// Loads a mesh asynchronously from an OBJ file. The textures its materials reference are loaded in parallel, the mesh & all of them then
+  ///   being created through the upload queue.
+  /// \note Meshes cannot be shared between entities; each call creates a new one, cloned from the cached mesh's data.
+  /// \param filePath File from which to load the mesh.
+  /// \return A std::future holding the pair containing respectively the mesh's data & rendering information, or the exception thrown while loading it.
+  /// \see ObjFormat::load()
+  std::future<std::pair<Mesh, MeshRenderer>> loadMesh(const FilePath& filePath);
+  /// Waits for all the requested assets to be loaded, helping loading them & executing the pending uploads meanwhile.
+  /// \note This must be called on the thread owning the graphics context.
+  void finishLoading();
+
+  AssetManager& operator=(const AssetManager&) = delete;
+  AssetManager& operator=(AssetManager&&) noexcept = delete;
+
+  /// Destroys the asset manager, finishing all the loadings beforehand.
+  /// \note Since pending uploads are executed, the manager must be destroyed on the thread owning the graphics context.
+  ~AssetManager() { finishLoading(); }
+
+private:
+  /// Asset requested but not yet loaded, or directly available if already cached.
+  template <typename T>
+  struct PendingAsset {
+    JobHandle job {}; ///< Job loading the asset; invalid if the asset is already loaded.
+    std::shared_future<T> asset {};
+  };
+
+  struct PendingTexture {
+    PendingAsset<ImageConstPtr> image {};
+    std::shared_ptr<std::promise<Texture2DPtr>> promise {};
+    std::shared_future<Texture2DPtr> texture {};
+  };
+
+  /// Computes the key of an image or texture in the caches.
+  /// \param filePath File from which the asset is loaded.
+  /// \param flipVertically Whether the asset's image is flipped vertically.
+  /// \return Asset's key.
+  static std::string computeImageKey(const FilePath& filePath, bool flipVertically);
+
+  /// Gets the given image from the cache if loaded, starting its loading otherwise if not already requested. The assets mutex must be locked.
+  /// \param filePath File from which to load the image.
+  /// \param flipVertically Flip vertically the image when loading.
+  /// \return Pending image.
+  PendingAsset<ImageConstPtr> requestImage(const FilePath& filePath, bool flipVertically);
+  /// Gets the given texture from the cache if loaded, starting its loading otherwise if not already requested. The assets mutex must be locked.
+  /// \param filePath File from which to load the texture.
+  /// \param flipVertically Flip vertically the texture's image when loading.
+  /// \return Pending texture, whose job is the one loading its image.
+  PendingAsset<Texture2DPtr> requestTexture(const FilePath& filePath, bool flipVertically);
+  /// Gets the given mesh's data from the cache if loaded, starting its loading otherwise if not already requested. The assets mutex must be locked.
+  /// \param filePath File from which to load the mesh's data.
+  /// \return Pending mesh's data.
+  PendingAsset<ObjDataConstPtr> requestMeshData(const FilePath& filePath);
+  /// Creates the given pending texture if not already done. Must be called on the thread owning the graphics context, once the texture's image is loaded.
+  /// \note The texture's task is not finished here, but by the upload scheduled when requesting it, which always calls this function last.
+  /// \param key Key of the texture to be created.
+  void createTexture(const std::string& key);
+  void finishTasks(std::size_t taskCount = 1) noexcept { m_finishedTaskCount.fetch_add(taskCount, std::memory_order_acq_rel); }
+
+  UploadQueue& m_uploadQueue;
+  ThreadPool& m_threadPool;
+  JobSystem m_jobSystem;
+
+  std::recursive_mutex m_assetsMutex {}; ///< Recursive, since jobs are executed right away when added if using Emscripten.
+  std::unordered_map<std::string, PendingAsset<ImageConstPtr>> m_pendingImages {};
+  std::unordered_map<std::string, PendingTexture> m_pendingTextures {};
+  std::unordered_map<std::string, PendingAsset<ObjDataConstPtr>> m_pendingMeshData {};
+
+  AssetCache<const Image> m_imageCache {};
+  AssetCache<Texture2D> m_textureCache {};
+  AssetCache<const ObjFormat::ObjData> m_meshDataCache {};
+
+  std::atomic<std::size_t> m_requestedTaskCount = 0;
+  std::atomic<std::size_t> m_finishedTaskCount = 0;
+};
+
+} // namespace Raz
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_ASSETMANAGER_HPP
@@ -3,35 +3,57 @@
 #ifndef RAZ_BITSET_HPP
 #define RAZ_BITSET_HPP
 
-#include <algorithm>
+#include <cstdint>
 #include <iosfwd>
 #include <initializer_list>
+#include <memory>
 #include <vector>
 
 namespace Raz {
 
+/// Bitset class, storing bits packed into 64-bit words.
+/// Up to 128 bits are stored inline in the object itself; larger bitsets allocate their words on the heap.
+/// The bits past the bitset's size are always kept disabled, so that words can be directly compared & counted.
 class Bitset {
 public:
   Bitset() = default;
-  explicit Bitset(std::size_t bitCount, bool initVal = false) : m_bits(bitCount, initVal) {}
-  Bitset(std::initializer_list<bool> values) : m_bits(values.begin(), values.end()) {}
+  explicit Bitset(std::size_t bitCount, bool initVal = false);
+  Bitset(std::initializer_list<bool> values);
+  Bitset(const Bitset& bitset);
+  Bitset(Bitset&& bitset) noexcept;
 
-  const std::vector<bool>& getBits() const noexcept { return m_bits; }
-  std::vector<bool>& getBits() noexcept { return m_bits; }
-  std::size_t getSize() const noexcept { return m_bits.size(); }
+  std::size_t getSize() const noexcept { return m_bitCount; }
+  /// Gets the bitset's bits, unpacked from its words.
+  /// \note The bits being stored packed, they are returned by value; modifying them must be done through setBit().
+  /// \return Copy of the bits.
+  std::vector<bool> getBits() const;
 
-  bool isEmpty() const noexcept { return (std::find(m_bits.cbegin(), m_bits.cend(), true) == m_bits.cend()); }
-  std::size_t getEnabledBitCount() const noexcept { return static_cast<std::size_t>(std::count(m_bits.cbegin(), m_bits.cend(), true)); }
-  std::size_t getDisabledBitCount() const noexcept { return m_bits.size() - getEnabledBitCount(); }
+  bool isEmpty() const noexcept;
+  std::size_t getEnabledBitCount() const noexcept;
+  std::size_t getDisabledBitCount() const noexcept { return m_bitCount - getEnabledBitCount(); }
+  /// Finds the first enabled bit, starting from the given position.
+  /// \param startPosition Position from which to start searching, included.
+  /// \return Position of the first enabled bit found, or the bitset's size if there is none.
+  std::size_t findFirstEnabledBit(std::size_t startPosition = 0) const noexcept;
+  /// Checks if at least one bit is enabled in both this & the given bitset. This is equivalent to !(*this & bitset).isEmpty(), without allocating.
+  /// \param bitset Bitset to be checked.
+  /// \return True if both bitsets have an enabled bit in common, false otherwise.
+  bool andAny(const Bitset& bitset) const noexcept;
+  /// Checks if all the enabled bits of this bitset are also enabled in the given one.
+  /// \param bitset Bitset to be checked.
+  /// \return True if this bitset is a subset of the given one, false otherwise.
+  bool isSubsetOf(const Bitset& bitset) const noexcept;
   void setBit(std::size_t position, bool value = true);
-  void resize(std::size_t newSize) { m_bits.resize(newSize); }
-  void reset() { std::fill(m_bits.begin(), m_bits.end(), false); }
-  void clear() noexcept { m_bits.clear(); }
-
-  Bitset operator~() const noexcept;
-  Bitset operator&(const Bitset& bitset) const noexcept;
-  Bitset operator|(const Bitset& bitset) const noexcept;
-  Bitset operator^(const Bitset& bitset) const noexcept;
+  void resize(std::size_t newSize);
+  void reset() noexcept;
+  void clear() noexcept { resize(0); }
+
+  Bitset& operator=(const Bitset& bitset);
+  Bitset& operator=(Bitset&& bitset) noexcept;
+  Bitset operator~() const;
+  Bitset operator&(const Bitset& bitset) const;
+  Bitset operator|(const Bitset& bitset) const;
+  Bitset operator^(const Bitset& bitset) const;
   Bitset operator<<(std::size_t shift) const;
   Bitset operator>>(std::size_t shift) const;
   Bitset& operator&=(const Bitset& bitset) noexcept;
@@ -39,16 +61,35 @@ public:
   Bitset& operator^=(const Bitset& bitset) noexcept;
   Bitset& operator<<=(std::size_t shift);
   Bitset& operator>>=(std::size_t shift);
-  bool operator[](std::size_t index) const noexcept { return m_bits[index]; }
-  bool operator==(const Bitset& bitset) const noexcept { return std::equal(m_bits.cbegin(), m_bits.cend(), bitset.getBits().cbegin()); }
+  bool operator[](std::size_t index) const noexcept;
+  /// Checks if both bitsets have the same bits enabled. Bitsets of different sizes are equal if the larger one's extra bits are all disabled.
+  /// \param bitset Bitset to be compared with.
+  /// \return True if both bitsets are equal, false otherwise.
+  bool operator==(const Bitset& bitset) const noexcept;
   bool operator!=(const Bitset& bitset) const noexcept { return !(*this == bitset); }
   friend std::ostream& operator<<(std::ostream& stream, const Bitset& bitset);
 
 private:
-  std::vector<bool> m_bits {};
+  static constexpr std::size_t wordBitCount    = 64;
+  static constexpr std::size_t inlineWordCount = 2;
+
+  static constexpr std::size_t computeWordCount(std::size_t bitCount) noexcept { return (bitCount + wordBitCount - 1) / wordBitCount; }
+
+  std::size_t getWordCount() const noexcept { return computeWordCount(m_bitCount); }
+  const uint64_t* getWords() const noexcept { return (m_heapWords ? m_heapWords.get() : m_inlineWords); }
+  uint64_t* getWords() noexcept { return (m_heapWords ? m_heapWords.get() : m_inlineWords); }
+  /// Makes sure the given number of words can be stored, moving the existing ones to a larger storage if needed.
+  /// \param wordCount Number of words to be stored.
+  void reserveWords(std::size_t wordCount);
+  /// Disables the bits of the last word which are past the bitset's size.
+  void clearUnusedBits() noexcept;
+
+  std::size_t m_bitCount = 0;
+  std::size_t m_wordCapacity = inlineWordCount;
+  uint64_t m_inlineWords[inlineWordCount] {};
+  std::unique_ptr<uint64_t[]> m_heapWords {};
 };
 
 } // namespace Raz
 
 #endif // RAZ_BITSET_HPP
-
@@ -76,12 +76,8 @@ public:
   Entity* query(const Ray& ray, RayHit* hit = nullptr) const { return m_rootNode.query(ray, hit); }
 
 private:
-  /// Links the entity to the system and rebuilds the BVH.
-  /// \param entity Entity to be linked.
-  void linkEntity(const EntityPtr& entity) override;
-  /// Uninks the entity to the system and rebuilds the BVH.
-  /// \param entity Entity to be unlinked.
-  void unlinkEntity(const EntityPtr& entity) override;
+  /// Rebuilds the BVH once entities have been linked or unlinked.
+  void onLinkedEntitiesChanged() override { build(); }
 
   BvhNode m_rootNode {};
 };
@@ -40,6 +40,9 @@ public:
   std::size_t recoverTriangleCount() const;
 
   template <typename... Args> Submesh& addSubmesh(Args&&... args) { return m_submeshes.emplace_back(std::forward<Args>(args)...); }
+  /// Clones the mesh, copying all of its submeshes' data.
+  /// \return Cloned mesh.
+  Mesh clone() const;
   /// Computes & updates the mesh's bounding box by computing the submeshes' ones.
   /// \return Mesh's bounding box.
   const AABB& computeBoundingBox();
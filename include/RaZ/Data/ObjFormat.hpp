@@ -3,21 +3,63 @@
 #ifndef RAZ_OBJFORMAT_HPP
 #define RAZ_OBJFORMAT_HPP
 
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <functional>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace Raz {
 
-class FilePath;
-class Mesh;
 class MeshRenderer;
 
 namespace ObjFormat {
 
+/// Material read from an MTL file, whose textures are only referenced by their paths.
+struct MaterialData {
+  MaterialType type = MaterialType::BLINN_PHONG;
+  std::vector<std::pair<std::string, Vec3f>> vec3Attributes {};   ///< Uniform names & values of the 3D vector attributes.
+  std::vector<std::pair<std::string, float>> floatAttributes {};  ///< Uniform names & values of the scalar attributes.
+  std::vector<std::pair<std::string, FilePath>> textures {};      ///< Uniform names & file paths of the textures.
+};
+
+/// Data read from an OBJ file & its MTL files. No graphics object is created to get it, which can thus be loaded from any thread.
+struct ObjData {
+  Mesh mesh {};
+  std::vector<MaterialData> materials {};
+  std::vector<std::size_t> submeshMaterialIndices {}; ///< Index of the material used by each submesh.
+};
+
 /// Loads a mesh from an OBJ file.
 /// \param filePath File from which to load the mesh.
 /// \return Pair containing respectively the mesh's data (vertices & indices) and rendering information (materials, textures, ...).
 std::pair<Mesh, MeshRenderer> load(const FilePath& filePath);
 
+/// Loads the data of a mesh from an OBJ file, without creating any graphics object.
+/// \param filePath File from which to load the mesh's data.
+/// \return Mesh's data, along with the materials & the paths of the textures it references.
+/// \see createMesh()
+ObjData loadData(const FilePath& filePath);
+
+/// Creates a mesh & its rendering information from data loaded from an OBJ file.
+/// \note This must be called on the thread owning the graphics context.
+/// \param objData Data from which to create the mesh.
+/// \param textureLoader Function returning the texture corresponding to a file path; a null texture is simply ignored.
+/// \return Pair containing respectively the mesh's data (vertices & indices) and rendering information (materials, textures, ...).
+std::pair<Mesh, MeshRenderer> createMesh(ObjData&& objData, const std::function<Texture2DPtr(const FilePath&)>& textureLoader);
+
+/// Creates a mesh & its rendering information from data loaded from an OBJ file, which is left untouched so that it can be shared.
+/// \note This must be called on the thread owning the graphics context.
+/// \param objData Data from which to create the mesh; its mesh is cloned.
+/// \param textureLoader Function returning the texture corresponding to a file path; a null texture is simply ignored.
+/// \return Pair containing respectively the mesh's data (vertices & indices) and rendering information (materials, textures, ...).
+std::pair<Mesh, MeshRenderer> createMesh(const ObjData& objData, const std::function<Texture2DPtr(const FilePath&)>& textureLoader);
+
 /// Saves a mesh to an OBJ file.
 /// \param filePath File to which to save the mesh.
 /// \param mesh Mesh to export data from.
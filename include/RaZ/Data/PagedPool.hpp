@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef RAZ_PAGEDPOOL_HPP
+#define RAZ_PAGEDPOOL_HPP
+
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Raz {
+
+/// PagedPool class, storing elements contiguously in fixed-size pages.
+/// Elements are constructed in place and are never moved afterward: references to them remain valid until they are erased.
+/// Slots freed by erased elements are reused by the next insertions.
+/// \tparam T Type of the elements to be stored.
+/// \tparam PageSize Number of elements each page can hold.
+template <typename T, std::size_t PageSize = 256>
+class PagedPool {
+  static_assert(PageSize > 0, "Error: A pool page must be able to hold at least one element.");
+
+public:
+  PagedPool() = default;
+  PagedPool(const PagedPool&) = delete;
+  PagedPool(PagedPool&& pool) noexcept;
+
+  std::size_t getSize() const noexcept { return m_elementCount; }
+  std::size_t getCapacity() const noexcept { return m_pages.size() * PageSize; }
+  bool isEmpty() const noexcept { return (m_elementCount == 0); }
+
+  /// Allocates the pages needed to hold at least the given number of elements.
+  /// \param elementCount Number of elements to reserve memory for.
+  void reserve(std::size_t elementCount);
+  /// Constructs an element in the first available slot.
+  /// \tparam Args Types of the arguments to be forwarded to the element.
+  /// \param args Arguments to be forwarded to the element.
+  /// \return Reference to the newly constructed element.
+  template <typename... Args> T& emplace(Args&&... args);
+  /// Destroys an element, making its slot available for a future insertion.
+  /// \param element Element to be destroyed. It *must* have been created by this pool.
+  void erase(T& element);
+  /// Calls the given action on every element held by the pool, following their storage order.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking a reference to an element as parameter.
+  template <typename FuncT> void forEach(FuncT&& action);
+  /// Calls the given action on every element held by the pool, following their storage order.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking a constant reference to an element as parameter.
+  template <typename FuncT> void forEach(FuncT&& action) const;
+  /// Destroys all the elements held by the pool. The allocated pages are kept to be reused.
+  void clear();
+
+  PagedPool& operator=(const PagedPool&) = delete;
+  PagedPool& operator=(PagedPool&& pool) noexcept;
+
+  ~PagedPool() { clear(); }
+
+private:
+  struct Slot {
+    alignas(T) unsigned char storage[sizeof(T)];
+    bool isOccupied = false;
+  };
+
+  static T& recoverElement(Slot& slot) noexcept { return *std::launder(static_cast<T*>(static_cast<void*>(slot.storage))); }
+  static const T& recoverElement(const Slot& slot) noexcept { return *std::launder(static_cast<const T*>(static_cast<const void*>(slot.storage))); }
+
+  std::vector<std::unique_ptr<Slot[]>> m_pages {};
+  std::vector<Slot*> m_freeSlots {};
+  std::size_t m_usedSlotCount = 0; ///< Number of slots that have been used at least once; any slot after those has never been constructed into.
+  std::size_t m_elementCount = 0;
+};
+
+} // namespace Raz
+
+#include "RaZ/Data/PagedPool.inl"
+
+#endif // RAZ_PAGEDPOOL_HPP
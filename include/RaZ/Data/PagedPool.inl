@@ -0,0 +1,119 @@
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace Raz {
+
+template <typename T, std::size_t PageSize>
+PagedPool<T, PageSize>::PagedPool(PagedPool&& pool) noexcept
+  : m_pages{ std::move(pool.m_pages) },
+    m_freeSlots{ std::move(pool.m_freeSlots) },
+    m_usedSlotCount{ std::exchange(pool.m_usedSlotCount, 0) },
+    m_elementCount{ std::exchange(pool.m_elementCount, 0) } {}
+
+template <typename T, std::size_t PageSize>
+void PagedPool<T, PageSize>::reserve(std::size_t elementCount) {
+  const std::size_t pageCount = (elementCount + PageSize - 1) / PageSize;
+
+  while (m_pages.size() < pageCount)
+    m_pages.emplace_back(std::make_unique<Slot[]>(PageSize));
+}
+
+template <typename T, std::size_t PageSize>
+template <typename... Args>
+T& PagedPool<T, PageSize>::emplace(Args&&... args) {
+  Slot* slot {};
+
+  if (!m_freeSlots.empty()) {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  } else {
+    if (m_usedSlotCount == getCapacity())
+      m_pages.emplace_back(std::make_unique<Slot[]>(PageSize));
+
+    slot = &m_pages[m_usedSlotCount / PageSize][m_usedSlotCount % PageSize];
+    ++m_usedSlotCount;
+  }
+
+  try {
+    new (slot->storage) T(std::forward<Args>(args)...);
+  } catch (...) {
+    // The slot is given back so that it can be used later
+    m_freeSlots.emplace_back(slot);
+    throw;
+  }
+
+  slot->isOccupied = true;
+  ++m_elementCount;
+
+  return recoverElement(*slot);
+}
+
+template <typename T, std::size_t PageSize>
+void PagedPool<T, PageSize>::erase(T& element) {
+  // The element being constructed at the very beginning of its slot, the latter's address can be directly recovered
+  static_assert(offsetof(Slot, storage) == 0, "Error: A pool slot's storage must be its first member.");
+  auto* slot = static_cast<Slot*>(static_cast<void*>(&element));
+
+  assert("Error: The element to be erased is not held by the pool." && slot->isOccupied);
+
+  element.~T();
+  slot->isOccupied = false;
+
+  m_freeSlots.emplace_back(slot);
+  --m_elementCount;
+}
+
+template <typename T, std::size_t PageSize>
+template <typename FuncT>
+void PagedPool<T, PageSize>::forEach(FuncT&& action) {
+  for (std::size_t slotIndex = 0; slotIndex < m_usedSlotCount; ++slotIndex) {
+    Slot& slot = m_pages[slotIndex / PageSize][slotIndex % PageSize];
+
+    if (slot.isOccupied)
+      action(recoverElement(slot));
+  }
+}
+
+template <typename T, std::size_t PageSize>
+template <typename FuncT>
+void PagedPool<T, PageSize>::forEach(FuncT&& action) const {
+  for (std::size_t slotIndex = 0; slotIndex < m_usedSlotCount; ++slotIndex) {
+    const Slot& slot = m_pages[slotIndex / PageSize][slotIndex % PageSize];
+
+    if (slot.isOccupied)
+      action(recoverElement(slot));
+  }
+}
+
+template <typename T, std::size_t PageSize>
+void PagedPool<T, PageSize>::clear() {
+  for (std::size_t slotIndex = 0; slotIndex < m_usedSlotCount; ++slotIndex) {
+    Slot& slot = m_pages[slotIndex / PageSize][slotIndex % PageSize];
+
+    if (!slot.isOccupied)
+      continue;
+
+    recoverElement(slot).~T();
+    slot.isOccupied = false;
+  }
+
+  m_freeSlots.clear();
+  m_usedSlotCount = 0;
+  m_elementCount  = 0;
+}
+
+template <typename T, std::size_t PageSize>
+PagedPool<T, PageSize>& PagedPool<T, PageSize>::operator=(PagedPool&& pool) noexcept {
+  // The currently held elements must be destroyed before their pages are released
+  clear();
+
+  m_pages         = std::move(pool.m_pages);
+  m_freeSlots     = std::move(pool.m_freeSlots);
+  m_usedSlotCount = std::exchange(pool.m_usedSlotCount, 0);
+  m_elementCount  = std::exchange(pool.m_elementCount, 0);
+
+  return *this;
+}
+
+} // namespace Raz
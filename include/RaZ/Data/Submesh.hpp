@@ -14,7 +14,6 @@ namespace Raz {
 class Submesh {
 public:
   Submesh() noexcept = default;
-  Submesh(const Submesh&) = delete;
   Submesh(Submesh&&) noexcept = default;
 
   const std::vector<Vertex>& getVertices() const { return m_vertices; }
@@ -28,6 +27,9 @@ public:
   std::size_t getTriangleIndexCount() const { return m_triangleIndices.size(); }
   const AABB& getBoundingBox() const { return m_boundingBox; }
 
+  /// Clones the submesh, copying all of its data.
+  /// \return Cloned submesh.
+  Submesh clone() const { return *this; }
   /// Computes & updates the submesh's bounding box.
   /// \return Submesh's bounding box.
   const AABB& computeBoundingBox();
@@ -36,6 +38,8 @@ public:
   Submesh& operator=(Submesh&&) noexcept = default;
 
 private:
+  Submesh(const Submesh&) = default;
+
   std::vector<Vertex> m_vertices {};
   std::vector<unsigned int> m_lineIndices {};
   std::vector<unsigned int> m_triangleIndices {};
@@ -4,8 +4,10 @@
 #define RAZ_ENTITY_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/ComponentStorage.hpp"
 #include "RaZ/Data/Bitset.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -15,16 +17,48 @@ namespace Raz {
 class Entity;
 using EntityPtr = std::unique_ptr<Entity>;
 
+class World;
+
+/// Handle referring to an entity held by a World.
+/// The index of a removed entity is given to the next one created; the generation allows detecting that a handle refers to a removed entity.
+struct EntityHandle {
+  std::size_t index {};
+  uint32_t generation {};
+
+  bool operator==(const EntityHandle& handle) const noexcept { return (index == handle.index && generation == handle.generation); }
+  bool operator!=(const EntityHandle& handle) const noexcept { return !(*this == handle); }
+};
+
 /// Entity class representing an aggregate of Component objects.
+/// The components are not owned individually by the entity, but are held by a ComponentStorage which keeps those of the same type contiguous.
 class Entity {
+  friend class World;
+
 public:
+  /// Creates a standalone entity, which will have its own component storage.
+  /// \param index Index of the entity.
+  /// \param enabled True if the entity should be enabled, false otherwise.
   explicit Entity(std::size_t index, bool enabled = true) : m_id{ index }, m_enabled{ enabled } {}
+  /// Creates an entity whose components will be held by the given storage, which can be shared with other entities.
+  /// \param index Index of the entity.
+  /// \param componentStorage Storage holding the entity's components. It must outlive the entity.
+  /// \param enabled True if the entity should be enabled, false otherwise.
+  Entity(std::size_t index, ComponentStorage& componentStorage, bool enabled = true)
+    : m_id{ index }, m_enabled{ enabled }, m_componentStorage{ &componentStorage } {}
   Entity(const Entity&) = delete;
   Entity(Entity&&) noexcept = delete;
 
+  /// Gets the entity's ID. Within a World, it is unique among the existing entities, but may be reused by another one once this entity is removed.
+  /// \return Entity's ID.
   std::size_t getId() const noexcept { return m_id; }
+  /// Gets the number of entities which have been created with the same ID before this one.
+  /// \return Entity's generation.
+  uint32_t getGeneration() const noexcept { return m_generation; }
+  /// Gets a handle referring to the entity, which can be stored and later checked for validity (see World::recoverEntity()).
+  /// \return Entity's handle.
+  EntityHandle getHandle() const noexcept { return EntityHandle{ m_id, m_generation }; }
   bool isEnabled() const noexcept { return m_enabled; }
-  const std::vector<ComponentPtr>& getComponents() const noexcept { return m_components; }
+  const std::vector<Component*>& getComponents() const noexcept { return m_components; }
   const Bitset& getEnabledComponents() const noexcept { return m_enabledComponents; }
 
   template <typename... Args> static EntityPtr create(Args&&... args) { return std::make_unique<Entity>(std::forward<Args>(args)...); }
@@ -65,21 +99,37 @@ public:
   /// Changes the entity's enabled state.
   /// Enables or disables the entity according to the given parameter.
   /// \param enabled True if the entity should be enabled, false if it should be disabled.
-  void enable(bool enabled = true) noexcept { m_enabled = enabled; }
+  void enable(bool enabled = true);
   /// Disables the entity.
-  void disable() noexcept { enable(false); }
+  void disable() { enable(false); }
 
   Entity& operator=(const Entity&) = delete;
   Entity& operator=(Entity&&) noexcept = delete;
 
+  ~Entity();
+
 protected:
   Entity() = default;
 
 private:
+  /// Gets the storage holding the entity's components, creating one owned by the entity if it has none.
+  /// \return Reference to the component storage.
+  ComponentStorage& recoverComponentStorage();
+  /// Notifies the world owning the entity, if any, that the latter has changed.
+  /// The world's views are updated immediately, while its systems will be on the next refresh.
+  void markDirty();
+
   std::size_t m_id {};
+  uint32_t m_generation {};
   bool m_enabled {};
-  std::vector<ComponentPtr> m_components {};
+  bool m_isDirty = false; ///< Whether the entity is awaiting its owning world's refresh.
+  std::vector<Component*> m_components {};
   Bitset m_enabledComponents {};
+
+  ComponentStorage* m_componentStorage {};
+  std::unique_ptr<ComponentStorage> m_ownedComponentStorage {}; ///< Storage of a standalone entity, which is not given an external one.
+
+  World* m_world {}; ///< World owning the entity; a standalone entity has none.
 };
 
 } // namespace Raz
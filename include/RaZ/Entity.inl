@@ -11,10 +11,20 @@ Comp& Entity::addComponent(Args&&... args) {
   if (compId >= m_components.size())
     m_components.resize(compId + 1);
 
-  m_components[compId] = std::make_unique<Comp>(std::forward<Args>(args)...);
+  ComponentPool<Comp>& componentPool = recoverComponentStorage().getPool<Comp>();
+
+  // The new component is constructed before destroying any previous one, since the latter may be used to construct the former
+  Comp& component = componentPool.emplace(std::forward<Args>(args)...);
+
+  if (m_components[compId] != nullptr)
+    componentPool.erase(*m_components[compId]);
+
+  m_components[compId] = &component;
   m_enabledComponents.setBit(compId);
 
-  return static_cast<Comp&>(*m_components[compId]);
+  markDirty();
+
+  return component;
 }
 
 template <typename Comp>
@@ -56,8 +66,11 @@ void Entity::removeComponent() {
   if (hasComponent<Comp>()) {
     const std::size_t compId = Component::getId<Comp>();
 
-    m_components[compId].reset();
+    m_componentStorage->getPool<Comp>().erase(*m_components[compId]);
+    m_components[compId] = nullptr;
     m_enabledComponents.setBit(compId, false);
+
+    markDirty();
   }
 }
 
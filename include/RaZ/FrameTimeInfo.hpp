@@ -0,0 +1,44 @@
+#pragma once
+
+#ifndef RAZ_FRAMETIMEINFO_HPP
+#define RAZ_FRAMETIMEINFO_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace Raz {
+
+/// Timing information of a frame, telling how much time has elapsed & how many fixed steps are to be executed.
+struct FrameTimeInfo {
+  float deltaTime {}; ///< Time elapsed since the last frame, in seconds.
+  float substepTime = 0.016666f; ///< Default time of a fixed step, in seconds.
+  std::size_t substepCount {}; ///< Number of fixed steps to be executed during the frame by the systems using the default step time.
+  std::size_t maxSubstepCount = std::numeric_limits<std::size_t>::max(); ///< Maximum number of fixed steps a system may execute during a single frame.
+  float interpolationAlpha {}; ///< Progress between the last fixed step & the next one, in [0; 1), allowing to interpolate between two simulated states.
+};
+
+/// Computes the number of fixed steps fitting in the given time, which is decremented accordingly.
+/// If more steps than the given maximum would be needed, the remaining whole steps are dropped: the simulation is then slowed down,
+///   instead of taking longer & longer frames to catch up.
+/// \param remainingTime Time accumulated since the last executed step, in seconds.
+/// \param stepTime Time of a fixed step, in seconds.
+/// \param maxStepCount Maximum number of steps to be executed.
+/// \return Number of fixed steps to be executed.
+inline std::size_t consumeFixedSteps(float& remainingTime, float stepTime, std::size_t maxStepCount = std::numeric_limits<std::size_t>::max()) {
+  std::size_t stepCount = 0;
+
+  while (remainingTime >= stepTime && stepCount < maxStepCount) {
+    ++stepCount;
+    remainingTime -= stepTime;
+  }
+
+  if (remainingTime >= stepTime)
+    remainingTime = std::fmod(remainingTime, stepTime);
+
+  return stepCount;
+}
+
+} // namespace Raz
+
+#endif // RAZ_FRAMETIMEINFO_HPP
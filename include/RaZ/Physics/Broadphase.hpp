@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef RAZ_BROADPHASE_HPP
+#define RAZ_BROADPHASE_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Raz {
+
+class AABB;
+
+/// Pair of indices of two overlapping bounding boxes, the first index always being the lowest.
+using BroadphasePair = std::pair<std::size_t, std::size_t>;
+
+/// Broadphase class, quickly finding which bounding boxes overlap so that only those are then checked precisely for collisions.
+/// Can be derived to implement other broadphase algorithms (see PhysicsSystem::setBroadphase()).
+class Broadphase {
+public:
+  Broadphase() = default;
+  Broadphase(const Broadphase&) = delete;
+  Broadphase(Broadphase&&) noexcept = default;
+
+  /// Finds all pairs of overlapping bounding boxes; boxes merely touching each other are considered overlapping.
+  /// \param boxes Bounding boxes to be checked.
+  /// \param pairs List filled with the pairs of overlapping boxes, sorted by their first then second index; it is cleared beforehand.
+  virtual void computePairs(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs) = 0;
+  /// Finds the pairs of overlapping bounding boxes made of one box of each of two groups; the pairs within a same group are ignored.
+  /// The default implementation finds all pairs before discarding the irrelevant ones; derived classes should override it to avoid finding them at all.
+  /// \param boxes Bounding boxes to be checked, those of the first group being listed before those of the second.
+  /// \param firstGroupCount Number of boxes in the first group.
+  /// \param pairs List filled with the pairs of overlapping boxes, sorted by their first then second index; it is cleared beforehand. The first
+  ///   index of each pair thus always refers to a box of the first group.
+  virtual void computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs);
+  /// Computes the memory allocated by the broadphase to find the pairs, kept from one call to the next.
+  /// \return Allocated memory, in bytes.
+  virtual std::size_t computeMemoryUsage() const noexcept { return 0; }
+
+  Broadphase& operator=(const Broadphase&) = delete;
+  Broadphase& operator=(Broadphase&&) noexcept = default;
+
+  virtual ~Broadphase() = default;
+};
+
+/// BruteForceBroadphase class, checking every box against every other one. Its cost is quadratic, and should thus only be used with very few boxes.
+class BruteForceBroadphase final : public Broadphase {
+public:
+  void computePairs(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs) override;
+  void computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs) override;
+};
+
+/// SweepAndPruneBroadphase class, sorting the boxes along the axis on which they are the most spread out, then sweeping over them so that each
+///   box is only checked against those overlapping it along that axis.
+class SweepAndPruneBroadphase final : public Broadphase {
+public:
+  void computePairs(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs) override;
+  void computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs) override;
+  std::size_t computeMemoryUsage() const noexcept override;
+
+private:
+  struct Endpoint {
+    float minValue {}; ///< Lower bound of the box along the sweep axis.
+    std::size_t boxIndex {};
+  };
+
+  /// Sorts the boxes along the axis on which they are the most spread out, then sweeps over them to find the overlapping ones.
+  /// \tparam FilterT Type of the filter to be applied to the pairs.
+  /// \param boxes Bounding boxes to be checked.
+  /// \param pairs List filled with the pairs of overlapping boxes, sorted by their first then second index; it is cleared beforehand.
+  /// \param isPairRelevant Filter called with the indices of two boxes before checking if they overlap, returning false if they must be ignored.
+  template <typename FilterT>
+  void sweepAndPrune(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs, const FilterT& isPairRelevant);
+
+  std::vector<Endpoint> m_endpoints {}; ///< Kept to avoid reallocating them on each call.
+  std::vector<Vec3f> m_minPositions {};
+  std::vector<Vec3f> m_maxPositions {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_BROADPHASE_HPP
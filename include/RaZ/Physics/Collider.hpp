@@ -6,32 +6,44 @@
 #include "RaZ/Component.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <variant>
+
 namespace Raz {
 
+/// Shape held by value by a collider; the index of each alternative is the value of its ShapeType.
+using ColliderShape = std::variant<Line, Plane, Sphere, Triangle, Quad, AABB, OBB>;
+
 class Collider final : public Component {
 public:
-  explicit Collider(Shape&& shape) { setShape(std::move(shape)); }
-  Collider(const Collider&) = delete;
+  explicit Collider(Shape&& shape) : m_shape{ createShape(std::move(shape)) } {}
+  Collider(const Collider&) = default;
   Collider(Collider&&) noexcept = default;
 
-  ShapeType getShapeType() const noexcept { return m_shapeType; }
-  const Shape& getShape() const noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
-  Shape& getShape() noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
+  ShapeType getShapeType() const noexcept { return static_cast<ShapeType>(m_shape.index()); }
+  const Shape& getShape() const noexcept { return std::visit([] (const Shape& shape) noexcept -> const Shape& { return shape; }, m_shape); }
+  Shape& getShape() noexcept { return const_cast<Shape&>(static_cast<const Collider*>(this)->getShape()); }
   template <typename ShapeT> const ShapeT& getShape() const noexcept;
   template <typename ShapeT> ShapeT& getShape() noexcept { return const_cast<ShapeT&>(static_cast<const Collider*>(this)->getShape<ShapeT>()); }
 
-  void setShape(Shape&& shape);
+  void setShape(Shape&& shape) { m_shape = createShape(std::move(shape)); }
 
-  bool intersects(const Collider& collider) const { return intersects(*collider.m_colliderShape); }
+  /// Calls the given function with the collider's shape as its actual type, without any virtual call.
+  /// \tparam FuncT Type of the function to be called; must accept any of the shapes' types.
+  /// \param func Function to be called with the shape.
+  /// \return Value returned by the function.
+  template <typename FuncT> decltype(auto) visitShape(FuncT&& func) const { return std::visit(std::forward<FuncT>(func), m_shape); }
+
+  bool intersects(const Collider& collider) const;
   bool intersects(const Shape& shape) const;
   bool intersects(const Ray& ray, RayHit* hit = nullptr) const;
 
-  Collider& operator=(const Collider&) = delete;
+  Collider& operator=(const Collider&) = default;
   Collider& operator=(Collider&&) noexcept = default;
 
 private:
-  ShapeType m_shapeType {};
-  std::unique_ptr<Shape> m_colliderShape {};
+  static ColliderShape createShape(Shape&& shape);
+
+  ColliderShape m_shape;
 };
 
 } // namespace Raz
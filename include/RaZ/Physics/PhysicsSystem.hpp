@@ -4,7 +4,16 @@
 #define RAZ_PHYSICSSYSTEM_HPP
 
 #include "RaZ/System.hpp"
+#include "RaZ/Math/Transform.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Physics/Broadphase.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <variant>
 
 namespace Raz {
 
@@ -14,22 +23,219 @@ public:
 
   constexpr const Vec3f& getGravity() const noexcept { return m_gravity; }
   constexpr float getFriction() const noexcept { return m_friction; }
+  constexpr float getSleepVelocity() const noexcept { return m_sleepVelocity; }
+  constexpr float getSleepDelay() const noexcept { return m_sleepDelay; }
+  constexpr std::size_t getSolverIterationCount() const noexcept { return m_solverIterationCount; }
+  constexpr bool isWarmStartingEnabled() const noexcept { return m_isWarmStartingEnabled; }
+  const Broadphase& getBroadphase() const noexcept { return *m_broadphase; }
+  /// Gets the number of pairs of overlapping bounding boxes, each made of a collider's & of another entity's rigid body movement's, found by
+  ///   the broadphase during the last step; each of them is then checked precisely. The colliders without bounding box (planes) are not included.
+  /// \return Number of broadphase pairs.
+  std::size_t getBroadphasePairCount() const noexcept { return m_broadphasePairs.size(); }
+  /// Gets the number of simulation islands found during the last step.
+  /// An island is a group of moving rigid bodies which may collide with each other's colliders; islands being independent from each
+  ///   other, they are solved in parallel.
+  /// \return Number of simulation islands.
+  std::size_t getIslandCount() const noexcept { return (m_islandCandidateOffsets.empty() ? 0 : m_islandCandidateOffsets.size() - 1); }
+  /// Gets the number of rigid bodies which were sleeping during the last step, & were thus neither integrated nor checked for collisions.
+  /// \return Number of sleeping rigid bodies.
+  constexpr std::size_t getSleepingRigidBodyCount() const noexcept { return m_sleepingRigidBodyCount; }
+  /// Gets the number of contacts between rigid bodies & colliders found during the last step.
+  /// \return Number of contacts.
+  std::size_t getContactCount() const noexcept { return m_contactManifolds.size(); }
+  /// Computes the memory allocated by the physics system & its broadphase to simulate the entities, which is kept from one step to the next.
+  /// \return Allocated memory, in bytes.
+  std::size_t computeMemoryUsage() const noexcept;
 
   void setGravity(const Vec3f& gravity) { m_gravity = gravity; }
   void setFriction(float friction) {
     assert("Error: Friction coefficient must be between 0 & 1." && (friction >= 0.f && friction <= 1.f));
     m_friction = friction;
   }
+  /// Sets the velocity below which a rigid body is considered at rest. Rigid bodies at rest for long enough are put to sleep.
+  /// \param sleepVelocity Sleep velocity; if 0, rigid bodies never fall asleep.
+  /// \see setSleepDelay()
+  void setSleepVelocity(float sleepVelocity) {
+    assert("Error: The sleep velocity must be positive." && sleepVelocity >= 0.f);
+    m_sleepVelocity = sleepVelocity;
+  }
+  /// Sets the time during which a rigid body must remain at rest before being put to sleep.
+  /// \param sleepDelay Sleep delay, in seconds.
+  /// \see setSleepVelocity()
+  void setSleepDelay(float sleepDelay) {
+    assert("Error: The sleep delay must be positive." && sleepDelay >= 0.f);
+    m_sleepDelay = sleepDelay;
+  }
+  /// Sets the number of iterations made by the contact solver on each step.
+  /// More iterations make the contacts between several rigid bodies, such as stacks, converge faster, at the expense of a higher cost.
+  /// \param iterationCount Number of solver iterations; must be strictly positive.
+  void setSolverIterationCount(std::size_t iterationCount) {
+    assert("Error: The solver iteration count must be strictly positive." && iterationCount > 0);
+    m_solverIterationCount = iterationCount;
+  }
+  /// Enables or disables warm starting, the contact solver then starting from the impulses found on the last step for the same contacts.
+  /// As contacts often persist over several steps, this makes resting rigid bodies converge in much fewer iterations.
+  /// \param enabled True if warm starting should be enabled, false otherwise.
+  void enableWarmStarting(bool enabled = true) noexcept { m_isWarmStartingEnabled = enabled; }
+  void disableWarmStarting() noexcept { enableWarmStarting(false); }
+  /// Sets the broadphase algorithm finding the colliders a rigid body may hit, among which the collisions are then checked precisely.
+  /// The default one is a SweepAndPruneBroadphase.
+  /// \tparam BroadphaseT Type of the broadphase to be set; must be derived from Broadphase.
+  /// \tparam Args Types of the arguments to be forwarded to the broadphase.
+  /// \param args Arguments to be forwarded to the broadphase.
+  /// \return Reference to the newly set broadphase.
+  template <typename BroadphaseT, typename... Args> BroadphaseT& setBroadphase(Args&&... args);
 
   bool step(float deltaTime) override;
 
 private:
-  void solveConstraints();
+  struct ColliderEntry {
+    const Entity* entity {};
+    const Collider* collider {};
+    const Transform* transform {};
+    RigidBody* rigidBody {}; ///< Rigid body held by the same entity, if any, whether it is moving or sleeping.
+    std::size_t rigidBodyIndex = std::numeric_limits<std::size_t>::max(); ///< Index of the moving rigid body held by the same entity, if any.
+  };
+
+  struct RigidBodyEntry {
+    const Entity* entity {};
+    RigidBody* rigidBody {};
+    Transform* transform {};
+  };
+
+  struct Vec3Array {
+    std::vector<float> x {};
+    std::vector<float> y {};
+    std::vector<float> z {};
+  };
+
+  /// States of the moving rigid bodies, stored as a structure of arrays so that several of them can be integrated at once.
+  /// The index of each rigid body's state is the same as its entry's.
+  struct RigidBodyStates {
+    Vec3Array oldPositions {}; ///< Positions at the beginning of the step.
+    Vec3Array positions {};
+    Vec3Array velocities {};
+    Vec3Array forces {};
+    std::vector<float> masses {};
+    std::vector<float> invMasses {};
+  };
+
+  /// Contact between a rigid body & a collider. Rigid bodies being particles, a contact is made of a single point.
+  struct Contact {
+    std::size_t rigidBodyIndex {};
+    std::size_t colliderBodyIndex {}; ///< Index of the moving rigid body holding the collider, if any.
+    Vec3f normal {}; ///< Contact normal, pointing from the collider towards the rigid body.
+    float separation {}; ///< Distance between the rigid body & the collider's surface, negative if penetrating.
+    float targetVelocity {}; ///< Minimal relative velocity along the normal once the contact is solved.
+    float effectiveMass {};
+    float normalImpulse {}; ///< Impulse accumulated along the normal.
+    float bounceVelocity {}; ///< Relative velocity along the normal given once at the point of impact, if any.
+    bool hasImpact = false; ///< Whether the rigid body hits the collider during the step, either bouncing off or found by a continuous contact.
+    bool isActive = false; ///< Whether the rigid body can reach the collider during the step; inactive contacts are ignored. Before the
+                         ///<  contact is computed, tells whether its geometry is defined.
+  };
+
+  /// Contacts between rigid bodies & sphere colliders, stored as a structure of arrays so that several of them can be computed at once.
+  struct SphereContacts {
+    Vec3Array relativePositions {}; ///< Positions of the rigid bodies relative to the spheres' centers.
+    std::vector<float> radii {};
+    Vec3Array normals {};
+    std::vector<float> separations {};
+  };
+
+  /// Contact persisting from a step to the next, from which the solver is warm started.
+  struct ContactManifold {
+    std::pair<std::size_t, std::size_t> entityIds {}; ///< IDs of the rigid body's & of the collider's entities.
+    std::pair<uint32_t, uint32_t> entityGenerations {}; ///< Generations of the entities, whose IDs may be reused by others once removed.
+    Vec3f normal {};
+    float normalImpulse {};
+  };
+
+  /// Gathers the moving rigid bodies, copying their states from their components; the sleeping ones are left out.
+  void gatherRigidBodies();
+  /// Integrates the gathered rigid bodies' velocities over the given time, from the gravity & the forces applied to them.
+  /// \param deltaTime Time elapsed since the last step.
+  void integrateVelocities(float deltaTime);
+  /// Integrates the gathered rigid bodies' positions over the given time, from their solved velocities.
+  /// \param deltaTime Time elapsed since the last step.
+  void integratePositions(float deltaTime);
+  /// Copies back the integrated states into the rigid bodies' components; the transforms are only modified for the bodies having moved.
+  void applyRigidBodyStates();
+  /// Gathers the colliders, then finds through the broadphase which colliders each rigid body may reach during the step.
+  /// The candidate pairs are stored sorted by rigid body then collider, following the order in which they are listed.
+  /// \param deltaTime Time elapsed since the last step.
+  void computeCollisionCandidates(float deltaTime);
+  /// Partitions the moving rigid bodies into islands, the bodies colliding with another one's collider being in the same island.
+  /// The collision candidates are then reordered by island, keeping their relative order within each island.
+  void computeIslands();
+  /// Computes the contacts' geometry, that is their normal & separation, for all the collision candidates.
+  /// The candidates are grouped by their collider's shape type, each group being processed by a loop dedicated to this shape.
+  void computeContactGeometries();
+  /// Computes the contacts between the rigid bodies & the sphere colliders, several at once when SIMD instructions are available.
+  void computeSphereContactGeometries();
+  /// Finishes computing the contact corresponding to a collision candidate from its geometry, warm starting it from the persistent
+  ///   contact manifolds.
+  /// \param candidateIndex Index of the collision candidate.
+  /// \param invDeltaTime Inverse of the time elapsed since the last step.
+  void computeContact(std::size_t candidateIndex, float invDeltaTime);
+  /// Computes the contacts of all the rigid bodies of an island, then iteratively solves them with sequential impulses.
+  /// \param islandIndex Index of the island to be solved.
+  /// \param invDeltaTime Inverse of the time elapsed since the last step.
+  void solveIsland(std::size_t islandIndex, float invDeltaTime);
+  /// Applies an impulse along a contact's normal, changing the velocities of its rigid body & of the one holding its collider, if any.
+  /// \param contact Contact to apply the impulse to.
+  /// \param impulse Impulse to be applied.
+  void applyImpulse(const Contact& contact, float impulse);
+  /// Solves the contacts between the rigid bodies & the colliders, modifying the bodies' velocities so that they do not penetrate each other.
+  /// \param deltaTime Time elapsed since the last step.
+  void solveConstraints(float deltaTime);
+  /// Makes the rigid bodies having hit a collider during the step bounce off it.
+  /// This is done once their positions have been integrated, so that they end the step at the point of impact with their bounce velocity.
+  void applyImpactBounces();
+  /// Keeps the active contacts as manifolds, to warm start the solver on the next step; those of the sleeping rigid bodies are kept as well.
+  void storeContactManifolds();
+  /// Puts to sleep the moving rigid bodies having been at rest for long enough, then wakes up the sleeping ones whose collider has been hit,
+  ///   or whose support has moved or disappeared.
+  /// \param deltaTime Time elapsed since the last step.
+  void updateSleepStates(float deltaTime);
 
   Vec3f m_gravity  = Vec3f(0.f, -9.80665f, 0.f); ///< Gravity acceleration.
   float m_friction = 0.95f; ///< Friction coefficient.
+  float m_sleepVelocity = 0.2f; ///< Velocity below which a rigid body is considered at rest.
+  float m_sleepDelay = 0.5f; ///< Time during which a rigid body must remain at rest before being put to sleep.
+  std::size_t m_solverIterationCount = 8;
+  bool m_isWarmStartingEnabled = true;
+
+  View<RigidBody, Transform> m_rigidBodies {};
+  View<Collider, Transform> m_colliders {};
+
+  std::unique_ptr<Broadphase> m_broadphase = std::make_unique<SweepAndPruneBroadphase>();
+
+  // The following lists are kept to avoid reallocating them on each step
+  std::vector<ColliderEntry> m_colliderEntries {};
+  std::vector<RigidBodyEntry> m_rigidBodyEntries {};
+  std::vector<std::pair<RigidBody*, std::size_t>> m_entityRigidBodies {}; ///< Rigid body held by each entity & its index among the moving ones, by entity ID.
+  std::vector<std::size_t> m_entityColliderIndices {}; ///< Index of the collider held by each entity among the gathered ones, by entity ID.
+  std::vector<uint32_t> m_entityGenerations {}; ///< Generation of each entity holding a gathered rigid body or collider, by entity ID.
+  std::size_t m_sleepingRigidBodyCount = 0;
+  RigidBodyStates m_rigidBodyStates {};
+  std::vector<std::size_t> m_unboundedColliderIndices {}; ///< Colliders whose shape has no bounding box (planes), checked against every rigid body.
+  std::vector<std::size_t> m_boundedColliderIndices {}; ///< Collider of each of the first bounding boxes given to the broadphase.
+  std::vector<AABB> m_boundingBoxes {}; ///< Bounding boxes of the colliders, followed by those of the rigid bodies' movement during the step.
+  std::vector<BroadphasePair> m_broadphasePairs {};
+  std::vector<std::pair<std::size_t, std::size_t>> m_collisionCandidates {}; ///< Indices of the rigid bodies & of the colliders they may have hit.
+  std::vector<std::pair<std::size_t, std::size_t>> m_sortedCandidates {}; ///< Collision candidates being reordered by island.
+  std::vector<std::size_t> m_islandParents {}; ///< Parent of each rigid body in its island's tree, the root being the island's first rigid body.
+  std::vector<std::size_t> m_rigidBodyIslandIndices {};
+  std::vector<std::size_t> m_islandCandidateOffsets {}; ///< Index of the first collision candidate of each island, followed by the candidate count.
+  std::vector<Contact> m_contacts {}; ///< Contact corresponding to each collision candidate.
+  std::array<std::vector<std::size_t>, std::variant_size_v<ColliderShape>> m_shapeCandidateIndices {}; ///< Collision candidates, by collider shape type.
+  SphereContacts m_sphereContacts {};
+  std::vector<ContactManifold> m_contactManifolds {}; ///< Active contacts of the last step & of the sleeping rigid bodies, sorted by their entities' IDs.
 };
 
 } // namespace Raz
 
+#include "RaZ/Physics/PhysicsSystem.inl"
+
 #endif // RAZ_PHYSICSSYSTEM_HPP
@@ -0,0 +1,12 @@
+namespace Raz {
+
+template <typename BroadphaseT, typename... Args>
+BroadphaseT& PhysicsSystem::setBroadphase(Args&&... args) {
+  static_assert(std::is_base_of_v<Broadphase, BroadphaseT>, "Error: The broadphase must be derived from Broadphase.");
+  static_assert(!std::is_same_v<Broadphase, BroadphaseT>, "Error: The broadphase must not be of specific type 'Broadphase'.");
+
+  m_broadphase = std::make_unique<BroadphaseT>(std::forward<Args>(args)...);
+  return static_cast<BroadphaseT&>(*m_broadphase);
+}
+
+} // namespace Raz
@@ -22,11 +22,38 @@ public:
   constexpr float getBounciness() const noexcept { return m_bounciness; }
   constexpr const Vec3f& getForces() const noexcept { return m_forces; }
   constexpr const Vec3f& getVelocity() const noexcept { return m_velocity; }
+  /// Checks if the rigid body is sleeping, having been at rest for long enough; a sleeping rigid body is not simulated until woken up.
+  /// \see PhysicsSystem::setSleepVelocity(), PhysicsSystem::setSleepDelay()
+  /// \return True if the rigid body is sleeping, false otherwise.
+  constexpr bool isSleeping() const noexcept { return m_isSleeping; }
+  /// Checks if the rigid body's collisions are continuous, its exact time of impact with the colliders it may hit being then computed.
+  /// \return True if continuous collision detection is enabled, false otherwise.
+  constexpr bool isContinuousCollisionEnabled() const noexcept { return m_isContinuousCollisionEnabled; }
 
   void setMass(float mass) noexcept;
   void setBounciness(float bounciness) noexcept;
-  template <typename... Args> constexpr void setForces(const Args&... forces) noexcept { m_forces = (forces + ...); }
-  constexpr void setVelocity(const Vec3f& velocity) noexcept { m_velocity = velocity; }
+  /// Sets the additional forces applied to the rigid body, waking it up.
+  /// \tparam Args Types of the forces.
+  /// \param forces Forces to be applied, summed up.
+  template <typename... Args> constexpr void setForces(const Args&... forces) noexcept { m_forces = (forces + ...); wakeUp(); }
+  /// Sets the velocity of the rigid body, waking it up.
+  /// \param velocity New velocity.
+  constexpr void setVelocity(const Vec3f& velocity) noexcept { m_velocity = velocity; wakeUp(); }
+  /// Enables or disables continuous collision detection for the rigid body.
+  /// Its path during a step is then followed until hitting a sphere, AABB or OBB collider, instead of only checking the contact from where it
+  ///   started; a fast rigid body thus collides at the right place & does not hit the colliders it merely passes by. This is more expensive
+  ///   & should be reserved to fast-moving rigid bodies, such as projectiles, allowing to keep a lower physics step rate.
+  /// \param enabled True if continuous collision detection should be enabled, false otherwise.
+  constexpr void enableContinuousCollision(bool enabled = true) noexcept { m_isContinuousCollisionEnabled = enabled; }
+  constexpr void disableContinuousCollision() noexcept { enableContinuousCollision(false); }
+
+  /// Wakes up the rigid body, which will be simulated again.
+  /// A sleeping rigid body is automatically woken up when its forces or velocity are set, when another one hits its collider, or when a collider it
+  ///   rests on moves or is removed. It must however be woken up manually if moved by other means.
+  constexpr void wakeUp() noexcept {
+    m_isSleeping = false;
+    m_restingTime = 0.f;
+  }
 
 private:
   float m_mass {}; ///< Mass of the rigid body.
@@ -36,6 +63,10 @@ private:
   Vec3f m_forces {}; ///< Additional forces applied to the rigid body; gravity is computed independently later.
   Vec3f m_velocity {}; ///< Velocity of the rigid body.
   Vec3f m_oldPosition {}; ///< Previous position of the rigid body.
+
+  bool m_isContinuousCollisionEnabled = false;
+  bool m_isSleeping = false;
+  float m_restingTime {}; ///< Time during which the rigid body has been moving slower than the sleep velocity.
 };
 
 } // namespace Raz
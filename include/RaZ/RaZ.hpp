@@ -4,14 +4,20 @@
 #define RAZ_RAZ_HPP
 
 #include "Application.hpp"
+#include "CommandBuffer.hpp"
 #include "Component.hpp"
+#include "ComponentStorage.hpp"
 #include "Entity.hpp"
+#include "FrameTimeInfo.hpp"
 #include "System.hpp"
+#include "View.hpp"
 #include "World.hpp"
 #include "Animation/Skeleton.hpp"
 #include "Audio/AudioSystem.hpp"
 #include "Audio/Listener.hpp"
 #include "Audio/Sound.hpp"
+#include "Data/AssetCache.hpp"
+#include "Data/AssetManager.hpp"
 #include "Data/Bitset.hpp"
 #include "Data/BvhFormat.hpp"
 #include "Data/BvhSystem.hpp"
@@ -24,6 +30,7 @@
 #include "Data/MeshFormat.hpp"
 #include "Data/ObjFormat.hpp"
 #include "Data/OffFormat.hpp"
+#include "Data/PagedPool.hpp"
 #include "Data/PngFormat.hpp"
 #include "Data/Submesh.hpp"
 #include "Data/TgaFormat.hpp"
@@ -35,6 +42,7 @@
 #include "Math/Quaternion.hpp"
 #include "Math/Transform.hpp"
 #include "Math/Vector.hpp"
+#include "Physics/Broadphase.hpp"
 #include "Physics/Collider.hpp"
 #include "Physics/PhysicsSystem.hpp"
 #include "Physics/RigidBody.hpp"
@@ -53,6 +61,7 @@
 #include "Render/Overlay.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/RenderGraph.hpp"
+#include "Render/RenderPacket.hpp"
 #include "Render/RenderPass.hpp"
 #include "Render/RenderProcess.hpp"
 #include "Render/RenderSystem.hpp"
@@ -61,6 +70,7 @@
 #include "Render/SubmeshRenderer.hpp"
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
+#include "Render/UploadQueue.hpp"
 #include "Render/Window.hpp"
 #include "Utils/CompilerUtils.hpp"
 #include "Utils/EnumUtils.hpp"
@@ -68,6 +78,7 @@
 #include "Utils/FileUtils.hpp"
 #include "Utils/FloatUtils.hpp"
 #include "Utils/Input.hpp"
+#include "Utils/JobSystem.hpp"
 #include "Utils/Logger.hpp"
 #include "Utils/Plugin.hpp"
 #include "Utils/Ray.hpp"
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef RAZ_RENDERPACKET_HPP
+#define RAZ_RENDERPACKET_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <vector>
+
+namespace Raz {
+
+class MeshRenderer;
+
+/// Rendering state of a frame, captured from the entities so that it can be rendered without accessing them.
+/// \see RenderSystem::captureFrame(), World::enableFramePipelining()
+struct RenderPacket {
+  struct MeshInstance {
+    const MeshRenderer* meshRenderer {}; ///< Mesh renderer to be drawn; its materials are referred to, their attributes being sent only when updated.
+    Mat4f transformMatrix = Mat4f::identity();
+  };
+
+  struct LightData {
+    Vec4f position {}; ///< Position of the light, whose last component is 0 for a directional light & 1 otherwise.
+    Vec3f direction {};
+    Vec3f color {};
+    float energy {};
+    float angle {}; ///< Angle of the light, in radians.
+  };
+
+  Mat4f viewMatrix = Mat4f::identity();
+  Mat4f inverseViewMatrix = Mat4f::identity();
+  Mat4f projectionMatrix = Mat4f::identity();
+  Mat4f inverseProjectionMatrix = Mat4f::identity();
+  Vec3f cameraPosition {};
+  std::vector<MeshInstance> meshInstances {}; ///< Enabled mesh renderers, along with their entities' transformation.
+  std::vector<LightData> lights {}; ///< Lights of the enabled entities.
+};
+
+} // namespace Raz
+
+#endif // RAZ_RENDERPACKET_HPP
@@ -5,16 +5,20 @@
 
 #include "RaZ/System.hpp"
 #include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Transform.hpp"
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Render/Cubemap.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Render/MeshRenderer.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
+#include "RaZ/Render/RenderPacket.hpp"
 #include "RaZ/Render/UniformBuffer.hpp"
+#include "RaZ/Render/UploadQueue.hpp"
 #include "RaZ/Render/Window.hpp"
 
 namespace Raz {
 
 class Entity;
-class MeshRenderer;
 
 /// RenderSystem class, handling the rendering part.
 class RenderSystem final : public System {
@@ -50,15 +54,27 @@ public:
   RenderPass& getGeometryPass() { return m_renderGraph.getGeometryPass(); }
   const RenderGraph& getRenderGraph() const { return m_renderGraph; }
   RenderGraph& getRenderGraph() { return m_renderGraph; }
+  const UploadQueue& getUploadQueue() const { return m_uploadQueue; }
+  UploadQueue& getUploadQueue() { return m_uploadQueue; }
+  float getUploadTimeBudget() const { return m_uploadTimeBudget; }
+  /// Gets the state of the last captured frame, which is the one rendered by the last update.
+  const RenderPacket& getRenderPacket() const { return m_renderPacket; }
   bool hasCubemap() const { return m_cubemap.has_value(); }
   const Cubemap& getCubemap() const { assert("Error: The cubemap must be set before being accessed." && hasCubemap()); return *m_cubemap; }
 
   void setCubemap(Cubemap&& cubemap);
+  /// Sets the time allowed each frame to execute the pending uploads (see getUploadQueue()), which are otherwise left for the next frames.
+  /// \param uploadTimeBudget Upload time per frame, in seconds. At least one upload is always executed if any is pending.
+  void setUploadTimeBudget(float uploadTimeBudget) { m_uploadTimeBudget = uploadTimeBudget; }
 
 #if !defined(RAZ_NO_WINDOW)
   void createWindow(unsigned int width, unsigned int height, const std::string& title = "") { m_window = Window::create(*this, width, height, title); }
 #endif
   void resizeViewport(unsigned int width, unsigned int height);
+  /// Captures the camera, the enabled mesh renderers along with their transformation, and the lights, so that the frame can then be rendered
+  ///   while the entities are being modified.
+  /// If not already done by the world (see World::enableFramePipelining()), it is automatically called at the beginning of each update.
+  void captureFrame() override;
   bool update(float deltaTime) override;
   void sendViewMatrix(const Mat4f& viewMat) const { m_cameraUbo.sendData(viewMat, 0); }
   void sendInverseViewMatrix(const Mat4f& invViewMat) const { m_cameraUbo.sendData(invViewMat, sizeof(Mat4f)); }
@@ -87,11 +103,20 @@ public:
   void destroy() override;
 
 protected:
-  void linkEntity(const EntityPtr& entity) override;
+  void linkEntity(Entity& entity) override;
 
 private:
   void initialize();
   void initialize(unsigned int sceneWidth, unsigned int sceneHeight);
+  /// Computes the data to be sent to the GPU for the given light.
+  /// \param entity Light entity; if not a directional light, needs to have a Transform component.
+  /// \return Light's data.
+  static RenderPacket::LightData computeLightData(const Entity& entity);
+  /// Sends a single light's data to the GPU.
+  /// \warning The lights UBO needs to be bound before calling this function.
+  /// \param lightData Data of the light to be sent.
+  /// \param lightIndex Index of the light to be updated.
+  void sendLight(const RenderPacket::LightData& lightData, unsigned int lightIndex) const;
 
   unsigned int m_sceneWidth {};
   unsigned int m_sceneHeight {};
@@ -101,12 +126,20 @@ private:
 #endif
 
   Entity* m_cameraEntity {};
+  View<MeshRenderer, Transform> m_meshRenderers {};
+  View<Light> m_lights {};
   RenderGraph m_renderGraph {};
   UniformBuffer m_cameraUbo = UniformBuffer(sizeof(Mat4f) * 5 + sizeof(Vec4f), UniformBufferUsage::DYNAMIC);
   UniformBuffer m_lightsUbo = UniformBuffer(sizeof(Vec4f) * 4 * 100 + sizeof(Vec4u), UniformBufferUsage::DYNAMIC);
   UniformBuffer m_modelUbo  = UniformBuffer(sizeof(Mat4f), UniformBufferUsage::STREAM);
 
   std::optional<Cubemap> m_cubemap {};
+
+  RenderPacket m_renderPacket {};
+  bool m_isFrameCaptured = false; ///< Whether the frame to be rendered has already been captured, which is the case if the world pipelines its frames.
+
+  UploadQueue m_uploadQueue {};
+  float m_uploadTimeBudget = 0.002f;
 };
 
 } // namespace Raz
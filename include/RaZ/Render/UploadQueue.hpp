@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef RAZ_UPLOADQUEUE_HPP
+#define RAZ_UPLOADQUEUE_HPP
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace Raz {
+
+/// UploadQueue class, holding operations to be executed on the thread owning the graphics context.
+/// Graphics objects (textures, buffers, ...) can only be created on that thread; data loaded & decoded on other threads can thus add here
+///   the operations sending them to the GPU. These are then executed in the order they have been added, a few at a time so that they are
+///   spread over several frames instead of causing a single long one.
+/// \see RenderSystem::getUploadQueue()
+class UploadQueue {
+public:
+  UploadQueue() = default;
+  UploadQueue(const UploadQueue&) = delete;
+  UploadQueue(UploadQueue&&) noexcept = delete;
+
+  std::size_t getPendingUploadCount() const { std::lock_guard<std::mutex> lock(m_uploadsMutex); return m_uploads.size(); }
+  bool isEmpty() const { return (getPendingUploadCount() == 0); }
+
+  /// Adds an upload to be executed on the thread owning the graphics context. Can be called from any thread.
+  /// \tparam FuncT Type of the upload operation.
+  /// \tparam ResultT Return type of the upload operation.
+  /// \param upload Upload operation to be executed.
+  /// \return A std::future holding the future result of the upload, or the exception it has thrown.
+  template <typename FuncT, typename ResultT = std::invoke_result_t<std::decay_t<FuncT>&>>
+  std::future<ResultT> push(FuncT&& upload) {
+    auto task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<FuncT>(upload));
+    std::future<ResultT> result = task->get_future();
+
+    std::lock_guard<std::mutex> lock(m_uploadsMutex);
+    m_uploads.emplace_back([task = std::move(task)] () { (*task)(); });
+
+    return result;
+  }
+  /// Executes the pending uploads in order, until the given time budget is exceeded. At least one upload is executed if any is pending, so that
+  ///   the queue always progresses even if a single upload exceeds the budget.
+  /// \note This must be called on the thread owning the graphics context.
+  /// \param timeBudget Time in seconds after which no other upload is executed.
+  /// \return Number of uploads executed.
+  std::size_t execute(float timeBudget);
+  /// Executes all the pending uploads, including those added while executing them.
+  /// \note This must be called on the thread owning the graphics context.
+  /// \return Number of uploads executed.
+  std::size_t executeAll();
+  /// Removes all the pending uploads without executing them. Their futures will hold a std::future_error exception.
+  void clear();
+
+  UploadQueue& operator=(const UploadQueue&) = delete;
+  UploadQueue& operator=(UploadQueue&&) noexcept = delete;
+
+private:
+  /// Takes the next pending upload, if any.
+  /// \param upload Taken upload.
+  /// \return True if an upload has been taken, false if none was pending.
+  bool takeUpload(std::function<void()>& upload);
+
+  mutable std::mutex m_uploadsMutex {};
+  std::deque<std::function<void()>> m_uploads {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_UPLOADQUEUE_HPP
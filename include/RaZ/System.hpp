@@ -4,8 +4,10 @@
 #define RAZ_SYSTEM_HPP
 
 #include "RaZ/Entity.hpp"
+#include "RaZ/View.hpp"
 #include "RaZ/Data/Bitset.hpp"
 
+#include <unordered_map>
 #include <vector>
 
 namespace Raz {
@@ -22,6 +24,26 @@ public:
   System(System&&) noexcept = delete;
 
   const Bitset& getAcceptedComponents() const { return m_acceptedComponents; }
+  const Bitset& getReadComponents() const { return m_readComponents; }
+  const Bitset& getWrittenComponents() const { return m_writtenComponents; }
+  /// Checks if the system has declared which components it reads and writes.
+  /// A system which has not is considered to possibly access any component, and can thus never be updated concurrently with another.
+  /// \return True if the system's component accesses are declared, false otherwise.
+  bool hasDeclaredAccesses() const noexcept { return m_hasDeclaredAccesses; }
+  /// Checks if the system must be updated on the main thread, for example because it uses a graphics context.
+  /// \return True if the system must be updated on the main thread, false otherwise.
+  bool requiresMainThread() const noexcept { return m_requiresMainThread; }
+  /// Gets the system's own fixed step time.
+  /// \return Time of a fixed step in seconds, or 0 if the system uses the default one given by the world's update.
+  float getStepTime() const noexcept { return m_stepTime; }
+  /// Gets the progress between the last fixed step executed by the system & the next one, as of its last update.
+  /// This allows for example to interpolate between the last two simulated states when rendering.
+  /// \return Interpolation factor, between 0 & 1.
+  float getInterpolationAlpha() const noexcept { return m_interpolationAlpha; }
+
+  /// Sets the number of fixed steps per second the system must execute, independently of the default step rate.
+  /// \param stepRate Number of fixed steps per second; 0 to use the default step time.
+  void setStepRate(float stepRate);
 
   /// Gets the ID of the given system type.
   /// It uses CRTP to assign a different ID to each system type it is called with.
@@ -30,6 +52,11 @@ public:
   /// \tparam SysT Type of the system to get the ID of.
   /// \return Given system's ID.
   template <typename SysT> static std::size_t getId();
+  /// Checks if the system may conflict with another one, in which case they must not be updated concurrently.
+  /// Two systems conflict if either of them has not declared its component accesses, or if one writes a component the other reads or writes.
+  /// \param system System to be checked.
+  /// \return True if both systems conflict, false otherwise.
+  bool conflictsWith(const System& system) const;
   /// Checks if the system contains the given entity.
   /// \param entity Entity to be checked.
   /// \return True if the system contains the entity, false otherwise.
@@ -42,6 +69,10 @@ public:
   /// \param deltaTime Step time elapsed since the last update.
   /// \return True if the system is still active, false otherwise.
   virtual bool step([[maybe_unused]] float deltaTime) { return true; }
+  /// Captures the state of the entities the system needs, so that it can then be updated without accessing them.
+  /// This is only called by a world whose frame pipelining is enabled (see World::enableFramePipelining()), on systems requiring the main thread,
+  ///   once the previous frame's simulation is finished & before the next one starts.
+  virtual void captureFrame() {}
   /// Destroys the system.
   virtual void destroy() {}
 
@@ -59,17 +90,44 @@ protected:
   /// Removes the given component types as accepted by the current system.
   /// \tparam CompTs Types of the components to deny.
   template <typename... CompTs> void unregisterComponents() { (m_acceptedComponents.setBit(Component::getId<CompTs>(), false), ...); }
+  /// Declares the given component types as being read by the current system.
+  /// \tparam CompTs Types of the components which are read.
+  template <typename... CompTs> void registerReadComponents() { (m_readComponents.setBit(Component::getId<CompTs>()), ...); m_hasDeclaredAccesses = true; }
+  /// Declares the given component types as being written by the current system. A written component doesn't need to also be declared as read.
+  /// \tparam CompTs Types of the components which are written.
+  template <typename... CompTs> void registerWrittenComponents() { (m_writtenComponents.setBit(Component::getId<CompTs>()), ...); m_hasDeclaredAccesses = true; }
+  /// Registers views to be kept up to date by the world the system is added to.
+  /// \tparam ViewTs Types of the views to be registered.
+  /// \param views Views to be registered. They must remain valid during the system's whole lifetime, hence usually being members of it.
+  template <typename... ViewTs> void registerViews(ViewTs&... views) { (m_views.emplace_back(&views), ...); }
+  /// Forces the system to be updated on the main thread.
+  void requireMainThread() noexcept { m_requiresMainThread = true; }
   /// Links the entity to the system.
   /// \param entity Entity to be linked.
-  virtual void linkEntity(const EntityPtr& entity);
+  virtual void linkEntity(Entity& entity);
   /// Unlinks the entity from the system.
   /// \param entity Entity to be unlinked.
-  virtual void unlinkEntity(const EntityPtr& entity);
+  virtual void unlinkEntity(Entity& entity);
+  /// Called once entities have been linked to or unlinked from the system, after all of those of a same refresh have been.
+  /// This allows processing the changes in bulk, instead of each time an entity is linked or unlinked.
+  virtual void onLinkedEntitiesChanged() {}
 
   std::vector<Entity*> m_entities {};
   Bitset m_acceptedComponents {};
 
 private:
+  Bitset m_readComponents {};
+  Bitset m_writtenComponents {};
+  bool m_hasDeclaredAccesses = false;
+  bool m_requiresMainThread = false;
+  std::vector<ViewBase*> m_views {};
+
+  float m_stepTime {}; ///< Time of the system's own fixed step, or 0 if using the default one.
+  float m_remainingStepTime {}; ///< Extra time remaining after executing the system's own fixed steps.
+  float m_interpolationAlpha {};
+
+  std::unordered_map<std::size_t, std::size_t> m_entityIndices {}; ///< Position in the list of each linked entity, indexed by their ID.
+
   static inline std::size_t m_maxId = 0;
 };
 
@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef RAZ_JOBSYSTEM_HPP
+#define RAZ_JOBSYSTEM_HPP
+
+#include "RaZ/Utils/Threading.hpp"
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Raz {
+
+class JobSystem;
+
+/// Handle to a job added to a JobSystem, allowing to wait for it or to make other jobs depend on it.
+/// A job is finished once its action has been executed and all its children are finished.
+class JobHandle {
+  friend JobSystem;
+
+public:
+  JobHandle() = default;
+
+  bool isValid() const noexcept { return (m_job != nullptr); }
+  bool isFinished() const noexcept { return (m_job == nullptr || m_job->isFinished.load(std::memory_order_acquire)); }
+
+private:
+  struct Job {
+    ThreadPool::Action action {};
+    std::shared_ptr<Job> parent {};
+
+    std::atomic<uint32_t> remainingDependencyCount = 1; ///< Dependencies not yet finished; one more is held while the job is being added.
+    std::atomic<uint32_t> unfinishedCount = 1; ///< Whether the job's own action has not yet been executed, plus the number of its unfinished children.
+    std::atomic<bool> isFinished = false;
+
+    std::mutex mutex {};
+    std::vector<std::shared_ptr<Job>> dependents {}; ///< Jobs waiting for this one to be finished.
+    std::exception_ptr exception {}; ///< First exception thrown by the job's action or by any of its children.
+  };
+
+  explicit JobHandle(std::shared_ptr<Job> job) noexcept : m_job{ std::move(job) } {}
+
+  std::shared_ptr<Job> m_job {};
+};
+
+/// JobSystem class, executing jobs on a thread pool while respecting the dependencies between them.
+/// Jobs can depend on others, which must be finished for them to be started; they can also spawn child jobs, their parent being considered
+///   finished only once all of them are. This allows to express a whole frame as a graph of jobs, executed with as much overlap as possible.
+/// \note If using Emscripten, the jobs are executed synchronously as soon as their dependencies are finished, threads being unsupported with it for now.
+class JobSystem {
+public:
+  JobSystem() : JobSystem(Threading::getDefaultThreadPool()) {}
+  explicit JobSystem(ThreadPool& threadPool) noexcept : m_threadPool{ threadPool } {}
+  JobSystem(const JobSystem&) = delete;
+  JobSystem(JobSystem&&) noexcept = delete;
+
+  /// Gets the job being executed by the calling thread.
+  /// \return Handle to the current job, or an invalid one if the calling thread is not executing any job.
+  static JobHandle getCurrentJob();
+
+  /// Adds a job, to be executed once all the given dependencies are finished.
+  /// \param action Action to be executed.
+  /// \param dependencies Jobs which must be finished before the action can be executed.
+  /// \return Handle to the added job.
+  JobHandle addJob(ThreadPool::Action action, std::initializer_list<JobHandle> dependencies = {}) {
+    return addJob(std::move(action), dependencies.begin(), dependencies.end(), JobHandle());
+  }
+  /// Adds a job, to be executed once all the given dependencies are finished.
+  /// \param action Action to be executed.
+  /// \param dependencies Jobs which must be finished before the action can be executed.
+  /// \return Handle to the added job.
+  JobHandle addJob(ThreadPool::Action action, const std::vector<JobHandle>& dependencies) {
+    return addJob(std::move(action), dependencies.data(), dependencies.data() + dependencies.size(), JobHandle());
+  }
+  /// Adds a child job to the given one, which will not be considered finished until the child is.
+  /// \param parent Parent of the job to be added. Must not be finished yet; the child is thus usually added from the parent's action.
+  /// \param action Action to be executed.
+  /// \param dependencies Jobs which must be finished before the action can be executed.
+  /// \return Handle to the added job.
+  JobHandle addChildJob(const JobHandle& parent, ThreadPool::Action action, std::initializer_list<JobHandle> dependencies = {}) {
+    return addJob(std::move(action), dependencies.begin(), dependencies.end(), parent);
+  }
+  /// Adds a job to be executed once the given one is finished.
+  /// \param job Job to be continued.
+  /// \param action Action to be executed.
+  /// \return Handle to the added job.
+  JobHandle addContinuation(const JobHandle& job, ThreadPool::Action action) { return addJob(std::move(action), { job }); }
+  /// Waits for the given job to be finished, helping executing the pending jobs meanwhile.
+  /// If an exception has been thrown by the job or any of its children, it is rethrown; the jobs depending on it are executed nonetheless.
+  /// \param job Job to wait for.
+  void wait(const JobHandle& job);
+  /// Waits for all the given jobs to be finished, helping executing the pending jobs meanwhile.
+  /// \param jobs Jobs to wait for.
+  void wait(std::initializer_list<JobHandle> jobs);
+
+  JobSystem& operator=(const JobSystem&) = delete;
+  JobSystem& operator=(JobSystem&&) noexcept = delete;
+
+  /// Destroys the job system, waiting for all the added jobs & their continuations to be finished, helping executing them meanwhile.
+  ~JobSystem();
+
+private:
+  JobHandle addJob(ThreadPool::Action action, const JobHandle* dependenciesBegin, const JobHandle* dependenciesEnd, const JobHandle& parent);
+  /// Releases one of the dependencies of the given job, which is scheduled if it was the last one.
+  /// \param job Job whose dependency is to be released.
+  void releaseDependency(const JobHandle& job);
+  /// Executes the given job's action, then finishes it if it has no unfinished child.
+  /// \param job Job to be executed.
+  void executeJob(const JobHandle& job);
+  /// Marks a part of the given job (its own action or one of its children) as finished. If it was the last one, the job becomes finished,
+  ///   releasing its dependents and finishing the corresponding part of its parent.
+  /// \param job Job to be finished.
+  void finishJob(const JobHandle& job);
+
+  ThreadPool& m_threadPool;
+  std::atomic<std::size_t> m_unfinishedJobCount = 0; ///< Jobs added but not yet finished, which may thus still access the job system.
+};
+
+} // namespace Raz
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_JOBSYSTEM_HPP
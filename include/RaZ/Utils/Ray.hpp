@@ -41,13 +41,13 @@ public:
   /// \param hit Ray intersection's information to recover.
   /// \return True if the ray intersects the point, false otherwise.
   bool intersects(const Vec3f& point, RayHit* hit = nullptr) const;
-  /*
   /// Ray-line intersection check.
+  /// The intersection is checked by finding the closest points between the ray & the line, which must be the same.
   /// \param line Line to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
+  /// \note A line having no surface, the hit normal is the opposite of the ray's direction, as for a point.
   /// \return True if the ray intersects the line, false otherwise.
   bool intersects(const Line& line, RayHit* hit = nullptr) const;
-  */
   /// Ray-plane intersection check.
   /// \param plane Plane to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
@@ -66,26 +66,26 @@ public:
   /// \note The hit normal will always be oriented towards the ray.
   /// \return True if the ray intersects the triangle, false otherwise.
   bool intersects(const Triangle& triangle, RayHit* hit = nullptr) const;
-  /*
   /// Ray-quad intersection check.
-  /// \param quad Quad to check if there is an intersection with.
+  /// The intersection is checked by finding the hit point on the quad's plane, which must then be inside all of its edges.
+  /// \param quad Quad to check if there is an intersection with; it is assumed to be planar & convex.
   /// \param hit Ray intersection's information to recover.
+  /// \note The hit normal will always be oriented towards the ray.
   /// \return True if the ray intersects the quad, false otherwise.
   bool intersects(const Quad& quad, RayHit* hit = nullptr) const;
-  */
   /// Ray-AABB intersection check.
   /// \param aabb AABB to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
   /// \note If returns true with a negative hit distance, the ray is located inside the box & the hit position is the intersection point found behind the ray.
   /// \return True if the ray intersects the AABB, false otherwise.
   bool intersects(const AABB& aabb, RayHit* hit = nullptr) const;
-  /*
   /// Ray-OBB intersection check.
+  /// The ray is brought into the box's local space, in which the intersection is checked as with an AABB.
   /// \param obb OBB to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
+  /// \note If returns true with a negative hit distance, the ray is located inside the box & the hit position is the intersection point found behind the ray.
   /// \return True if the ray intersects the OBB, false otherwise.
   bool intersects(const OBB& obb, RayHit* hit = nullptr) const;
-  */
   /// Computes the projection of a point (closest point) onto the ray.
   /// The projected point is necessarily located between the ray's origin and towards infinity in the ray's direction.
   /// \param point Point to compute the projection from.
@@ -28,6 +28,14 @@ enum class ShapeType {
   OBB
 };
 
+/// Contact between two convex shapes, as computed by Shape::computeContact().
+struct ShapeContact {
+  Vec3f normal {}; ///< Contact normal, pointing from the second shape towards the first one.
+  float separation {}; ///< Distance between both shapes, negative if they penetrate each other; its opposite is then the penetration depth.
+  Vec3f firstPoint {}; ///< Point of the first shape closest to the second one, or the deepest into it if they penetrate each other.
+  Vec3f secondPoint {}; ///< Point of the second shape closest to the first one, or the deepest into it if they penetrate each other.
+};
+
 class Shape {
 public:
   Shape(const Shape&) = default;
@@ -81,12 +89,24 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
   virtual Vec3f computeProjection(const Vec3f& point) const = 0;
+  /// Computes the support point of the shape in a given direction, which is its farthest point along this direction.
+  /// \param direction Direction in which to find the support point; does not need to be normalized.
+  /// \return Shape's support point.
+  virtual Vec3f computeSupport(const Vec3f& direction) const = 0;
   /// Computes the shape's centroid.
   /// \return Computed centroid.
   virtual Vec3f computeCentroid() const = 0;
   /// Computes the shape's bounding box.
   /// \return Computed bounding box.
   virtual AABB computeBoundingBox() const = 0;
+  /// Computes the contact between the shape & another one, both having to be convex & bounded.
+  /// The distance & closest points are found with the GJK algorithm; if the shapes intersect each other, the penetration depth & deepest
+  ///   points are then found with the EPA. Both only rely on the shapes' support points, thus working with any pair of shapes.
+  /// \see computeSupport()
+  /// \param shape Shape to compute the contact with.
+  /// \param contact Contact between both shapes, the current one being the first.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool computeContact(const Shape& shape, ShapeContact& contact) const;
 
   Shape& operator=(const Shape&) = default;
   Shape& operator=(Shape&&) noexcept = default;
@@ -142,7 +162,7 @@ public:
   /// \param ray Ray to check if there is an intersection with.
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return True if the ray intersects the line, false otherwise.
-  bool intersects(const Ray&, RayHit*) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool intersects(const Ray& ray, RayHit* hit) const override { return ray.intersects(*this, hit); }
   /// Translates the line by the given vector.
   /// \param displacement Displacement to be translated by.
   void translate(const Vec3f& displacement) noexcept override;
@@ -151,6 +171,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the line.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the support point of the line in a given direction, which is the extremity the farthest along it.
+  /// \param direction Direction in which to find the support point.
+  /// \return Line's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override { return (m_beginPos.dot(direction) >= m_endPos.dot(direction) ? m_beginPos : m_endPos); }
   /// Computes the line's centroid, which is the point lying directly between the two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_beginPos + m_endPos) * 0.5f; }
@@ -238,6 +262,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the plane.
   Vec3f computeProjection(const Vec3f& point) const override { return point - m_normal * (m_normal.dot(point) - m_distance); }
+  /// Computes the support point of the plane in a given direction.
+  /// A plane being infinite, it has no support point; this function always throws.
+  /// \return Nothing, as an exception is always thrown.
+  Vec3f computeSupport(const Vec3f&) const override { throw std::invalid_argument("Error: A plane, being infinite, has no support point."); }
   /// Computes the plane's centroid, which is the point lying onto the plane at its distance from the center in its normal direction.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_normal * m_distance; }
@@ -314,6 +342,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto/into the sphere.
   Vec3f computeProjection(const Vec3f& point) const override { return (point - m_centerPos).normalize() * m_radius + m_centerPos; }
+  /// Computes the support point of the sphere in a given direction, which is the point of its surface in this direction.
+  /// \param direction Direction in which to find the support point; if null, the sphere's center is returned.
+  /// \return Sphere's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override;
   /// Computes the sphere's centroid, which is its center. Strictly equivalent to getCenterPos().
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_centerPos; }
@@ -392,6 +424,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the triangle.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the support point of the triangle in a given direction, which is its vertex the farthest along it.
+  /// \param direction Direction in which to find the support point.
+  /// \return Triangle's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override;
   /// Computes the triangle's centroid, which is the point lying directly between its three points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_firstPos + m_secondPos + m_thirdPos) / 3.f; }
@@ -441,7 +477,7 @@ public:
   /// Point containment check.
   /// \param point Point to be checked.
   /// \return True if the point is located on the quad, false otherwise.
-  bool contains(const Vec3f&) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool contains(const Vec3f& point) const override { return (computeProjection(point) == point); }
   /// Quad-line intersection check.
   /// \param line Line to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
@@ -474,7 +510,7 @@ public:
   /// \param ray Ray to check if there is an intersection with.
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return True if the ray intersects the quad, false otherwise.
-  bool intersects(const Ray&, RayHit*) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool intersects(const Ray& ray, RayHit* hit) const override { return ray.intersects(*this, hit); }
   /// Translates the quad by the given vector.
   /// \param displacement Displacement to be translated by.
   void translate(const Vec3f& displacement) noexcept override;
@@ -483,6 +519,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the quad.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the support point of the quad in a given direction, which is its vertex the farthest along it.
+  /// \param direction Direction in which to find the support point.
+  /// \return Quad's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override;
   /// Computes the quad's centroid, which is the point lying directly between its four points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_leftTopPos + m_rightTopPos + m_rightBottomPos + m_leftBottomPos) * 0.25f; }
@@ -577,6 +617,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the support point of the AABB in a given direction, which is its corner the farthest along it.
+  /// \param direction Direction in which to find the support point.
+  /// \return AABB's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override;
   /// Computes the AABB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_maxPos + m_minPos) * 0.5f; }
@@ -696,7 +740,7 @@ public:
   /// \param ray Ray to check if there is an intersection with.
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return True if the ray intersects the OBB, false otherwise.
-  bool intersects(const Ray&, RayHit*) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool intersects(const Ray& ray, RayHit* hit) const override { return ray.intersects(*this, hit); }
   /// Translates the OBB by the given vector.
   /// \param displacement Displacement to be translated by.
   void translate(const Vec3f& displacement) noexcept override { m_aabb.translate(displacement); }
@@ -705,6 +749,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the support point of the OBB in a given direction, which is its corner the farthest along it.
+  /// \param direction Direction in which to find the support point.
+  /// \return OBB's support point.
+  Vec3f computeSupport(const Vec3f& direction) const override;
   /// Computes the OBB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_aabb.computeCentroid(); }
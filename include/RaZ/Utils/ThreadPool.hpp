@@ -15,33 +15,162 @@
 
 #if defined(RAZ_THREADS_AVAILABLE)
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <type_traits>
+#include <vector>
 
 namespace Raz {
 
+/// Work-stealing thread pool.
+/// Each worker thread owns a lock-free queue of actions; the actions added from a worker are pushed into its own queue, while those added
+///   from any other thread are distributed among the workers. A worker having no action left takes those of the others.
+/// Each action is executed with the context of the thread which has added it (see setCurrentContext()), whichever thread executes it.
 class ThreadPool {
 public:
+  /// Callable to be executed by the pool. Small enough callables are stored inline, avoiding any allocation.
+  class Action {
+    friend ThreadPool;
+
+  public:
+    Action() = default;
+    template <typename FuncT, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncT>, Action>>>
+    Action(FuncT&& action); // Voluntarily implicit, so that any callable can be given where an action is expected
+    Action(const Action&) = delete;
+    Action(Action&& action) noexcept { *this = std::move(action); }
+
+    bool isEmpty() const noexcept { return (m_operations == nullptr); }
+
+    Action& operator=(const Action&) = delete;
+    Action& operator=(Action&& action) noexcept;
+    void operator()() { m_operations->invoke(m_storage); }
+
+    ~Action() { reset(); }
+
+  private:
+    struct Operations {
+      void (*invoke)(void*);
+      void (*move)(void*, void*) noexcept; ///< Moves the callable from the second storage into the first one.
+      void (*destroy)(void*) noexcept;
+    };
+
+    static constexpr std::size_t inlineSize = 48;
+
+    template <typename FuncT> static constexpr bool isStoredInline = (sizeof(FuncT) <= inlineSize && alignof(FuncT) <= alignof(std::max_align_t)
+                                                                      && std::is_nothrow_move_constructible_v<FuncT>);
+    template <typename FuncT> static const Operations inlineOperations;
+    template <typename FuncT> static const Operations heapOperations;
+
+    void reset() noexcept;
+
+    alignas(std::max_align_t) unsigned char m_storage[inlineSize] {};
+    const Operations* m_operations {};
+    const void* m_context {}; ///< Context of the thread which has added the action to the pool.
+  };
+
   ThreadPool();
   explicit ThreadPool(unsigned int threadCount);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) noexcept = delete;
+
+  unsigned int getThreadCount() const noexcept { return static_cast<unsigned int>(m_workers.size()); }
+  /// Gets the calling thread's context, which is the one of the action being executed if any.
+  /// \return Calling thread's context, or nullptr if none has been set.
+  static const void* getCurrentContext() noexcept;
 
-  void addAction(std::function<void()> action);
+  /// Sets the calling thread's context. The actions added to any pool afterward will be executed with it, even if taken by another thread.
+  /// This allows state bound to a task to follow the actions it creates, such as the system a world is updating.
+  /// \param context Context to be set; may be nullptr.
+  static void setCurrentContext(const void* context) noexcept;
+
+  /// Adds an action to be executed by one of the pool's threads.
+  /// \param action Action to be executed.
+  void addAction(Action action);
+  /// Executes one of the pending actions on the calling thread, if any.
+  /// \return True if an action has been executed, false if there was none to execute.
+  bool executePendingAction();
+  /// Executes the pending actions on the calling thread until the given condition is satisfied.
+  /// This is meant to be used instead of blocking while waiting for actions added to the pool: the calling thread helps executing them,
+  ///   which also avoids worker threads waiting for actions that no other thread is available to execute.
+  /// \tparam CondT Type of the condition to be checked.
+  /// \param condition Condition to be checked before executing each action, returning true when the waiting should stop.
+  template <typename CondT> void executeUntil(CondT&& condition);
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) noexcept = delete;
 
   ~ThreadPool();
 
 private:
+  static constexpr std::size_t dequeCapacity = 1024;
+
+  /// Fixed-size lock-free double-ended queue, in which only its owner can push & pop at the bottom, while any thread can steal from the top.
+  /// See "Dynamic Circular Work-Stealing Deque" (Chase & Lev, 2005) and "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+  class ActionDeque {
+  public:
+    /// Pushes an action at the bottom of the deque. Must only be called by the deque's owner.
+    /// \param action Action to be pushed.
+    /// \return True if the action has been pushed, false if the deque is full.
+    bool push(Action* action) noexcept;
+    /// Pops the most recently pushed action. Must only be called by the deque's owner.
+    /// \return Popped action, or nullptr if there was none.
+    Action* pop() noexcept;
+    /// Steals the least recently pushed action. Can be called by any thread.
+    /// \return Stolen action, or nullptr if there was none or if another thread has taken it first.
+    Action* steal() noexcept;
+
+  private:
+    std::atomic<int64_t> m_top = 0;
+    std::atomic<int64_t> m_bottom = 0;
+    std::array<std::atomic<Action*>, dequeCapacity> m_actions {};
+  };
+
+  struct Worker {
+    ActionDeque deque {};
+    std::array<Action, dequeCapacity> actionSlots {}; ///< Storage of the actions pushed into the deque, avoiding to allocate them.
+    std::array<std::atomic<bool>, dequeCapacity> busySlots {}; ///< Whether each slot holds an action not yet taken out by the thread executing it.
+    std::size_t nextSlotIndex = 0; ///< Slot from which to look for a free one when pushing an action.
+
+    std::mutex inboxMutex {};
+    std::deque<Action> inbox {}; ///< Actions added from threads external to the pool.
+  };
+
+  /// Takes one of the pending actions, if any, in priority from the calling worker's own actions.
+  /// \param action Taken action.
+  /// \return True if an action has been taken, false otherwise.
+  bool takeAction(Action& action);
+  /// Executes the given action with the context it has been added with, restoring the calling thread's context afterward.
+  /// \param action Action to be executed.
+  static void executeAction(Action& action);
+  /// Takes the given action out of the storage it has been pushed into, releasing the latter.
+  /// \param worker Worker in whose deque the action has been pushed.
+  /// \param storedAction Action to be taken.
+  /// \return Taken action.
+  static Action releaseAction(Worker& worker, Action* storedAction) noexcept;
+  /// Wakes up a sleeping worker, if any.
+  void notifyWorker();
+
+  std::vector<std::unique_ptr<Worker>> m_workers {};
   std::vector<std::thread> m_threads {};
-  bool m_shouldStop = false;
+  std::atomic<std::size_t> m_nextInboxIndex = 0;
 
-  std::mutex m_actionsMutex {};
-  std::condition_variable m_condVar {};
-  std::queue<std::function<void()>> m_actions {};
+  std::atomic<int64_t> m_pendingActionCount = 0;
+  std::atomic<std::size_t> m_sleepingWorkerCount = 0;
+  std::mutex m_sleepMutex {};
+  std::condition_variable m_sleepCondVar {};
+  bool m_shouldStop = false;
 };
 
 } // namespace Raz
 
+#include "RaZ/Utils/ThreadPool.inl"
+
 #endif // RAZ_THREADS_AVAILABLE
 
 #endif // RAZ_THREADPOOL_HPP
@@ -0,0 +1,46 @@
+#include <new>
+#include <utility>
+
+namespace Raz {
+
+template <typename FuncT>
+const ThreadPool::Action::Operations ThreadPool::Action::inlineOperations = {
+  [] (void* storage) { (*static_cast<FuncT*>(storage))(); },
+  [] (void* storage, void* otherStorage) noexcept {
+    new (storage) FuncT(std::move(*static_cast<FuncT*>(otherStorage)));
+    static_cast<FuncT*>(otherStorage)->~FuncT();
+  },
+  [] (void* storage) noexcept { static_cast<FuncT*>(storage)->~FuncT(); }
+};
+
+template <typename FuncT>
+const ThreadPool::Action::Operations ThreadPool::Action::heapOperations = {
+  [] (void* storage) { (**static_cast<FuncT**>(storage))(); },
+  [] (void* storage, void* otherStorage) noexcept { *static_cast<FuncT**>(storage) = *static_cast<FuncT**>(otherStorage); },
+  [] (void* storage) noexcept { delete *static_cast<FuncT**>(storage); }
+};
+
+template <typename FuncT, typename>
+ThreadPool::Action::Action(FuncT&& action) {
+  using ActionT = std::decay_t<FuncT>;
+  static_assert(std::is_invocable_v<ActionT&>, "Error: An action must be callable without any argument.");
+
+  if constexpr (isStoredInline<ActionT>) {
+    new (m_storage) ActionT(std::forward<FuncT>(action));
+    m_operations = &inlineOperations<ActionT>;
+  } else {
+    // The callable is too large to be stored inline; only a pointer to it is
+    *static_cast<ActionT**>(static_cast<void*>(m_storage)) = new ActionT(std::forward<FuncT>(action));
+    m_operations = &heapOperations<ActionT>;
+  }
+}
+
+template <typename CondT>
+void ThreadPool::executeUntil(CondT&& condition) {
+  while (!condition()) {
+    if (!executePendingAction())
+      std::this_thread::yield();
+  }
+}
+
+} // namespace Raz
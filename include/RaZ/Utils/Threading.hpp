@@ -17,6 +17,7 @@
 
 #include <functional>
 #include <future>
+#include <iterator>
 
 namespace Raz {
 
@@ -54,21 +55,41 @@ inline unsigned int getSystemThreadCount() noexcept { return std::max(std::threa
 /// \return Reference to the default thread pool.
 ThreadPool& getDefaultThreadPool();
 
+/// Gets the thread pool dedicated to I/O operations, initialized with half the number of threads available to the system (with a minimum of one).
+/// Its threads are meant to execute blocking operations, like reading & decoding files, without occupying those of the default pool.
+/// \return Reference to the I/O thread pool.
+ThreadPool& getIoThreadPool();
+
 /// Pauses the current thread for the specified amount of time.
 /// \param milliseconds Pause duration in milliseconds.
 inline void sleep(uint64_t milliseconds) { std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds)); }
 
-/// Calls a function asynchronously, to be executed without blocking the calling thread.
+/// Calls a function asynchronously on the default thread pool, to be executed without blocking the calling thread.
+/// \note Waiting for the result from one of the pool's threads blocks it, preventing it from executing other actions meanwhile;
+///   JobSystem should be preferred when actions depend on one another.
 /// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
 /// \tparam FuncT Type of the action to be executed.
 /// \tparam Args Types of the arguments to be forwarded to the given function.
 /// \tparam ResultT Return type of the given function.
 /// \param action Action to be performed asynchronously.
 /// \param args Arguments to be forwarded to the given function.
-/// \return A std::future holding the future result of the process. This should not be discarded, as doing so will fail to run asynchronously.
+/// \return A std::future holding the future result of the process.
 template <typename FuncT, typename... Args, typename ResultT = std::invoke_result_t<FuncT&&, Args&&...>>
 [[nodiscard]] std::future<ResultT> launchAsync(FuncT&& action, Args&&... args);
 
+/// Calls a function asynchronously on the I/O thread pool, to be executed without blocking the calling thread.
+/// This should be used for operations spending most of their time waiting, like reading files, so that they don't occupy the default pool's threads.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \see getIoThreadPool()
+/// \tparam FuncT Type of the action to be executed.
+/// \tparam Args Types of the arguments to be forwarded to the given function.
+/// \tparam ResultT Return type of the given function.
+/// \param action Action to be performed asynchronously.
+/// \param args Arguments to be forwarded to the given function.
+/// \return A std::future holding the future result of the process.
+template <typename FuncT, typename... Args, typename ResultT = std::invoke_result_t<FuncT&&, Args&&...>>
+[[nodiscard]] std::future<ResultT> launchIoAsync(FuncT&& action, Args&&... args);
+
 /// Calls a function in parallel.
 /// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
 /// \param action Action to be performed by each thread.
@@ -119,6 +140,85 @@ void parallelize(ContainerT&& collection, FuncT&& action, unsigned int threadCou
   parallelize(std::begin(collection), std::end(collection), std::forward<FuncT>(action), threadCount);
 }
 
+/// Calls a function in parallel over an index range, split into chunks which are dynamically distributed among the default thread pool's threads.
+/// Contrary to parallelize(), which gives a single range to each thread, the chunks are taken by each thread as soon as it is available, thus
+///   balancing the load when the cost of processing each index varies. The calling thread also processes chunks while waiting.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \tparam FuncT Type of the action to be executed.
+/// \param beginIndex Starting index of the whole range.
+/// \param endIndex Past-the-last index of the whole range. Nothing is done if it is not greater than the begin index.
+/// \param action Action to be performed on each chunk, taking an index range as boundaries.
+/// \param grainSize Maximum number of indices in each chunk. If 0, it is automatically chosen according to the range size & the number of threads.
+template <typename FuncT>
+void parallelFor(std::size_t beginIndex, std::size_t endIndex, FuncT&& action, std::size_t grainSize = 0);
+
+/// Calls a function in parallel over an iterator range, split into chunks which are dynamically distributed among the default thread pool's threads.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \see parallelFor(std::size_t, std::size_t, FuncT&&, std::size_t)
+/// \tparam IterT Type of the iterators. Must be random access iterators.
+/// \tparam FuncT Type of the action to be executed.
+/// \param begin Begin iterator of the whole range.
+/// \param end End iterator of the whole range.
+/// \param action Action to be performed on each chunk, taking an iterator range as boundaries.
+/// \param grainSize Maximum number of elements in each chunk. If 0, it is automatically chosen according to the range size & the number of threads.
+template <typename IterT, typename FuncT, typename = typename std::iterator_traits<IterT>::iterator_category>
+void parallelFor(IterT begin, IterT end, FuncT&& action, std::size_t grainSize = 0);
+
+/// Calls a function in parallel over a collection, split into chunks which are dynamically distributed among the default thread pool's threads.
+/// \note The container must either be a constant-size C array, or have public begin() & end() functions returning random access iterators.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \tparam ContainerT Type of the collection to iterate over.
+/// \tparam FuncT Type of the action to be executed.
+/// \param collection Collection to iterate over on multiple threads.
+/// \param action Action to be performed on each chunk, taking an iterator range as boundaries.
+/// \param grainSize Maximum number of elements in each chunk. If 0, it is automatically chosen according to the collection size & the number of threads.
+template <typename ContainerT, typename FuncT, typename = decltype(std::begin(std::declval<ContainerT>()))>
+void parallelFor(ContainerT&& collection, FuncT&& action, std::size_t grainSize = 0) {
+  parallelFor(std::begin(collection), std::end(collection), std::forward<FuncT>(action), grainSize);
+}
+
+/// Computes a value in parallel over an index range, reducing the values computed for each chunk.
+/// The chunks' values are always reduced in the order of the chunks, so that the result only depends on the grain size; it is thus
+///   deterministic even for non-commutative operations or floating-point values, as long as the same grain size is used.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \tparam T Type of the value to be computed.
+/// \tparam RangeFuncT Type of the action computing the value of a chunk.
+/// \tparam ReduceFuncT Type of the reduction operation.
+/// \param beginIndex Starting index of the whole range.
+/// \param endIndex Past-the-last index of the whole range. If not greater than the begin index, the identity value is returned.
+/// \param identity Initial value of the reduction, which must not change the result when reduced with any value.
+/// \param rangeAction Action computing a value from a chunk, taking an index range as boundaries.
+/// \param reduction Associative operation reducing two values into one.
+/// \param grainSize Maximum number of indices in each chunk. If 0, it is automatically chosen according to the range size & the number of threads.
+/// \return Reduced value.
+template <typename T, typename RangeFuncT, typename ReduceFuncT>
+T parallelReduce(std::size_t beginIndex, std::size_t endIndex, T identity, RangeFuncT&& rangeAction, ReduceFuncT&& reduction, std::size_t grainSize = 0);
+
+/// Computes in parallel the inclusive scan (prefix sum) of a range: each output element is the reduction of all the input elements up to its position.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \tparam InputIterT Type of the input iterators. Must be random access iterators.
+/// \tparam OutputIterT Type of the output iterator. Must be a random access iterator.
+/// \tparam FuncT Type of the reduction operation.
+/// \param begin Begin iterator of the input range.
+/// \param end End iterator of the input range.
+/// \param output Begin iterator of the output range, which must be at least as large as the input one. Can be equal to the input begin iterator.
+/// \param operation Associative operation reducing two values into one.
+/// \param grainSize Maximum number of elements in each chunk. If 0, it is automatically chosen according to the range size & the number of threads.
+template <typename InputIterT, typename OutputIterT, typename FuncT = std::plus<>>
+void parallelScan(InputIterT begin, InputIterT end, OutputIterT output, FuncT operation = {}, std::size_t grainSize = 0);
+
+/// Sorts a range in parallel. The range is split into chunks sorted concurrently, which are then merged two by two.
+/// The sort is not stable: the order of equivalent elements is not guaranteed to be preserved.
+/// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+/// \tparam IterT Type of the iterators. Must be random access iterators.
+/// \tparam CompT Type of the comparison operation.
+/// \param begin Begin iterator of the range to be sorted.
+/// \param end End iterator of the range to be sorted.
+/// \param comparison Operation returning true if its first argument must be placed before its second one.
+/// \param grainSize Number of elements sorted in each chunk, the last one possibly holding fewer. If 0, it is automatically chosen according to the range size & the number of threads.
+template <typename IterT, typename CompT = std::less<>>
+void parallelSort(IterT begin, IterT end, CompT comparison = {}, std::size_t grainSize = 0);
+
 } // namespace Threading
 
 } // namespace Raz
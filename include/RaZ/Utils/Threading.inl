@@ -1,21 +1,170 @@
 #include "RaZ/Utils/ThreadPool.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace Raz::Threading {
 
-template <typename FuncT, typename... Args, typename ResultT>
-std::future<ResultT> launchAsync(FuncT&& action, Args&&... args) {
+namespace Details {
+
+/// Computes the boundaries of one of the parts of a range split as evenly as possible.
+/// The remainder of the division is spread over the first parts, which thus have one more element than the others.
+/// \param rangeCount Number of elements in the whole range.
+/// \param partCount Number of parts to split the range into.
+/// \param partIndex Index of the part to compute the boundaries of.
+/// \return Boundaries of the part, relative to the beginning of the whole range.
+constexpr IndexRange computeSplitRange(std::size_t rangeCount, std::size_t partCount, std::size_t partIndex) noexcept {
+  const std::size_t partRangeCount = rangeCount / partCount;
+  const std::size_t remainderCount = rangeCount % partCount;
+  const std::size_t partBeginIndex = partRangeCount * partIndex + std::min(partIndex, remainderCount);
+
+  return IndexRange{ partBeginIndex, partBeginIndex + partRangeCount + (partIndex < remainderCount ? 1 : 0) };
+}
+
+/// Computes the number of elements in each chunk a range is to be split into.
+/// \param rangeCount Number of elements in the whole range.
+/// \param grainSize User-defined number of elements per chunk; if 0, several chunks are made per thread, allowing them to balance their load.
+/// \return Number of elements per chunk.
+inline std::size_t computeGrainSize(std::size_t rangeCount, std::size_t grainSize) noexcept {
+  if (grainSize != 0)
+    return grainSize;
+
+  constexpr std::size_t chunkCountPerThread = 4;
+  return std::max(rangeCount / (static_cast<std::size_t>(getSystemThreadCount()) * chunkCountPerThread), static_cast<std::size_t>(1));
+}
+
+/// First exception thrown among several actions executed concurrently, to be rethrown on the calling thread once all of them are finished.
+struct ExceptionStorage {
+  /// Executes the given action, keeping the exception it may throw if none has been stored yet instead of propagating it.
+  /// \tparam FuncT Type of the action to be executed.
+  /// \param action Action to be executed.
+  /// \return True if the action has been executed without throwing, false otherwise.
+  template <typename FuncT>
+  bool execute(FuncT&& action) noexcept {
+    try {
+      action();
+      return true;
+    } catch (...) {
+      if (!hasThrown.test_and_set())
+        exception = std::current_exception();
+
+      return false;
+    }
+  }
+
+  /// Rethrows the stored exception, if any. Must only be called once all the actions are finished.
+  void rethrow() const {
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+
+  std::atomic_flag hasThrown = ATOMIC_FLAG_INIT;
+  std::exception_ptr exception {};
+};
+
+/// Executes an action on each of the given number of chunks, which are dynamically distributed among the default thread pool's threads.
+/// The calling thread also executes chunks, then helps executing other actions until all chunks have been processed.
+/// \tparam FuncT Type of the action to be executed.
+/// \param chunkCount Number of chunks to be processed.
+/// \param chunkAction Action to be executed on each chunk, taking the chunk's index.
+template <typename FuncT>
+void executeChunks(std::size_t chunkCount, FuncT&& chunkAction) {
 #if !defined(RAZ_PLATFORM_EMSCRIPTEN)
-  return std::async(std::forward<FuncT>(action), std::forward<Args>(args)...);
+  if (chunkCount <= 1) {
+    if (chunkCount == 1)
+      chunkAction(static_cast<std::size_t>(0));
+
+    return;
+  }
+
+  ThreadPool& threadPool = getDefaultThreadPool();
+  const std::size_t helperCount = std::min(static_cast<std::size_t>(threadPool.getThreadCount()), chunkCount - 1);
+
+  std::atomic<std::size_t> nextChunkIndex = 0;
+  std::atomic<std::size_t> remainingActionCount = helperCount;
+  ExceptionStorage exceptionStorage;
+
+  const auto processChunks = [chunkCount, &chunkAction, &nextChunkIndex, &exceptionStorage] () noexcept {
+    const bool hasSucceeded = exceptionStorage.execute([chunkCount, &chunkAction, &nextChunkIndex] () {
+      for (std::size_t chunkIndex = nextChunkIndex++; chunkIndex < chunkCount; chunkIndex = nextChunkIndex++)
+        chunkAction(chunkIndex);
+    });
+
+    // No other chunk will be processed after an exception has been thrown
+    if (!hasSucceeded)
+      nextChunkIndex = chunkCount;
+  };
+
+  for (std::size_t helperIndex = 0; helperIndex < helperCount; ++helperIndex) {
+    threadPool.addAction([&processChunks, &remainingActionCount] () noexcept {
+      processChunks();
+      --remainingActionCount;
+    });
+  }
+
+  processChunks();
+
+  // Waiting for all threads to finish their chunks, helping executing other actions meanwhile
+  threadPool.executeUntil([&remainingActionCount] () { return (remainingActionCount == 0); });
+
+  exceptionStorage.rethrow();
+#else
+  for (std::size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+    chunkAction(chunkIndex);
+#endif
+}
+
+/// Calls a function asynchronously on the given thread pool.
+/// \tparam ResultT Return type of the given function.
+/// \tparam FuncT Type of the action to be executed.
+/// \tparam Args Types of the arguments to be forwarded to the given function.
+/// \param threadPool Thread pool to execute the action on.
+/// \param action Action to be performed asynchronously.
+/// \param args Arguments to be forwarded to the given function.
+/// \return A std::future holding the future result of the process.
+template <typename ResultT, typename FuncT, typename... Args>
+std::future<ResultT> launchAsync([[maybe_unused]] ThreadPool& threadPool, FuncT&& action, Args&&... args) {
+#if !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  // Like with std::async, the action & its arguments are copied or moved, so that they remain valid until the action is executed
+  std::packaged_task<ResultT()> task([action = std::forward<FuncT>(action), args = std::make_tuple(std::forward<Args>(args)...)] () mutable
+                                       noexcept(std::is_nothrow_invocable_v<std::decay_t<FuncT>, std::decay_t<Args>...>) {
+    return std::apply(std::move(action), std::move(args));
+  });
+  std::future<ResultT> result = task.get_future();
+
+  threadPool.addAction(std::move(task));
+  return result;
 #else
   std::promise<ResultT> promise;
-  promise.set_value(action(std::forward<Args>(args)...));
+
+  if constexpr (std::is_void_v<ResultT>) {
+    action(std::forward<Args>(args)...);
+    promise.set_value();
+  } else {
+    promise.set_value(action(std::forward<Args>(args)...));
+  }
+
   return promise.get_future();
 #endif
 }
 
+} // namespace Details
+
+template <typename FuncT, typename... Args, typename ResultT>
+std::future<ResultT> launchAsync(FuncT&& action, Args&&... args) {
+  return Details::launchAsync<ResultT>(getDefaultThreadPool(), std::forward<FuncT>(action), std::forward<Args>(args)...);
+}
+
+template <typename FuncT, typename... Args, typename ResultT>
+std::future<ResultT> launchIoAsync(FuncT&& action, Args&&... args) {
+  return Details::launchAsync<ResultT>(getIoThreadPool(), std::forward<FuncT>(action), std::forward<Args>(args)...);
+}
+
 template <typename BegIndexT, typename EndIndexT, typename FuncT, typename>
 void parallelize(BegIndexT beginIndex, EndIndexT endIndex, FuncT&& action, unsigned int threadCount) {
   static_assert(std::is_invocable_v<FuncT, IndexRange>, "Error: The given action must take an IndexRange as parameter");
@@ -30,25 +179,26 @@ void parallelize(BegIndexT beginIndex, EndIndexT endIndex, FuncT&& action, unsig
 #if !defined(RAZ_PLATFORM_EMSCRIPTEN)
   ThreadPool& threadPool = getDefaultThreadPool();
 
-  const std::size_t maxThreadCount   = std::min(static_cast<std::size_t>(threadCount), totalRangeCount);
-  const std::size_t threadRangeCount = (totalRangeCount + maxThreadCount / 2) / maxThreadCount;
+  const std::size_t maxThreadCount = std::min(static_cast<std::size_t>(threadCount), totalRangeCount);
 
-  std::vector<std::promise<void>> promises;
-  promises.resize(maxThreadCount);
+  std::atomic<std::size_t> remainingActionCount = maxThreadCount;
+  Details::ExceptionStorage exceptionStorage;
 
   for (std::size_t threadIndex = 0; threadIndex < maxThreadCount; ++threadIndex) {
-    const std::size_t threadBeginIndex = beginIndex + threadRangeCount * threadIndex;
-    const std::size_t threadEndIndex   = std::min(threadBeginIndex + threadRangeCount, totalRangeCount);
+    const IndexRange threadRange       = Details::computeSplitRange(totalRangeCount, maxThreadCount, threadIndex);
+    const std::size_t threadBeginIndex = static_cast<std::size_t>(beginIndex) + threadRange.beginIndex;
+    const std::size_t threadEndIndex   = static_cast<std::size_t>(beginIndex) + threadRange.endIndex;
 
-    threadPool.addAction([&action, threadBeginIndex, threadEndIndex, &promises, threadIndex] () noexcept(std::is_nothrow_invocable_v<FuncT, IndexRange>) {
-      action(IndexRange{ threadBeginIndex, threadEndIndex });
-      promises[threadIndex].set_value();
+    threadPool.addAction([&action, threadBeginIndex, threadEndIndex, &remainingActionCount, &exceptionStorage] () noexcept {
+      exceptionStorage.execute([&action, threadBeginIndex, threadEndIndex] () { action(IndexRange{ threadBeginIndex, threadEndIndex }); });
+      --remainingActionCount;
     });
   }
 
-  // Blocking here to wait for all threads to finish their action
-  for (std::promise<void>& promise : promises)
-    promise.get_future().wait();
+  // Waiting for all threads to finish their action, helping executing them meanwhile; the actions are always counted as finished, even if
+  //  throwing, the first exception being then rethrown
+  threadPool.executeUntil([&remainingActionCount] () { return (remainingActionCount == 0); });
+  exceptionStorage.rethrow();
 #else
   static_cast<void>(threadCount);
   action(IndexRange{ static_cast<std::size_t>(beginIndex), static_cast<std::size_t>(endIndex) });
@@ -69,29 +219,169 @@ void parallelize(IterT begin, IterT end, FuncT&& action, unsigned int threadCoun
 #if !defined(RAZ_PLATFORM_EMSCRIPTEN)
   ThreadPool& threadPool = getDefaultThreadPool();
 
-  const std::size_t maxThreadCount      = std::min(static_cast<std::size_t>(threadCount), static_cast<std::size_t>(totalRangeCount));
-  const std::ptrdiff_t threadRangeCount = (totalRangeCount + maxThreadCount / 2) / maxThreadCount;
+  const std::size_t maxThreadCount = std::min(static_cast<std::size_t>(threadCount), static_cast<std::size_t>(totalRangeCount));
 
-  std::vector<std::promise<void>> promises;
-  promises.resize(maxThreadCount);
+  std::atomic<std::size_t> remainingActionCount = maxThreadCount;
+  Details::ExceptionStorage exceptionStorage;
 
   for (std::size_t threadIndex = 0; threadIndex < maxThreadCount; ++threadIndex) {
-    const IterT threadBeginIter = begin + threadRangeCount * threadIndex;
-    const IterT threadEndIter   = threadBeginIter + std::min(threadRangeCount, std::distance(threadBeginIter, end));
+    const IndexRange threadRange = Details::computeSplitRange(static_cast<std::size_t>(totalRangeCount), maxThreadCount, threadIndex);
+    const IterT threadBeginIter  = std::next(begin, static_cast<std::ptrdiff_t>(threadRange.beginIndex));
+    const IterT threadEndIter    = std::next(begin, static_cast<std::ptrdiff_t>(threadRange.endIndex));
 
-    threadPool.addAction([&action, threadBeginIter, threadEndIter, &promises, threadIndex] () noexcept(std::is_nothrow_invocable_v<FuncT, IterRange<IterT>>) {
-      action(IterRange<IterT>(threadBeginIter, threadEndIter));
-      promises[threadIndex].set_value();
+    threadPool.addAction([&action, threadBeginIter, threadEndIter, &remainingActionCount, &exceptionStorage] () noexcept {
+      exceptionStorage.execute([&action, &threadBeginIter, &threadEndIter] () { action(IterRange<IterT>(threadBeginIter, threadEndIter)); });
+      --remainingActionCount;
     });
   }
 
-  // Blocking here to wait for all threads to finish their action
-  for (std::promise<void>& promise : promises)
-    promise.get_future().wait();
+  // Waiting for all threads to finish their action, helping executing them meanwhile; the actions are always counted as finished, even if
+  //  throwing, the first exception being then rethrown
+  threadPool.executeUntil([&remainingActionCount] () { return (remainingActionCount == 0); });
+  exceptionStorage.rethrow();
 #else
   static_cast<void>(threadCount);
   action(IterRange<IterT>(begin, end));
 #endif
 }
 
+template <typename FuncT>
+void parallelFor(std::size_t beginIndex, std::size_t endIndex, FuncT&& action, std::size_t grainSize) {
+  static_assert(std::is_invocable_v<FuncT, IndexRange>, "Error: The given action must take an IndexRange as parameter");
+
+  if (beginIndex >= endIndex)
+    return;
+
+  const std::size_t totalRangeCount = endIndex - beginIndex;
+  const std::size_t chunkSize       = Details::computeGrainSize(totalRangeCount, grainSize);
+
+  Details::executeChunks((totalRangeCount + chunkSize - 1) / chunkSize, [beginIndex, endIndex, chunkSize, &action] (std::size_t chunkIndex) {
+    const std::size_t chunkBeginIndex = beginIndex + chunkIndex * chunkSize;
+    action(IndexRange{ chunkBeginIndex, std::min(chunkBeginIndex + chunkSize, endIndex) });
+  });
+}
+
+template <typename IterT, typename FuncT, typename>
+void parallelFor(IterT begin, IterT end, FuncT&& action, std::size_t grainSize) {
+  static_assert(std::is_invocable_v<FuncT, IterRange<IterT>>, "Error: The given action must take an IterRange as parameter");
+
+  const std::ptrdiff_t totalRangeCount = std::distance(begin, end);
+
+  parallelFor(0, static_cast<std::size_t>(std::max(totalRangeCount, static_cast<std::ptrdiff_t>(0))), [begin, &action] (const IndexRange& range) {
+    action(IterRange<IterT>(begin + static_cast<std::ptrdiff_t>(range.beginIndex), begin + static_cast<std::ptrdiff_t>(range.endIndex)));
+  }, grainSize);
+}
+
+template <typename T, typename RangeFuncT, typename ReduceFuncT>
+T parallelReduce(std::size_t beginIndex, std::size_t endIndex, T identity, RangeFuncT&& rangeAction, ReduceFuncT&& reduction, std::size_t grainSize) {
+  static_assert(std::is_invocable_r_v<T, RangeFuncT, IndexRange>, "Error: The given range action must take an IndexRange as parameter & return a value");
+  static_assert(std::is_invocable_r_v<T, ReduceFuncT, T, T>, "Error: The given reduction must take two values as parameters & return a value");
+
+  if (beginIndex >= endIndex)
+    return identity;
+
+  const std::size_t totalRangeCount = endIndex - beginIndex;
+  const std::size_t chunkSize       = Details::computeGrainSize(totalRangeCount, grainSize);
+  const std::size_t chunkCount      = (totalRangeCount + chunkSize - 1) / chunkSize;
+
+  std::vector<T> chunkValues(chunkCount, identity);
+
+  Details::executeChunks(chunkCount, [beginIndex, endIndex, chunkSize, &rangeAction, &chunkValues] (std::size_t chunkIndex) {
+    const std::size_t chunkBeginIndex = beginIndex + chunkIndex * chunkSize;
+    chunkValues[chunkIndex] = rangeAction(IndexRange{ chunkBeginIndex, std::min(chunkBeginIndex + chunkSize, endIndex) });
+  });
+
+  T result = std::move(identity);
+
+  for (T& chunkValue : chunkValues)
+    result = reduction(std::move(result), std::move(chunkValue));
+
+  return result;
+}
+
+template <typename InputIterT, typename OutputIterT, typename FuncT>
+void parallelScan(InputIterT begin, InputIterT end, OutputIterT output, FuncT operation, std::size_t grainSize) {
+  using ValueT = typename std::iterator_traits<InputIterT>::value_type;
+
+  const std::ptrdiff_t totalRangeCount = std::distance(begin, end);
+
+  if (totalRangeCount <= 0)
+    return;
+
+  const std::size_t chunkSize  = Details::computeGrainSize(static_cast<std::size_t>(totalRangeCount), grainSize);
+  const std::size_t chunkCount = (static_cast<std::size_t>(totalRangeCount) + chunkSize - 1) / chunkSize;
+
+  const auto computeChunkRange = [begin, end, chunkSize] (std::size_t chunkIndex) {
+    const InputIterT chunkBegin = begin + static_cast<std::ptrdiff_t>(chunkIndex * chunkSize);
+    return IterRange<InputIterT>(chunkBegin, chunkBegin + std::min(static_cast<std::ptrdiff_t>(chunkSize), std::distance(chunkBegin, end)));
+  };
+
+  // Each chunk is first reduced independently; the last one's value is not needed, since no other chunk comes after it
+  std::vector<ValueT> chunkOffsets(chunkCount);
+
+  Details::executeChunks(chunkCount - 1, [&computeChunkRange, &operation, &chunkOffsets] (std::size_t chunkIndex) {
+    const IterRange<InputIterT> chunkRange = computeChunkRange(chunkIndex);
+    ValueT chunkValue = *chunkRange.begin();
+
+    for (InputIterT iter = std::next(chunkRange.begin()); iter != chunkRange.end(); ++iter)
+      chunkValue = operation(std::move(chunkValue), *iter);
+
+    chunkOffsets[chunkIndex + 1] = std::move(chunkValue);
+  });
+
+  // The chunks' values are then scanned sequentially, giving the value each chunk must start from
+  for (std::size_t chunkIndex = 2; chunkIndex < chunkCount; ++chunkIndex)
+    chunkOffsets[chunkIndex] = operation(chunkOffsets[chunkIndex - 1], chunkOffsets[chunkIndex]);
+
+  // Each chunk is finally scanned from its offset; as every input element is read before the output one at the same position is written, the
+  //  output can be the input range itself
+  Details::executeChunks(chunkCount, [begin, output, &computeChunkRange, &operation, &chunkOffsets] (std::size_t chunkIndex) {
+    const IterRange<InputIterT> chunkRange = computeChunkRange(chunkIndex);
+    OutputIterT outputIter = output + std::distance(begin, chunkRange.begin());
+
+    ValueT value = (chunkIndex == 0 ? ValueT(*chunkRange.begin()) : operation(chunkOffsets[chunkIndex], *chunkRange.begin()));
+    *outputIter = value;
+
+    for (InputIterT iter = std::next(chunkRange.begin()); iter != chunkRange.end(); ++iter) {
+      value         = operation(std::move(value), *iter);
+      *++outputIter = value;
+    }
+  });
+}
+
+template <typename IterT, typename CompT>
+void parallelSort(IterT begin, IterT end, CompT comparison, std::size_t grainSize) {
+  const std::ptrdiff_t totalRangeCount = std::distance(begin, end);
+
+  if (totalRangeCount <= 1)
+    return;
+
+  // Merging sorted chunks being sequential, the chunks are made as large as possible; by default, each thread sorts a single one
+  constexpr std::size_t minChunkSize = 2048;
+  const auto rangeCount       = static_cast<std::size_t>(totalRangeCount);
+  const auto threadCount      = static_cast<std::size_t>(getSystemThreadCount());
+  const std::size_t chunkSize = (grainSize != 0 ? grainSize : std::max((rangeCount + threadCount - 1) / threadCount, minChunkSize));
+
+  if (chunkSize >= rangeCount) {
+    std::sort(begin, end, comparison);
+    return;
+  }
+
+  const auto computeIter = [begin, rangeCount] (std::size_t index) { return begin + static_cast<std::ptrdiff_t>(std::min(index, rangeCount)); };
+
+  Details::executeChunks((rangeCount + chunkSize - 1) / chunkSize, [chunkSize, &computeIter, &comparison] (std::size_t chunkIndex) {
+    std::sort(computeIter(chunkIndex * chunkSize), computeIter((chunkIndex + 1) * chunkSize), comparison);
+  });
+
+  // The sorted chunks are merged two by two, doubling the size of the sorted ranges at each pass
+  for (std::size_t sortedRangeSize = chunkSize; sortedRangeSize < rangeCount; sortedRangeSize *= 2) {
+    const std::size_t mergedRangeSize = sortedRangeSize * 2;
+
+    Details::executeChunks((rangeCount + mergedRangeSize - 1) / mergedRangeSize, [sortedRangeSize, mergedRangeSize, &computeIter, &comparison] (std::size_t mergeIndex) {
+      const std::size_t mergeBeginIndex = mergeIndex * mergedRangeSize;
+      std::inplace_merge(computeIter(mergeBeginIndex), computeIter(mergeBeginIndex + sortedRangeSize), computeIter(mergeBeginIndex + mergedRangeSize), comparison);
+    });
+  }
+}
+
 } // namespace Raz::Threading
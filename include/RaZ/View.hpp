@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef RAZ_VIEW_HPP
+#define RAZ_VIEW_HPP
+
+#include "RaZ/Entity.hpp"
+
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace Raz {
+
+/// ViewBase class, allowing to manipulate views without knowing the components they query.
+class ViewBase {
+public:
+  ViewBase() = default;
+  ViewBase(const ViewBase&) = delete;
+  ViewBase(ViewBase&&) noexcept = delete;
+
+  /// Gets the ID of the given view type.
+  /// It uses CRTP to assign a different ID to each view type it is called with.
+  /// \tparam ViewT Type of the view to get the ID of.
+  /// \return Given view's ID.
+  template <typename ViewT> static std::size_t getId();
+  /// Checks if the given entity matches the view, adding it if it does and removing it otherwise.
+  /// The references to the entity's components are updated if it was already part of the view.
+  /// \param entity Entity to be checked.
+  virtual void refreshEntity(Entity& entity) = 0;
+  /// Removes the given entity from the view, if it is part of it.
+  /// \param entity Entity to be removed.
+  virtual void removeEntity(const Entity& entity) = 0;
+  /// Removes all the entities from the view.
+  virtual void clear() noexcept = 0;
+
+  ViewBase& operator=(const ViewBase&) = delete;
+  ViewBase& operator=(ViewBase&&) noexcept = delete;
+
+  virtual ~ViewBase() = default;
+
+private:
+  static inline std::size_t m_maxId = 0;
+};
+
+/// View class, holding the enabled entities which have all the given components, as well as direct references to those.
+/// Views are usually obtained from a World (see World::view()), which keeps them up to date as soon as components are added or removed.
+/// \note A view must not be modified while being iterated over; as such, components must not be added or removed while iterating.
+/// \tparam Comps Types of the components to query.
+template <typename... Comps>
+class View final : public ViewBase {
+  static_assert(sizeof...(Comps) > 0, "Error: A view must query at least one component.");
+  static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: The components to query must all be derived from Component.");
+
+  struct Element {
+    Entity* entity;
+    std::tuple<Comps*...> components;
+  };
+
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::tuple<Comps&...>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = std::tuple<Comps&...>;
+
+    explicit Iterator(typename std::vector<Element>::iterator iterator) : m_iterator{ iterator } {}
+
+    /// Gets the entity the iterator currently points to.
+    /// \return Reference to the current entity.
+    Entity& getEntity() const noexcept { return *m_iterator->entity; }
+
+    std::tuple<Comps&...> operator*() const noexcept { return std::tuple<Comps&...>(*std::get<Comps*>(m_iterator->components)...); }
+    Iterator& operator++() noexcept { ++m_iterator; return *this; }
+    Iterator operator++(int) noexcept { Iterator copy = *this; ++m_iterator; return copy; }
+    bool operator==(const Iterator& iterator) const noexcept { return (m_iterator == iterator.m_iterator); }
+    bool operator!=(const Iterator& iterator) const noexcept { return !(*this == iterator); }
+
+  private:
+    typename std::vector<Element>::iterator m_iterator;
+  };
+
+  View() = default;
+
+  std::size_t getSize() const noexcept { return m_elements.size(); }
+  bool isEmpty() const noexcept { return m_elements.empty(); }
+
+  Iterator begin() noexcept { return Iterator(m_elements.begin()); }
+  Iterator end() noexcept { return Iterator(m_elements.end()); }
+
+  /// Checks if the view contains the given entity.
+  /// \param entity Entity to be checked.
+  /// \return True if the entity is part of the view, false otherwise.
+  bool containsEntity(const Entity& entity) const noexcept;
+  /// Calls the given action on every entity of the view.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking references to the components as parameters, optionally preceded by a reference to the entity.
+  template <typename FuncT> void forEach(FuncT&& action);
+  /// Calls the given action on every entity of the view in parallel, the entities being split in chunks distributed over the default thread pool.
+  /// The action must thus be safe to be called concurrently on different entities.
+  /// \note If using Emscripten this call will be synchronous, threads being unsupported with it for now.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking references to the components as parameters, optionally preceded by a reference to the entity.
+  /// \param chunkSize Number of consecutive entities processed at once by a thread.
+  template <typename FuncT> void parallelForEach(FuncT&& action, std::size_t chunkSize = 64);
+  void refreshEntity(Entity& entity) override;
+  void removeEntity(const Entity& entity) override;
+  void clear() noexcept override;
+
+private:
+  static constexpr std::size_t invalidIndex = std::numeric_limits<std::size_t>::max();
+
+  template <typename FuncT> static void apply(FuncT& action, const Element& element);
+
+  std::vector<Element> m_elements {};
+  std::vector<std::size_t> m_elementIndices {}; ///< Position of each entity's element, indexed by the entities' IDs; invalidIndex if not part of the view.
+};
+
+} // namespace Raz
+
+#include "RaZ/View.inl"
+
+#endif // RAZ_VIEW_HPP
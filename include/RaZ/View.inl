@@ -0,0 +1,96 @@
+#include "RaZ/Utils/Threading.hpp"
+
+#include <cassert>
+
+namespace Raz {
+
+template <typename ViewT>
+std::size_t ViewBase::getId() {
+  static_assert(std::is_base_of_v<ViewBase, ViewT>, "Error: The fetched view must be derived from ViewBase.");
+
+  static const std::size_t id = m_maxId++;
+  return id;
+}
+
+template <typename... Comps>
+bool View<Comps...>::containsEntity(const Entity& entity) const noexcept {
+  return (entity.getId() < m_elementIndices.size() && m_elementIndices[entity.getId()] != invalidIndex);
+}
+
+template <typename... Comps>
+template <typename FuncT>
+void View<Comps...>::forEach(FuncT&& action) {
+  for (const Element& element : m_elements)
+    apply(action, element);
+}
+
+template <typename... Comps>
+template <typename FuncT>
+void View<Comps...>::parallelForEach(FuncT&& action, std::size_t chunkSize) {
+  assert("Error: The chunk size can't be 0." && chunkSize != 0);
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  // The chunks are dynamically distributed, so that threads finishing early are not left idle
+  Threading::parallelFor(0, m_elements.size(), [this, &action] (const Threading::IndexRange& range) {
+    for (std::size_t elementIndex = range.beginIndex; elementIndex < range.endIndex; ++elementIndex)
+      apply(action, m_elements[elementIndex]);
+  }, chunkSize);
+#else
+  forEach(action);
+#endif
+}
+
+template <typename... Comps>
+void View<Comps...>::refreshEntity(Entity& entity) {
+  if (!entity.isEnabled() || !(entity.hasComponent<Comps>() && ...)) {
+    removeEntity(entity);
+    return;
+  }
+
+  const std::size_t entityId = entity.getId();
+
+  if (!containsEntity(entity)) {
+    if (entityId >= m_elementIndices.size())
+      m_elementIndices.resize(entityId + 1, invalidIndex);
+
+    m_elementIndices[entityId] = m_elements.size();
+    m_elements.emplace_back(Element{ &entity, {} });
+  }
+
+  // The references are always updated, since a component may have been replaced by another
+  m_elements[m_elementIndices[entityId]].components = std::tuple<Comps*...>(&entity.getComponent<Comps>()...);
+}
+
+template <typename... Comps>
+void View<Comps...>::removeEntity(const Entity& entity) {
+  if (!containsEntity(entity))
+    return;
+
+  const std::size_t elementIndex = m_elementIndices[entity.getId()];
+  m_elementIndices[entity.getId()] = invalidIndex;
+
+  // The last element is moved in place of the removed one, avoiding to shift all the following ones
+  if (elementIndex != m_elements.size() - 1) {
+    m_elements[elementIndex] = m_elements.back();
+    m_elementIndices[m_elements[elementIndex].entity->getId()] = elementIndex;
+  }
+
+  m_elements.pop_back();
+}
+
+template <typename... Comps>
+void View<Comps...>::clear() noexcept {
+  m_elements.clear();
+  m_elementIndices.clear();
+}
+
+template <typename... Comps>
+template <typename FuncT>
+void View<Comps...>::apply(FuncT& action, const Element& element) {
+  if constexpr (std::is_invocable_v<FuncT&, Entity&, Comps&...>)
+    action(*element.entity, *std::get<Comps*>(element.components)...);
+  else
+    action(*std::get<Comps*>(element.components)...);
+}
+
+} // namespace Raz
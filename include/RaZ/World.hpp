@@ -3,21 +3,38 @@
 #ifndef RAZ_WORLD_HPP
 #define RAZ_WORLD_HPP
 
+#include "RaZ/CommandBuffer.hpp"
+#include "RaZ/ComponentStorage.hpp"
 #include "RaZ/Entity.hpp"
+#include "RaZ/FrameTimeInfo.hpp"
 #include "RaZ/System.hpp"
+#include "RaZ/View.hpp"
+#include "RaZ/Data/PagedPool.hpp"
+
+#include <future>
+#include <mutex>
+#include <thread>
 
 namespace Raz {
 
 /// World class handling systems & entities.
 class World {
+  friend Entity;
+
 public:
   World() = default;
-  explicit World(std::size_t entityCount) { m_entities.reserve(entityCount); }
+  explicit World(std::size_t entityCount) { m_entityPool.reserve(entityCount); m_entities.reserve(entityCount); m_entitySlots.reserve(entityCount); }
   World(const World&) = delete;
-  World(World&&) noexcept = default;
+  World(World&& world) noexcept;
 
   const std::vector<SystemPtr>& getSystems() const { return m_systems; }
-  const std::vector<EntityPtr>& getEntities() const { return m_entities; }
+  const std::vector<Entity*>& getEntities() const { return m_entities; }
+  const ComponentStorage& getComponentStorage() const { return *m_componentStorage; }
+  bool isParallelUpdateEnabled() const noexcept { return m_isParallelUpdateEnabled; }
+  bool isFramePipeliningEnabled() const noexcept { return m_isFramePipeliningEnabled; }
+  /// Checks if the world must be updated on the main thread, which is the case if any of its systems requires it (see System::requiresMainThread()).
+  /// \return True if the world must be updated on the main thread, false otherwise.
+  bool requiresMainThread() const noexcept;
 
   /// Adds a given system to the world.
   /// \tparam Sys Type of the system to be added.
@@ -57,39 +74,160 @@ public:
   /// \param enabled True if the entity should be active immediately, false otherwise.
   /// \return Reference to the newly added entity.
   template <typename... Comps> Entity& addEntityWithComponents(bool enabled = true);
+  /// Gets a view over the enabled entities which contain all the given components.
+  /// The view is created on the first call, and is then kept up to date as entities are added or removed, enabled or disabled,
+  ///   and as components are added or removed; fetching it is thus cheap, and iterating over it doesn't allocate.
+  /// \tparam Comps Types of the components to query.
+  /// \return Reference to the view.
+  template <typename... Comps> View<Comps...>& view();
   /// Fetches entities which contain specific component(s).
   /// \tparam Comps Types of the components to query.
   /// \return List of entities containing all given components.
   template <typename... Comps> std::vector<Entity*> recoverEntitiesWithComponents();
+  /// Checks if the given handle refers to an existing entity of this world.
+  /// \param handle Handle to be checked.
+  /// \return True if the handle refers to an existing entity, false if the latter has been removed or has never been created by this world.
+  bool hasEntity(EntityHandle handle) const noexcept { return (recoverEntity(handle) != nullptr); }
+  /// Gets the entity referred to by the given handle.
+  /// \param handle Handle of the entity to be fetched.
+  /// \return Pointer to the found entity, or nullptr if the handle is stale.
+  const Entity* recoverEntity(EntityHandle handle) const noexcept;
+  /// Gets the entity referred to by the given handle.
+  /// \param handle Handle of the entity to be fetched.
+  /// \return Pointer to the found entity, or nullptr if the handle is stale.
+  Entity* recoverEntity(EntityHandle handle) noexcept { return const_cast<Entity*>(static_cast<const World*>(this)->recoverEntity(handle)); }
   /// Removes an entity from the world. It *must* be an entity created by this world.
+  /// \note The last entity of the list may be moved in place of the removed one.
   /// \param entity Entity to be removed.
   void removeEntity(const Entity& entity);
+  /// Removes the entity referred to by the given handle from the world. The handle *must* not be stale.
+  /// \param handle Handle of the entity to be removed.
+  void removeEntity(EntityHandle handle);
+  /// Gets a command buffer in which structural changes can be recorded to be applied on the next refresh.
+  /// Each thread is given its own buffer, bound to the system being updated if called from its update or from the thread pool's actions it
+  ///   has added (such as parallelized loops), whichever thread executes them. Systems updated concurrently can thus record commands without
+  ///   having to synchronize.
+  /// The buffers are executed one after the other at the beginning of the refresh: first those of the systems, in the systems' order, then the
+  ///   threads' ones, in the order they were first requested. The commands recorded by a system on the thread updating it are thus always
+  ///   executed in the same order; those it records from several threads at once are executed along with its others, but in any order.
+  /// \note The returned reference is only meant to be used by the calling thread, and must not be used across frames' refresh.
+  /// \return Reference to the calling thread's command buffer for the system being updated, if any.
+  CommandBuffer& getCommandBuffer();
+  /// Enables or disables the concurrent update of the systems.
+  /// When enabled, the systems which do not conflict with each other (see System::conflictsWith()) are updated in parallel on the default thread pool;
+  ///   the conflicting ones are updated following the systems' order. Systems requiring the main thread are always updated on the calling one.
+  /// \note Systems updated concurrently must not add or remove entities, nor add or remove components.
+  /// \param enabled True if the systems should be updated in parallel, false otherwise.
+  void enableParallelUpdate(bool enabled = true) noexcept { m_isParallelUpdateEnabled = enabled; }
+  /// Enables or disables the frame pipelining, allowing the simulation of a frame to be executed while the previous one is being rendered.
+  /// When enabled, each update first waits for the previous frame's simulation to be finished, refreshes the world & lets the systems requiring
+  ///   the main thread capture the state they need (see System::captureFrame()). The other systems are then updated on the default thread pool,
+  ///   while those requiring the main thread are updated on the calling one, only working from their captured state; their costs thus overlap.
+  ///   The simulated systems are updated one after the other, even if the parallel update is enabled.
+  /// \note Until the simulation is finished (see waitForSimulation()), the systems requiring the main thread & any callback they execute must
+  ///   neither modify the components used by the others nor add or remove entities, components or systems; the world must not be refreshed either.
+  /// \note If using Emscripten, the world is updated as if the pipelining was disabled, threads being unsupported with it for now.
+  /// \param enabled True if the frames should be pipelined, false otherwise.
+  void enableFramePipelining(bool enabled = true) noexcept { m_isFramePipeliningEnabled = enabled; }
+  /// Waits for the simulation launched by the last pipelined update to be finished, helping executing the default thread pool's actions meanwhile.
+  /// Any exception thrown by a system during the simulation is rethrown here.
+  void waitForSimulation();
   /// Updates the world, updating all the systems it contains.
+  /// The systems using the default step time execute the given number of fixed steps; those having their own step rate (see System::setStepRate())
+  ///   execute as many as fit in their own remaining time, up to the given maximum.
+  /// \param timeInfo Time information of the current frame, usually computed by the Application.
+  /// \return True if the world still has active systems, false otherwise.
+  bool update(const FrameTimeInfo& timeInfo);
+  /// Updates the world, updating all the systems it contains.
+  /// The number of default fixed steps to execute is computed from the time accumulated by the world, without any maximum.
   /// \param deltaTime Time elapsed since the last update.
   /// \return True if the world still has active systems, false otherwise.
   bool update(float deltaTime);
   /// Refreshes the world, optimizing the entities & linking/unlinking entities to systems if needed.
+  /// The commands recorded in the command buffers are applied first (see getCommandBuffer()).
+  /// Only the entities which have been added, modified or enabled since the last refresh are then checked.
   void refresh();
   /// Destroys the world, releasing all its entities & systems.
   void destroy();
 
   World& operator=(const World&) = delete;
-  World& operator=(World&&) noexcept = default;
+  World& operator=(World&& world) noexcept;
 
   ~World() { destroy(); }
 
 private:
-  /// Sorts entities so that the disabled ones are packed to the end of the list.
-  void sortEntities();
+  struct EntitySlot {
+    Entity* entity {}; ///< Entity currently using the slot, or nullptr if it is free.
+    std::size_t position {}; ///< Position of the entity in the list of entities.
+    uint32_t generation {}; ///< Number of entities which have used the slot before the current one.
+  };
+
+  /// Swaps two entities in the list of entities.
+  /// \param firstPosition Position of the first entity to be swapped.
+  /// \param secondPosition Position of the second entity to be swapped.
+  void swapEntities(std::size_t firstPosition, std::size_t secondPosition) noexcept;
+  /// Moves the given entity so that the enabled entities remain packed at the front of the list, and the disabled ones at the end.
+  /// \param entity Entity whose enabled state may have changed.
+  void repositionEntity(const Entity& entity) noexcept;
+  /// Links the given entity to the systems it should be processed by, and unlinks it from those it should not be anymore.
+  /// \param entity Entity to be checked.
+  /// \param relinkedSystems Bitset in which are enabled the bits of the systems whose linked entities have changed.
+  void refreshEntity(Entity& entity, Bitset& relinkedSystems);
+  /// Applies the commands recorded in all the threads' command buffers.
+  /// \param relinkedSystems Bitset in which are enabled the bits of the systems whose linked entities have changed, notably through entities' removal.
+  void executeCommandBuffers(Bitset& relinkedSystems);
+  /// Notifies the given systems that their linked entities have changed (see System::onLinkedEntitiesChanged()).
+  /// \param relinkedSystems Bitset in which are enabled the bits of the systems to be notified.
+  void notifyRelinkedSystems(const Bitset& relinkedSystems);
+  /// Updates the given system, executing as many fixed steps as it needs.
+  /// \param system System to be updated.
+  /// \param timeInfo Time information of the current frame.
+  /// \return True if the system is still active, false otherwise.
+  static bool updateSystem(System& system, const FrameTimeInfo& timeInfo);
+  /// Updates the active systems concurrently, grouping them in successive levels so that a system never runs alongside one it conflicts with.
+  /// \param timeInfo Time information of the current frame.
+  void updateSystemsInParallel(const FrameTimeInfo& timeInfo);
+  /// Captures the frame's state for the systems requiring the main thread, then launches the simulation of the others on the default thread pool
+  ///   while updating the former on the calling thread.
+  /// \param timeInfo Time information of the current frame.
+  void updateSystemsPipelined(const FrameTimeInfo& timeInfo);
+  /// Calls the given action on every view kept up to date by the world, which includes those registered by its systems.
+  /// \tparam FuncT Type of the action to be called.
+  /// \param action Action to be called, taking a reference to a view as parameter.
+  template <typename FuncT> void forEachView(FuncT&& action);
 
   std::vector<SystemPtr> m_systems {};
   Bitset m_activeSystems {};
 
-  std::vector<EntityPtr> m_entities {};
+  // The entities are declared before their components' storage, so that they are released first when moving another world into this one
+  PagedPool<Entity> m_entityPool {}; ///< Storage of the entities themselves, which remain at the same memory location during their whole lifetime.
+  std::unique_ptr<ComponentStorage> m_componentStorage = std::make_unique<ComponentStorage>();
+
+  std::vector<Entity*> m_entities {}; ///< Entities of the world, the enabled ones being packed at the front.
   std::size_t m_activeEntityCount = 0;
-  std::size_t m_maxEntityIndex = 0;
+  std::vector<EntitySlot> m_entitySlots {}; ///< Slots indexed by the entities' IDs.
+  std::vector<std::size_t> m_freeEntityIndices {}; ///< Slots freed by the removed entities, which can be given to new ones.
+
+  std::vector<std::unique_ptr<ViewBase>> m_views {};
+
+  std::vector<EntityHandle> m_dirtyEntities {}; ///< Entities which have been added, modified or enabled since the last refresh.
+  std::vector<EntityHandle> m_refreshedEntities {}; ///< Entities being refreshed, kept to avoid reallocating a list on each refresh.
+
+  struct CommandBufferEntry {
+    std::size_t systemIndex {}; ///< Index of the system owning the buffer, or the maximum value if owned by a thread.
+    std::thread::id threadId {}; ///< Thread having requested the buffer.
+    std::unique_ptr<CommandBuffer> commandBuffer {};
+  };
+
+  std::vector<CommandBufferEntry> m_commandBuffers {}; ///< Command buffer of each system & thread which requested one.
+  std::mutex m_commandBuffersMutex {};
+  Bitset* m_relinkedSystems = nullptr; ///< Systems to be notified once the command buffers being executed are done, if any.
+
+  float m_remainingTime {}; ///< Extra time remaining after executing the default fixed steps, when the world computes them itself.
+  bool m_isParallelUpdateEnabled = false;
 
-  float m_remainingTime {}; ///< Extra time remaining after executing the systems' fixed step update.
+  bool m_isFramePipeliningEnabled = false;
+  std::future<std::vector<std::size_t>> m_pendingSimulation {}; ///< Simulation launched by the last pipelined update, giving the systems which became inactive.
 };
 
 } // namespace Raz
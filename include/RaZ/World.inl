@@ -14,6 +14,15 @@ Sys& World::addSystem(Args&&... args) {
   m_systems[sysId] = std::make_unique<Sys>(std::forward<Args>(args)...);
   m_activeSystems.setBit(sysId);
 
+  // The already existing entities must be checked against the new system on the next refresh
+  // Its views, if any, are populated right away
+  for (Entity* entity : m_entities) {
+    entity->markDirty();
+
+    for (ViewBase* view : m_systems[sysId]->m_views)
+      view->refreshEntity(*entity);
+  }
+
   return static_cast<Sys&>(*m_systems[sysId]);
 }
 
@@ -59,18 +68,55 @@ Entity& World::addEntityWithComponents(bool enabled) {
   return entity;
 }
 
+template <typename... Comps>
+View<Comps...>& World::view() {
+  using ViewT = View<Comps...>;
+
+  const std::size_t viewId = ViewBase::getId<ViewT>();
+
+  if (viewId >= m_views.size())
+    m_views.resize(viewId + 1);
+
+  if (m_views[viewId] == nullptr) {
+    auto view = std::make_unique<ViewT>();
+
+    for (Entity* entity : m_entities)
+      view->refreshEntity(*entity);
+
+    m_views[viewId] = std::move(view);
+  }
+
+  return static_cast<ViewT&>(*m_views[viewId]);
+}
+
 template <typename... Comps>
 std::vector<Entity*> World::recoverEntitiesWithComponents() {
   static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: Components to query the entity with must all be derived from Component.");
 
   std::vector<Entity*> entities;
 
-  for (const EntityPtr& entity : m_entities) {
+  for (Entity* entity : m_entities) {
     if ((entity->hasComponent<Comps>() && ...))
-      entities.emplace_back(entity.get());
+      entities.emplace_back(entity);
   }
 
   return entities;
 }
 
+template <typename FuncT>
+void World::forEachView(FuncT&& action) {
+  for (const std::unique_ptr<ViewBase>& view : m_views) {
+    if (view)
+      action(*view);
+  }
+
+  for (const SystemPtr& system : m_systems) {
+    if (system == nullptr)
+      continue;
+
+    for (ViewBase* view : system->m_views)
+      action(*view);
+  }
+}
+
 } // namespace Raz
@@ -1,12 +1,32 @@
 #include "RaZ/Application.hpp"
 #include "RaZ/Utils/Logger.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
 
 #if defined(RAZ_PLATFORM_EMSCRIPTEN)
 #include <emscripten.h>
 #endif
 
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+
 namespace Raz {
 
+void Application::setFixedTimeStep(float fixedTimeStep) {
+  if (fixedTimeStep <= 0.f)
+    throw std::invalid_argument("Error: The fixed time step must be strictly positive.");
+
+  m_timeInfo.substepTime = fixedTimeStep;
+}
+
+void Application::setMaxSubstepCount(std::size_t maxSubstepCount) {
+  if (maxSubstepCount == 0)
+    throw std::invalid_argument("Error: The maximum substep count must be strictly positive.");
+
+  m_timeInfo.maxSubstepCount = maxSubstepCount;
+}
+
 void Application::run() {
   Logger::debug("[Application] Running...");
 
@@ -22,19 +42,113 @@ void Application::run() {
 }
 
 bool Application::runOnce() {
-  const auto currentTime = std::chrono::system_clock::now();
-  m_deltaTime            = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
+  // A steady clock is used, since the system one may go backward or jump forward if the system time is adjusted
+  const auto currentTime = std::chrono::steady_clock::now();
+  m_timeInfo.deltaTime   = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
   m_lastFrameTime        = currentTime;
 
+  m_remainingTime              += m_timeInfo.deltaTime;
+  m_timeInfo.substepCount       = consumeFixedSteps(m_remainingTime, m_timeInfo.substepTime, m_timeInfo.maxSubstepCount);
+  m_timeInfo.interpolationAlpha = m_remainingTime / m_timeInfo.substepTime;
+
+  m_worldUpdateTimes.resize(m_worlds.size());
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  if (m_isParallelUpdateEnabled) {
+    updateWorldsInParallel();
+    return m_isRunning && !m_activeWorlds.isEmpty();
+  }
+#endif
+
   for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
     if (!m_activeWorlds[worldIndex])
       continue;
 
-    if (!m_worlds[worldIndex].update(m_deltaTime))
+    if (!updateWorld(worldIndex))
       m_activeWorlds.setBit(worldIndex, false);
   }
 
   return m_isRunning && !m_activeWorlds.isEmpty();
 }
 
+bool Application::updateWorld(std::size_t worldIndex) {
+  const auto updateStartTime = std::chrono::steady_clock::now();
+  const bool isWorldActive   = m_worlds[worldIndex].update(m_timeInfo);
+  m_worldUpdateTimes[worldIndex] = std::chrono::duration<float>(std::chrono::steady_clock::now() - updateStartTime).count();
+
+  return isWorldActive;
+}
+
+void Application::updateWorldsInParallel() {
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  std::vector<std::size_t> poolWorldIndices;
+  std::vector<std::size_t> callerWorldIndices;
+
+  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+    if (!m_activeWorlds[worldIndex])
+      continue;
+
+    (m_worlds[worldIndex].requiresMainThread() ? callerWorldIndices : poolWorldIndices).emplace_back(worldIndex);
+  }
+
+  // If no world must be updated on the calling thread, the latter still updates one instead of just waiting
+  if (callerWorldIndices.empty() && !poolWorldIndices.empty()) {
+    callerWorldIndices.emplace_back(poolWorldIndices.back());
+    poolWorldIndices.pop_back();
+  }
+
+  std::vector<std::promise<bool>> promises(poolWorldIndices.size());
+  std::vector<std::future<bool>> futures;
+  futures.reserve(poolWorldIndices.size());
+
+  ThreadPool& threadPool = Threading::getDefaultThreadPool();
+
+  for (std::size_t i = 0; i < poolWorldIndices.size(); ++i) {
+    futures.emplace_back(promises[i].get_future());
+
+    threadPool.addAction([this, &promise = promises[i], worldIndex = poolWorldIndices[i]] () {
+      try {
+        promise.set_value(updateWorld(worldIndex));
+      } catch (...) {
+        promise.set_exception(std::current_exception());
+      }
+    });
+  }
+
+  // All the worlds must be updated & their results recorded before any exception is rethrown, so that none of them is left active wrongly
+  std::exception_ptr firstException;
+
+  for (const std::size_t worldIndex : callerWorldIndices) {
+    try {
+      if (!updateWorld(worldIndex))
+        m_activeWorlds.setBit(worldIndex, false);
+    } catch (...) {
+      if (!firstException)
+        firstException = std::current_exception();
+    }
+  }
+
+  // Waiting for all worlds to be updated, so that none is still being updated when returning; the pool's actions are executed meanwhile
+  threadPool.executeUntil([&futures] () {
+    return std::all_of(futures.cbegin(), futures.cend(), [] (const std::future<bool>& future) {
+      return (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    });
+  });
+
+  for (std::size_t i = 0; i < futures.size(); ++i) {
+    try {
+      if (!futures[i].get())
+        m_activeWorlds.setBit(poolWorldIndices[i], false);
+    } catch (...) {
+      if (!firstException)
+        firstException = std::current_exception();
+    }
+  }
+
+  // If any world has thrown an exception, the first one is rethrown here
+  if (firstException)
+    std::rethrow_exception(firstException);
+#endif
+}
+
 } // namespace Raz
@@ -36,6 +36,8 @@ inline void checkError(void* device, const std::string& errorMsg) {
 
 AudioSystem::AudioSystem(const char* deviceName) {
   registerComponents<Sound, Listener>();
+  registerReadComponents<Transform>();
+  registerWrittenComponents<Sound, Listener>();
   openDevice(deviceName);
 }
 
@@ -0,0 +1,60 @@
+#include "RaZ/CommandBuffer.hpp"
+#include "RaZ/World.hpp"
+
+#include <cassert>
+
+namespace Raz {
+
+CommandBuffer::PendingEntity CommandBuffer::addEntity(bool enabled) {
+  recordCommand([enabled] (World& world, std::vector<EntityHandle>& createdEntities) {
+    createdEntities.emplace_back(world.addEntity(enabled).getHandle());
+  });
+
+  return PendingEntity{ m_pendingEntityCount++ };
+}
+
+void CommandBuffer::removeEntity(EntityRef entity) {
+  recordCommand([entity] (World& world, std::vector<EntityHandle>& createdEntities) {
+    const Entity* targetEntity = recoverEntity(world, entity, createdEntities);
+
+    if (targetEntity != nullptr)
+      world.removeEntity(targetEntity->getHandle());
+  });
+}
+
+void CommandBuffer::enableEntity(EntityRef entity, bool enabled) {
+  recordCommand([entity, enabled] (World& world, std::vector<EntityHandle>& createdEntities) {
+    Entity* targetEntity = recoverEntity(world, entity, createdEntities);
+
+    if (targetEntity != nullptr)
+      targetEntity->enable(enabled);
+  });
+}
+
+void CommandBuffer::execute(World& world) {
+  std::vector<EntityHandle> createdEntities;
+  createdEntities.reserve(m_pendingEntityCount);
+
+  // The commands are moved out before being executed, so that the buffer can be safely recorded into again from one of them
+  const std::vector<std::unique_ptr<Command>> commands = std::move(m_commands);
+  clear();
+
+  for (const std::unique_ptr<Command>& command : commands)
+    command->execute(world, createdEntities);
+}
+
+void CommandBuffer::clear() noexcept {
+  m_commands.clear();
+  m_pendingEntityCount = 0;
+}
+
+Entity* CommandBuffer::recoverEntity(World& world, const EntityRef& entity, const std::vector<EntityHandle>& createdEntities) {
+  if (const auto* pendingEntity = std::get_if<PendingEntity>(&entity)) {
+    assert("Error: The pending entity has not been created by this buffer." && pendingEntity->index < createdEntities.size());
+    return world.recoverEntity(createdEntities[pendingEntity->index]);
+  }
+
+  return world.recoverEntity(std::get<EntityHandle>(entity));
+}
+
+} // namespace Raz
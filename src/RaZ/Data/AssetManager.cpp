@@ -0,0 +1,310 @@
+#include "RaZ/Data/AssetManager.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Data/ImageFormat.hpp"
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Data/ObjFormat.hpp"
+#include "RaZ/Render/MeshRenderer.hpp"
+#include "RaZ/Render/UploadQueue.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace Raz {
+
+namespace {
+
+template <typename T>
+std::shared_future<T> makeReadyFuture(T value) {
+  std::promise<T> promise;
+  promise.set_value(std::move(value));
+
+  return promise.get_future().share();
+}
+
+std::size_t computeMemorySize(const Image& image) {
+  const std::size_t channelSize = (image.getDataType() == ImageDataType::FLOAT ? sizeof(float) : sizeof(uint8_t));
+  return static_cast<std::size_t>(image.getWidth()) * image.getHeight() * image.getChannelCount() * channelSize;
+}
+
+std::size_t computeMemorySize(const ObjFormat::ObjData& objData) {
+  std::size_t memorySize = 0;
+
+  for (const Submesh& submesh : objData.mesh.getSubmeshes()) {
+    memorySize += submesh.getVertexCount() * sizeof(Vertex);
+    memorySize += (submesh.getLineIndexCount() + submesh.getTriangleIndexCount()) * sizeof(unsigned int);
+  }
+
+  return memorySize;
+}
+
+} // namespace
+
+float AssetManager::getProgress() const noexcept {
+  // The finished count is read first, so that it can never be greater than the requested one read afterward
+  const std::size_t finishedTaskCount  = getFinishedTaskCount();
+  const std::size_t requestedTaskCount = getRequestedTaskCount();
+
+  return (requestedTaskCount == 0 ? 1.f : static_cast<float>(finishedTaskCount) / static_cast<float>(requestedTaskCount));
+}
+
+std::shared_future<ImageConstPtr> AssetManager::loadImage(const FilePath& filePath, bool flipVertically) {
+  std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+  return requestImage(filePath, flipVertically).asset;
+}
+
+std::shared_future<Texture2DPtr> AssetManager::loadTexture(const FilePath& filePath, bool flipVertically) {
+  std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+  return requestTexture(filePath, flipVertically).asset;
+}
+
+std::shared_future<ObjDataConstPtr> AssetManager::loadMeshData(const FilePath& filePath) {
+  std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+  return requestMeshData(filePath).asset;
+}
+
+std::future<std::pair<Mesh, MeshRenderer>> AssetManager::loadMesh(const FilePath& filePath) {
+  auto promise = std::make_shared<std::promise<std::pair<Mesh, MeshRenderer>>>();
+  std::future<std::pair<Mesh, MeshRenderer>> mesh = promise->get_future();
+
+  PendingAsset<ObjDataConstPtr> meshData;
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+    meshData = requestMeshData(filePath);
+  }
+
+  // Creating the mesh
+  m_requestedTaskCount.fetch_add(1, std::memory_order_acq_rel);
+
+  m_jobSystem.addContinuation(meshData.job, [this, meshData = std::move(meshData.asset), promise = std::move(promise)] () {
+    ObjDataConstPtr objData;
+
+    try {
+      objData = meshData.get();
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+      finishTasks();
+      return;
+    }
+
+    // The textures are requested like any other, so that they are loaded in parallel & shared with the other assets referencing them
+    auto textures = std::make_shared<std::unordered_map<FilePath, std::shared_future<Texture2DPtr>>>();
+    std::vector<JobHandle> imageJobs;
+
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+
+      for (const ObjFormat::MaterialData& material : objData->materials) {
+        for (const auto& texture : material.textures) {
+          if (textures->find(texture.second) != textures->cend())
+            continue;
+
+          PendingAsset<Texture2DPtr> pendingTexture = requestTexture(texture.second, true);
+          imageJobs.emplace_back(std::move(pendingTexture.job));
+          textures->emplace(texture.second, std::move(pendingTexture.asset));
+        }
+      }
+    }
+
+    m_jobSystem.addJob([this, objData = std::move(objData), textures = std::move(textures), promise] () {
+      m_uploadQueue.push([this, objData, textures, promise] () {
+        try {
+          promise->set_value(ObjFormat::createMesh(*objData, [this, &textures] (const FilePath& texturePath) {
+            const std::shared_future<Texture2DPtr>& texture = textures->at(texturePath);
+
+            // The texture may not have been created yet, its upload coming after the mesh's in the queue
+            if (texture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+              createTexture(computeImageKey(texturePath, true));
+
+            return texture.get();
+          }));
+        } catch (...) {
+          promise->set_exception(std::current_exception());
+        }
+
+        finishTasks();
+      });
+    }, imageJobs);
+  });
+
+  return mesh;
+}
+
+void AssetManager::finishLoading() {
+  while (isLoading()) {
+    if (m_uploadQueue.executeAll() == 0 && !m_threadPool.executePendingAction())
+      std::this_thread::yield();
+  }
+}
+
+std::string AssetManager::computeImageKey(const FilePath& filePath, bool flipVertically) {
+  return (flipVertically ? "[flipped] " + filePath.toUtf8() : filePath.toUtf8());
+}
+
+AssetManager::PendingAsset<ImageConstPtr> AssetManager::requestImage(const FilePath& filePath, bool flipVertically) {
+  std::string key = computeImageKey(filePath, flipVertically);
+
+  if (const auto pendingIter = m_pendingImages.find(key); pendingIter != m_pendingImages.cend())
+    return pendingIter->second;
+
+  if (ImageConstPtr image = m_imageCache.find(key))
+    return { JobHandle(), makeReadyFuture(std::move(image)) };
+
+  auto promise = std::make_shared<std::promise<ImageConstPtr>>();
+  PendingAsset<ImageConstPtr> pendingImage { JobHandle(), promise->get_future().share() };
+  m_pendingImages.emplace(key, pendingImage);
+
+  m_requestedTaskCount.fetch_add(1, std::memory_order_acq_rel);
+
+  pendingImage.job = m_jobSystem.addJob([this, filePath, flipVertically, key, promise = std::move(promise)] () {
+    ImageConstPtr image;
+
+    try {
+      image = std::make_shared<const Image>(ImageFormat::load(filePath, flipVertically));
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+
+      if (image)
+        m_imageCache.insert(key, image, computeMemorySize(*image));
+
+      m_pendingImages.erase(key);
+    }
+
+    if (image)
+      promise->set_value(std::move(image));
+
+    finishTasks();
+  });
+
+  // The job may already be finished if executed right away, in which case the image is not pending anymore
+  if (const auto pendingIter = m_pendingImages.find(key); pendingIter != m_pendingImages.end())
+    pendingIter->second.job = pendingImage.job;
+
+  return pendingImage;
+}
+
+AssetManager::PendingAsset<Texture2DPtr> AssetManager::requestTexture(const FilePath& filePath, bool flipVertically) {
+  std::string key = computeImageKey(filePath, flipVertically);
+
+  if (const auto pendingIter = m_pendingTextures.find(key); pendingIter != m_pendingTextures.cend())
+    return { pendingIter->second.image.job, pendingIter->second.texture };
+
+  if (Texture2DPtr texture = m_textureCache.find(key))
+    return { JobHandle(), makeReadyFuture(std::move(texture)) };
+
+  PendingTexture& pendingTexture = m_pendingTextures[key];
+  pendingTexture.image   = requestImage(filePath, flipVertically);
+  pendingTexture.promise = std::make_shared<std::promise<Texture2DPtr>>();
+  pendingTexture.texture = pendingTexture.promise->get_future().share();
+
+  PendingAsset<Texture2DPtr> result { pendingTexture.image.job, pendingTexture.texture };
+
+  m_requestedTaskCount.fetch_add(1, std::memory_order_acq_rel);
+
+  // The texture may have already been created by then if a mesh referencing it has been uploaded first, in which case this only finishes the task.
+  //  The task is finished by the upload itself in any case, so that the manager is never destroyed while the latter is still pending
+  m_jobSystem.addContinuation(result.job, [this, key = std::move(key)] () {
+    m_uploadQueue.push([this, key] () {
+      createTexture(key);
+      finishTasks();
+    });
+  });
+
+  return result;
+}
+
+AssetManager::PendingAsset<ObjDataConstPtr> AssetManager::requestMeshData(const FilePath& filePath) {
+  std::string key = filePath.toUtf8();
+
+  if (const auto pendingIter = m_pendingMeshData.find(key); pendingIter != m_pendingMeshData.cend())
+    return pendingIter->second;
+
+  if (ObjDataConstPtr objData = m_meshDataCache.find(key))
+    return { JobHandle(), makeReadyFuture(std::move(objData)) };
+
+  auto promise = std::make_shared<std::promise<ObjDataConstPtr>>();
+  PendingAsset<ObjDataConstPtr> pendingMeshData { JobHandle(), promise->get_future().share() };
+  m_pendingMeshData.emplace(key, pendingMeshData);
+
+  m_requestedTaskCount.fetch_add(1, std::memory_order_acq_rel);
+
+  pendingMeshData.job = m_jobSystem.addJob([this, filePath, key, promise = std::move(promise)] () {
+    ObjDataConstPtr objData;
+
+    try {
+      objData = std::make_shared<const ObjFormat::ObjData>(ObjFormat::loadData(filePath));
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+
+      if (objData)
+        m_meshDataCache.insert(key, objData, computeMemorySize(*objData));
+
+      m_pendingMeshData.erase(key);
+    }
+
+    if (objData)
+      promise->set_value(std::move(objData));
+
+    finishTasks();
+  });
+
+  if (const auto pendingIter = m_pendingMeshData.find(key); pendingIter != m_pendingMeshData.end())
+    pendingIter->second.job = pendingMeshData.job;
+
+  return pendingMeshData;
+}
+
+void AssetManager::createTexture(const std::string& key) {
+  std::shared_ptr<std::promise<Texture2DPtr>> promise;
+  std::shared_future<ImageConstPtr> image;
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+
+    const auto pendingIter = m_pendingTextures.find(key);
+
+    if (pendingIter == m_pendingTextures.end())
+      return;
+
+    promise = pendingIter->second.promise;
+    image   = pendingIter->second.image.asset;
+  }
+
+  Texture2DPtr texture;
+  std::size_t memorySize = 0;
+
+  try {
+    const ImageConstPtr& textureImage = image.get();
+    texture = Texture2D::create(*textureImage, true);
+    memorySize = computeMemorySize(*textureImage) * 4 / 3; // Accounting for the mipmaps
+  } catch (...) {
+    promise->set_exception(std::current_exception());
+  }
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_assetsMutex);
+
+    if (texture)
+      m_textureCache.insert(key, texture, memorySize);
+
+    m_pendingTextures.erase(key);
+  }
+
+  if (texture)
+    promise->set_value(std::move(texture));
+}
+
+} // namespace Raz
+
+#endif // RAZ_THREADS_AVAILABLE
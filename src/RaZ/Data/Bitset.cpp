@@ -1,44 +1,300 @@
 #include "RaZ/Data/Bitset.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <ostream>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAZ_BITSET_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(RAZ_COMPILER_MSVC)
+#include <intrin.h>
+#endif
 
 namespace Raz {
 
+namespace {
+
+enum class WordOperation {
+  AND,
+  OR,
+  XOR
+};
+
+inline std::size_t countEnabledBits(uint64_t word) noexcept {
+#if defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#elif defined(RAZ_COMPILER_MSVC) && defined(_M_X64)
+  return static_cast<std::size_t>(__popcnt64(word));
+#else
+  std::size_t count = 0;
+
+  for (; word != 0; ++count)
+    word &= word - 1; // Disabling the lowest enabled bit
+
+  return count;
+#endif
+}
+
+inline std::size_t countTrailingZeros(uint64_t word) noexcept {
+  assert("Error: The number of trailing zeros of an empty word is undefined." && word != 0);
+
+#if defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#elif defined(RAZ_COMPILER_MSVC) && defined(_M_X64)
+  unsigned long index {};
+  _BitScanForward64(&index, word);
+  return index;
+#else
+  std::size_t count = 0;
+
+  for (; (word & 1) == 0; ++count)
+    word >>= 1;
+
+  return count;
+#endif
+}
+
+#if defined(RAZ_BITSET_USE_SSE2)
+inline __m128i loadWords(const uint64_t* words) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(words))); }
+inline void storeWords(uint64_t* words, __m128i values) noexcept { _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(words)), values); }
+#endif
+
+/// Applies the given operation on each word, storing the result in the first ones.
+/// Larger bitsets are processed several words at once when SIMD instructions are available.
+template <WordOperation Op>
+void applyOperation(uint64_t* words, const uint64_t* otherWords, std::size_t wordCount) noexcept {
+  std::size_t wordIndex = 0;
+
+#if defined(RAZ_BITSET_USE_SSE2)
+  for (; wordIndex + 2 <= wordCount; wordIndex += 2) {
+    const __m128i values      = loadWords(words + wordIndex);
+    const __m128i otherValues = loadWords(otherWords + wordIndex);
+
+    if constexpr (Op == WordOperation::AND)
+      storeWords(words + wordIndex, _mm_and_si128(values, otherValues));
+    else if constexpr (Op == WordOperation::OR)
+      storeWords(words + wordIndex, _mm_or_si128(values, otherValues));
+    else
+      storeWords(words + wordIndex, _mm_xor_si128(values, otherValues));
+  }
+#endif
+
+  for (; wordIndex < wordCount; ++wordIndex) {
+    if constexpr (Op == WordOperation::AND)
+      words[wordIndex] &= otherWords[wordIndex];
+    else if constexpr (Op == WordOperation::OR)
+      words[wordIndex] |= otherWords[wordIndex];
+    else
+      words[wordIndex] ^= otherWords[wordIndex];
+  }
+}
+
+} // namespace
+
+Bitset::Bitset(std::size_t bitCount, bool initVal) {
+  resize(bitCount);
+
+  if (initVal) {
+    std::fill_n(getWords(), getWordCount(), ~uint64_t(0));
+    clearUnusedBits();
+  }
+}
+
+Bitset::Bitset(std::initializer_list<bool> values) {
+  resize(values.size());
+
+  std::size_t bitIndex = 0;
+
+  for (const bool value : values) {
+    if (value)
+      setBit(bitIndex);
+
+    ++bitIndex;
+  }
+}
+
+Bitset::Bitset(const Bitset& bitset) {
+  resize(bitset.m_bitCount);
+  std::copy_n(bitset.getWords(), bitset.getWordCount(), getWords());
+}
+
+Bitset::Bitset(Bitset&& bitset) noexcept
+  : m_bitCount{ std::exchange(bitset.m_bitCount, 0) },
+    m_wordCapacity{ std::exchange(bitset.m_wordCapacity, inlineWordCount) },
+    m_heapWords{ std::move(bitset.m_heapWords) } {
+  std::copy_n(bitset.m_inlineWords, inlineWordCount, m_inlineWords);
+  std::fill_n(bitset.m_inlineWords, inlineWordCount, 0);
+}
+
+std::vector<bool> Bitset::getBits() const {
+  std::vector<bool> bits(m_bitCount);
+
+  for (std::size_t bitIndex = 0; bitIndex < m_bitCount; ++bitIndex)
+    bits[bitIndex] = (*this)[bitIndex];
+
+  return bits;
+}
+
+bool Bitset::isEmpty() const noexcept {
+  const uint64_t* words = getWords();
+  return std::all_of(words, words + getWordCount(), [] (uint64_t word) { return (word == 0); });
+}
+
+std::size_t Bitset::getEnabledBitCount() const noexcept {
+  const uint64_t* words = getWords();
+  std::size_t count     = 0;
+
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex)
+    count += countEnabledBits(words[wordIndex]);
+
+  return count;
+}
+
+std::size_t Bitset::findFirstEnabledBit(std::size_t startPosition) const noexcept {
+  if (startPosition >= m_bitCount)
+    return m_bitCount;
+
+  const uint64_t* words = getWords();
+  std::size_t wordIndex = startPosition / wordBitCount;
+
+  // The bits before the start position are ignored in the first word
+  uint64_t word = words[wordIndex] & (~uint64_t(0) << (startPosition % wordBitCount));
+
+  while (word == 0) {
+    if (++wordIndex == getWordCount())
+      return m_bitCount;
+
+    word = words[wordIndex];
+  }
+
+  return wordIndex * wordBitCount + countTrailingZeros(word);
+}
+
+bool Bitset::andAny(const Bitset& bitset) const noexcept {
+  const uint64_t* words      = getWords();
+  const uint64_t* otherWords = bitset.getWords();
+  const std::size_t wordCount = std::min(getWordCount(), bitset.getWordCount());
+
+  std::size_t wordIndex = 0;
+
+#if defined(RAZ_BITSET_USE_SSE2)
+  for (; wordIndex + 2 <= wordCount; wordIndex += 2) {
+    const __m128i commonValues = _mm_and_si128(loadWords(words + wordIndex), loadWords(otherWords + wordIndex));
+
+    // If all bytes are equal to 0, the mask has all its 16 bits set
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(commonValues, _mm_setzero_si128())) != 0xFFFF)
+      return true;
+  }
+#endif
+
+  for (; wordIndex < wordCount; ++wordIndex) {
+    if ((words[wordIndex] & otherWords[wordIndex]) != 0)
+      return true;
+  }
+
+  return false;
+}
+
+bool Bitset::isSubsetOf(const Bitset& bitset) const noexcept {
+  const uint64_t* words      = getWords();
+  const uint64_t* otherWords = bitset.getWords();
+  const std::size_t commonWordCount = std::min(getWordCount(), bitset.getWordCount());
+
+  for (std::size_t wordIndex = 0; wordIndex < commonWordCount; ++wordIndex) {
+    if ((words[wordIndex] & ~otherWords[wordIndex]) != 0)
+      return false;
+  }
+
+  // Any bit enabled past the other bitset's size is not part of it
+  return std::all_of(words + commonWordCount, words + getWordCount(), [] (uint64_t word) { return (word == 0); });
+}
+
 void Bitset::setBit(std::size_t position, bool value) {
-  if (position >= m_bits.size())
-    m_bits.resize(position + 1);
+  if (position >= m_bitCount)
+    resize(position + 1);
+
+  const uint64_t bitMask = uint64_t(1) << (position % wordBitCount);
+  uint64_t& word         = getWords()[position / wordBitCount];
+
+  word = (value ? (word | bitMask) : (word & ~bitMask));
+}
+
+void Bitset::resize(std::size_t newSize) {
+  const std::size_t oldWordCount = getWordCount();
+  const std::size_t newWordCount = computeWordCount(newSize);
+
+  reserveWords(newWordCount);
 
-  m_bits[position] = value;
+  // The words past the new size may have been used before shrinking; they must be reset so that the unused bits remain disabled
+  if (newWordCount > oldWordCount)
+    std::fill(getWords() + oldWordCount, getWords() + newWordCount, 0);
+
+  m_bitCount = newSize;
+  clearUnusedBits();
+}
+
+void Bitset::reset() noexcept {
+  std::fill_n(getWords(), getWordCount(), 0);
+}
+
+Bitset& Bitset::operator=(const Bitset& bitset) {
+  if (&bitset == this)
+    return *this;
+
+  resize(bitset.m_bitCount);
+  std::copy_n(bitset.getWords(), bitset.getWordCount(), getWords());
+
+  return *this;
+}
+
+Bitset& Bitset::operator=(Bitset&& bitset) noexcept {
+  if (&bitset == this)
+    return *this;
+
+  m_bitCount     = std::exchange(bitset.m_bitCount, 0);
+  m_wordCapacity = std::exchange(bitset.m_wordCapacity, inlineWordCount);
+  m_heapWords    = std::move(bitset.m_heapWords);
+  std::copy_n(bitset.m_inlineWords, inlineWordCount, m_inlineWords);
+  std::fill_n(bitset.m_inlineWords, inlineWordCount, 0);
+
+  return *this;
 }
 
-Bitset Bitset::operator~() const noexcept {
+Bitset Bitset::operator~() const {
   Bitset res = *this;
 
-  for (auto bit : res.getBits())
-    bit = !bit;
+  uint64_t* words = res.getWords();
+  for (std::size_t wordIndex = 0; wordIndex < res.getWordCount(); ++wordIndex)
+    words[wordIndex] = ~words[wordIndex];
 
+  res.clearUnusedBits();
   return res;
 }
 
-Bitset Bitset::operator&(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+Bitset Bitset::operator&(const Bitset& bitset) const {
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res &= bitset;
   return res;
 }
 
-Bitset Bitset::operator|(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+Bitset Bitset::operator|(const Bitset& bitset) const {
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res |= bitset;
   return res;
 }
 
-Bitset Bitset::operator^(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+Bitset Bitset::operator^(const Bitset& bitset) const {
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res ^= bitset;
   return res;
@@ -57,42 +313,107 @@ Bitset Bitset::operator>>(std::size_t shift) const {
 }
 
 Bitset& Bitset::operator&=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] && bitset[bitIndex];
+  const std::size_t commonBitCount  = std::min(m_bitCount, bitset.getSize());
+  const std::size_t commonWordCount = computeWordCount(commonBitCount);
+
+  if (commonWordCount == 0)
+    return *this;
+
+  // Only the bits common to both bitsets are modified; those of this bitset past the other's size must be left untouched
+  uint64_t& lastCommonWord          = getWords()[commonWordCount - 1];
+  const uint64_t lastCommonWordCopy = lastCommonWord;
+
+  applyOperation<WordOperation::AND>(getWords(), bitset.getWords(), commonWordCount);
+
+  if (commonBitCount % wordBitCount != 0) {
+    const uint64_t commonBitMask = (uint64_t(1) << (commonBitCount % wordBitCount)) - 1;
+    lastCommonWord = (lastCommonWord & commonBitMask) | (lastCommonWordCopy & ~commonBitMask);
+  }
+
   return *this;
 }
 
 Bitset& Bitset::operator|=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] || bitset[bitIndex];
+  // The other bitset's bits past its size being disabled, they do not change this bitset's ones
+  const std::size_t commonWordCount = computeWordCount(std::min(m_bitCount, bitset.getSize()));
+  applyOperation<WordOperation::OR>(getWords(), bitset.getWords(), commonWordCount);
+
+  clearUnusedBits();
   return *this;
 }
 
 Bitset& Bitset::operator^=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] ^ bitset[bitIndex];
+  // The other bitset's bits past its size being disabled, they do not change this bitset's ones
+  const std::size_t commonWordCount = computeWordCount(std::min(m_bitCount, bitset.getSize()));
+  applyOperation<WordOperation::XOR>(getWords(), bitset.getWords(), commonWordCount);
+
+  clearUnusedBits();
   return *this;
 }
 
 Bitset& Bitset::operator<<=(std::size_t shift) {
-  m_bits.resize(m_bits.size() + shift);
+  resize(m_bitCount + shift);
   return *this;
 }
 
 Bitset& Bitset::operator>>=(std::size_t shift) {
-  m_bits.resize(m_bits.size() - shift);
+  resize(m_bitCount - shift);
   return *this;
 }
 
+bool Bitset::operator[](std::size_t index) const noexcept {
+  assert("Error: The bit index is out of the bitset's range." && index < m_bitCount);
+  return ((getWords()[index / wordBitCount] >> (index % wordBitCount)) & 1);
+}
+
+bool Bitset::operator==(const Bitset& bitset) const noexcept {
+  const std::size_t commonWordCount = std::min(getWordCount(), bitset.getWordCount());
+
+  if (!std::equal(getWords(), getWords() + commonWordCount, bitset.getWords()))
+    return false;
+
+  // The bits past the size being always disabled, the larger bitset's remaining words only need to be empty
+  const Bitset& largerBitset = (getWordCount() > commonWordCount ? *this : bitset);
+  const uint64_t* largerWords = largerBitset.getWords();
+
+  return std::all_of(largerWords + commonWordCount, largerWords + largerBitset.getWordCount(), [] (uint64_t word) { return (word == 0); });
+}
+
 std::ostream& operator<<(std::ostream& stream, const Bitset& bitset) {
-  stream << "[ " << bitset[0];
+  stream << "[ ";
 
-  for (std::size_t i = 1; i < bitset.getSize(); ++i)
-    stream << "; " << bitset[i];
+  if (bitset.getSize() > 0) {
+    stream << bitset[0];
 
-  stream << " ]";
+    for (std::size_t i = 1; i < bitset.getSize(); ++i)
+      stream << "; " << bitset[i];
+
+    stream << ' ';
+  }
+
+  stream << ']';
 
   return stream;
 }
 
+void Bitset::reserveWords(std::size_t wordCount) {
+  if (wordCount <= m_wordCapacity)
+    return;
+
+  // Growing geometrically, avoiding to reallocate on each new word
+  const std::size_t newCapacity = std::max(wordCount, m_wordCapacity * 2);
+  auto newWords = std::make_unique<uint64_t[]>(newCapacity);
+  std::copy_n(getWords(), getWordCount(), newWords.get());
+
+  m_heapWords    = std::move(newWords);
+  m_wordCapacity = newCapacity;
+}
+
+void Bitset::clearUnusedBits() noexcept {
+  const std::size_t lastWordBitCount = m_bitCount % wordBitCount;
+
+  if (lastWordBitCount != 0)
+    getWords()[getWordCount() - 1] &= (uint64_t(1) << lastWordBitCount) - 1;
+}
+
 } // namespace Raz
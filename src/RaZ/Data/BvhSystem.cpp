@@ -1,6 +1,9 @@
 #include "RaZ/Data/BvhSystem.hpp"
 #include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <limits>
 
 namespace Raz {
 
@@ -12,6 +15,18 @@ enum CutAxis {
   AXIS_Z = 2
 };
 
+AABB mergeBoundingBoxes(const AABB& firstBox, const AABB& secondBox) {
+  const float xMin = std::min(firstBox.getMinPosition().x(), secondBox.getMinPosition().x());
+  const float yMin = std::min(firstBox.getMinPosition().y(), secondBox.getMinPosition().y());
+  const float zMin = std::min(firstBox.getMinPosition().z(), secondBox.getMinPosition().z());
+
+  const float xMax = std::max(firstBox.getMaxPosition().x(), secondBox.getMaxPosition().x());
+  const float yMax = std::max(firstBox.getMaxPosition().y(), secondBox.getMaxPosition().y());
+  const float zMax = std::max(firstBox.getMaxPosition().z(), secondBox.getMaxPosition().z());
+
+  return AABB(Vec3f(xMin, yMin, zMin), Vec3f(xMax, yMax, zMax));
+}
+
 } // namespace
 
 Entity* BvhNode::query(const Ray& ray, RayHit* hit) const {
@@ -40,27 +55,25 @@ Entity* BvhNode::query(const Ray& ray, RayHit* hit) const {
 }
 
 void BvhNode::build(std::vector<TriangleInfo>& trianglesInfo, std::size_t beginIndex, std::size_t endIndex) {
-  m_boundingBox = trianglesInfo[beginIndex].triangle.computeBoundingBox();
-
   if (endIndex - beginIndex <= 1) {
+    m_boundingBox  = trianglesInfo[beginIndex].triangle.computeBoundingBox();
     m_triangleInfo = trianglesInfo[beginIndex];
     return;
   }
 
-  // TODO: wait for a parallel/reduce to be implemented in order to optimize the following loop
-  for (std::size_t i = beginIndex + 1; i < endIndex; ++i) {
-    const AABB triangleBox = trianglesInfo[i].triangle.computeBoundingBox();
+  // The bounding boxes of the triangles are merged by chunks in parallel; small ranges end up being processed in a single chunk by the calling thread
+  // The reduction starts from an inverted box, which any other box replaces when merged with it
+  constexpr std::size_t triangleGrainSize = 4096;
+  const AABB emptyBox(Vec3f(std::numeric_limits<float>::max()), Vec3f(std::numeric_limits<float>::lowest()));
 
-    const float xMin = std::min(triangleBox.getMinPosition().x(), m_boundingBox.getMinPosition().x());
-    const float yMin = std::min(triangleBox.getMinPosition().y(), m_boundingBox.getMinPosition().y());
-    const float zMin = std::min(triangleBox.getMinPosition().z(), m_boundingBox.getMinPosition().z());
+  m_boundingBox = Threading::parallelReduce(beginIndex, endIndex, emptyBox, [&trianglesInfo] (const Threading::IndexRange& range) {
+    AABB boundingBox = trianglesInfo[range.beginIndex].triangle.computeBoundingBox();
 
-    const float xMax = std::max(triangleBox.getMaxPosition().x(), m_boundingBox.getMaxPosition().x());
-    const float yMax = std::max(triangleBox.getMaxPosition().y(), m_boundingBox.getMaxPosition().y());
-    const float zMax = std::max(triangleBox.getMaxPosition().z(), m_boundingBox.getMaxPosition().z());
+    for (std::size_t i = range.beginIndex + 1; i < range.endIndex; ++i)
+      boundingBox = mergeBoundingBoxes(boundingBox, trianglesInfo[i].triangle.computeBoundingBox());
 
-    m_boundingBox = AABB(Vec3f(xMin, yMin, zMin), Vec3f(xMax, yMax, zMax));
-  }
+    return boundingBox;
+  }, &mergeBoundingBoxes, triangleGrainSize);
 
   float maxLength = m_boundingBox.getMaxPosition().x() - m_boundingBox.getMinPosition().x();
   CutAxis cutAxis = AXIS_X;
@@ -96,6 +109,7 @@ void BvhNode::build(std::vector<TriangleInfo>& trianglesInfo, std::size_t beginI
 
 BvhSystem::BvhSystem() {
   registerComponents<Mesh>();
+  registerReadComponents<Mesh, Transform>();
 }
 
 void BvhSystem::build() {
@@ -145,14 +159,4 @@ void BvhSystem::build() {
   m_rootNode.build(triangles, 0, totalTriangleCount);
 }
 
-void BvhSystem::linkEntity(const EntityPtr& entity) {
-  System::linkEntity(entity);
-  build(); // TODO: if N entities are linked one after the other, the BVH will be rebuilt as many times
-}
-
-void BvhSystem::unlinkEntity(const EntityPtr& entity) {
-  System::unlinkEntity(entity);
-  build(); // TODO: if N entities are unlinked one after the other, the BVH will be rebuilt as many times
-}
-
 } // namespace Raz
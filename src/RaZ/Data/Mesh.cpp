@@ -211,6 +211,18 @@ Mesh::Mesh(const AABB& box) {
   };
 }
 
+Mesh Mesh::clone() const {
+  Mesh mesh;
+  mesh.m_submeshes.reserve(m_submeshes.size());
+
+  for (const Submesh& submesh : m_submeshes)
+    mesh.m_submeshes.emplace_back(submesh.clone());
+
+  mesh.m_boundingBox = m_boundingBox;
+
+  return mesh;
+}
+
 std::size_t Mesh::recoverVertexCount() const {
   std::size_t vertexCount = 0;
 
@@ -250,7 +262,8 @@ const AABB& Mesh::computeBoundingBox() {
 }
 
 void Mesh::computeTangents() {
-  Threading::parallelize(m_submeshes, [] (const auto& range) noexcept {
+  // Submeshes can have very different sizes; each one is processed separately by the first available thread, balancing the load
+  Threading::parallelFor(m_submeshes, [] (const auto& range) noexcept {
     for (Submesh& submesh : range) {
       for (std::size_t i = 0; i < submesh.getTriangleIndexCount(); i += 3) {
         Vertex& firstVert  = submesh.getVertices()[submesh.getTriangleIndices()[i    ]];
@@ -274,7 +287,7 @@ void Mesh::computeTangents() {
         vert.tangent = (vert.tangent - vert.normal * vert.tangent.dot(vert.normal)).normalize();
       }
     }
-  });
+  }, 1);
 }
 
 void Mesh::createUvSphere(const Sphere& sphere, uint32_t widthCount, uint32_t heightCount) {
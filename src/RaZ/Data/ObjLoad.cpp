@@ -14,13 +14,8 @@ namespace Raz::ObjFormat {
 
 namespace {
 
-inline Texture2DPtr loadTexture(const FilePath& mtlFilePath, const FilePath& textureFilePath) {
-  // Always apply a vertical flip to imported textures, since OpenGL maps them upside down
-  return Texture2D::create(ImageFormat::load(mtlFilePath.recoverPathToFile() + textureFilePath, true), true);
-}
-
 inline void loadMtl(const FilePath& mtlFilePath,
-                    std::vector<Material>& materials,
+                    std::vector<MaterialData>& materials,
                     std::unordered_map<std::string, std::size_t>& materialCorrespIndices) {
   Logger::debug("[ObjLoad] Loading MTL file ('" + mtlFilePath + "')...");
 
@@ -28,12 +23,12 @@ inline void loadMtl(const FilePath& mtlFilePath,
 
   if (!file) {
     Logger::error("[ObjLoad] Couldn't open the MTL file '" + mtlFilePath + "'.");
-    materials.emplace_back(MaterialType::COOK_TORRANCE);
+    materials.emplace_back().type = MaterialType::COOK_TORRANCE;
     return;
   }
 
-  Material material;
-  MaterialType materialType = MaterialType::BLINN_PHONG;
+  const FilePath mtlFolderPath = mtlFilePath.recoverPathToFile();
+  MaterialData material;
 
   while (!file.eof()) {
     std::string tag;
@@ -48,82 +43,127 @@ inline void loadMtl(const FilePath& mtlFilePath,
       const Vec3f values(std::stof(nextValue), std::stof(secondValue), std::stof(thirdValue));
 
       if (tag[1] == 'd')                 // Diffuse/albedo factor [Kd]
-        material.getProgram().setAttribute(values, MaterialAttribute::BaseColor);
+        material.vec3Attributes.emplace_back(MaterialAttribute::BaseColor, values);
       else if (tag[1] == 'e')            // Emissive factor [Ke]
-        material.getProgram().setAttribute(values, MaterialAttribute::Emissive);
+        material.vec3Attributes.emplace_back(MaterialAttribute::Emissive, values);
       else if (tag[1] == 'a')            // Ambient factor [Ka]
-        material.getProgram().setAttribute(values, MaterialAttribute::Ambient);
+        material.vec3Attributes.emplace_back(MaterialAttribute::Ambient, values);
       else if (tag[1] == 's')            // Specular factor [Ks]
-        material.getProgram().setAttribute(values, MaterialAttribute::Specular);
+        material.vec3Attributes.emplace_back(MaterialAttribute::Specular, values);
     } else if (tag[0] == 'P') {          // PBR properties
       const float factor = std::stof(nextValue);
 
       if (tag[1] == 'm')                 // Metallic factor [Pm]
-        material.getProgram().setAttribute(factor, MaterialAttribute::Metallic);
+        material.floatAttributes.emplace_back(MaterialAttribute::Metallic, factor);
       else if (tag[1] == 'r')            // Roughness factor [Pr]
-        material.getProgram().setAttribute(factor, MaterialAttribute::Roughness);
+        material.floatAttributes.emplace_back(MaterialAttribute::Roughness, factor);
 
-      materialType = MaterialType::COOK_TORRANCE;
+      material.type = MaterialType::COOK_TORRANCE;
     } else if (tag[0] == 'm') {          // Import texture
-      const Texture2DPtr map = loadTexture(mtlFilePath, nextValue);
+      const FilePath mapPath = mtlFolderPath + nextValue;
 
       if (tag[4] == 'K') {               // Standard maps
         if (tag[5] == 'd')               // Diffuse/albedo map [map_Kd]
-          material.getProgram().setTexture(map, MaterialTexture::BaseColor);
+          material.textures.emplace_back(MaterialTexture::BaseColor, mapPath);
         else if (tag[5] == 'e')          // Emissive map [map_Ke]
-          material.getProgram().setTexture(map, MaterialTexture::Emissive);
+          material.textures.emplace_back(MaterialTexture::Emissive, mapPath);
         else if (tag[5] == 'a')          // Ambient/ambient occlusion map [map_Ka]
-          material.getProgram().setTexture(map, MaterialTexture::Ambient);
+          material.textures.emplace_back(MaterialTexture::Ambient, mapPath);
         else if (tag[5] == 's')          // Specular map [map_Ks]
-          material.getProgram().setTexture(map, MaterialTexture::Specular);
+          material.textures.emplace_back(MaterialTexture::Specular, mapPath);
       } else if (tag[4] == 'P') {       // PBR maps
         if (tag[5] == 'm')               // Metallic map [map_Pm]
-          material.getProgram().setTexture(map, MaterialTexture::Metallic);
+          material.textures.emplace_back(MaterialTexture::Metallic, mapPath);
         else if (tag[5] == 'r')          // Roughness map [map_Pr]
-          material.getProgram().setTexture(map, MaterialTexture::Roughness);
+          material.textures.emplace_back(MaterialTexture::Roughness, mapPath);
 
-        materialType = MaterialType::COOK_TORRANCE;
+        material.type = MaterialType::COOK_TORRANCE;
       } else if (tag[4] == 'd') {        // Transparency map [map_d]
-        material.getProgram().setTexture(map, MaterialTexture::Transparency);
+        material.textures.emplace_back(MaterialTexture::Transparency, mapPath);
       } else if (tag[4] == 'b') {        // Bump map [map_bump]
-        material.getProgram().setTexture(map, MaterialTexture::Bump);
+        material.textures.emplace_back(MaterialTexture::Bump, mapPath);
       }
     } else if (tag[0] == 'd') {          // Transparency factor
-      material.getProgram().setAttribute(std::stof(nextValue), MaterialAttribute::Transparency);
+      material.floatAttributes.emplace_back(MaterialAttribute::Transparency, std::stof(nextValue));
     } else if (tag[0] == 'T') {
       if (tag[1] == 'r')                 // Transparency factor (alias, 1 - d) [Tr]
-        material.getProgram().setAttribute(1.f - std::stof(nextValue), MaterialAttribute::Transparency);
+        material.floatAttributes.emplace_back(MaterialAttribute::Transparency, 1.f - std::stof(nextValue));
     } else if (tag[0] == 'b') {         // Bump map (alias) [bump]
-      material.getProgram().setTexture(loadTexture(mtlFilePath, nextValue), MaterialTexture::Bump);
+      material.textures.emplace_back(MaterialTexture::Bump, mtlFolderPath + nextValue);
     } else if (tag[0] == 'n') {
       if (tag[1] == 'o') {               // Normal map [norm]
-        material.getProgram().setTexture(loadTexture(mtlFilePath, nextValue), MaterialTexture::Normal);
+        material.textures.emplace_back(MaterialTexture::Normal, mtlFolderPath + nextValue);
       } else if (tag[1] == 'e') {        // New material [newmtl]
         materialCorrespIndices.emplace(nextValue, materialCorrespIndices.size());
 
-        if (material.isEmpty())
+        if (material.vec3Attributes.empty() && material.floatAttributes.empty() && material.textures.empty())
           continue;
 
-        material.loadType(materialType);
         materials.emplace_back(std::move(material));
-
-        material     = Material();
-        materialType = MaterialType::BLINN_PHONG;
+        material = MaterialData();
       }
     } else {
       std::getline(file, tag); // Skip the rest of the line
     }
   }
 
-  material.loadType(materialType);
   materials.emplace_back(std::move(material));
 
   Logger::debug("[ObjLoad] Loaded MTL file (" + std::to_string(materials.size()) + " material(s) loaded)");
 }
 
+inline MeshRenderer createMeshRenderer(const ObjData& objData, const std::function<Texture2DPtr(const FilePath&)>& textureLoader) {
+  MeshRenderer meshRenderer;
+
+  for (const MaterialData& materialData : objData.materials) {
+    Material& material = meshRenderer.addMaterial();
+    RenderShaderProgram& program = material.getProgram();
+
+    for (const auto& [uniformName, value] : materialData.vec3Attributes)
+      program.setAttribute(value, uniformName);
+
+    for (const auto& [uniformName, value] : materialData.floatAttributes)
+      program.setAttribute(value, uniformName);
+
+    for (const auto& [uniformName, texturePath] : materialData.textures) {
+      Texture2DPtr texture = textureLoader(texturePath);
+
+      if (texture)
+        program.setTexture(std::move(texture), uniformName);
+    }
+
+    material.loadType(materialData.type);
+  }
+
+  for (const std::size_t materialIndex : objData.submeshMaterialIndices)
+    meshRenderer.addSubmeshRenderer().setMaterialIndex(materialIndex);
+
+  // Creating the mesh renderer from the mesh's data
+  meshRenderer.load(objData.mesh);
+
+  return meshRenderer;
+}
+
 } // namespace
 
 std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
+  ObjData objData = loadData(filePath);
+
+  // A same texture may be used by several materials; it is loaded only once
+  std::unordered_map<FilePath, Texture2DPtr> textures;
+
+  return createMesh(std::move(objData), [&textures] (const FilePath& texturePath) {
+    Texture2DPtr& texture = textures[texturePath];
+
+    // Always apply a vertical flip to imported textures, since OpenGL maps them upside down
+    if (texture == nullptr)
+      texture = Texture2D::create(ImageFormat::load(texturePath, true), true);
+
+    return texture;
+  });
+}
+
+ObjData loadData(const FilePath& filePath) {
   Logger::debug("[ObjLoad] Loading OBJ file ('" + filePath + "')...");
 
   std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
@@ -131,11 +171,11 @@ std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
   if (!file)
     throw std::invalid_argument("Error: Couldn't open the OBJ file '" + filePath + '\'');
 
-  Mesh mesh;
-  MeshRenderer meshRenderer;
+  ObjData objData;
+  Mesh& mesh = objData.mesh;
 
   mesh.addSubmesh();
-  meshRenderer.addSubmeshRenderer();
+  objData.submeshMaterialIndices.emplace_back(0);
 
   std::unordered_map<std::string, std::size_t> materialCorrespIndices;
 
@@ -235,7 +275,7 @@ std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
       file >> mtlFileName;
 
       const std::string mtlFilePath = filePath.recoverPathToFile() + mtlFileName;
-      loadMtl(mtlFilePath, meshRenderer.getMaterials(), materialCorrespIndices);
+      loadMtl(mtlFilePath, objData.materials, materialCorrespIndices);
     } else if (line[0] == 'u') { // Material usage (usemtl)
       if (materialCorrespIndices.empty())
         continue;
@@ -248,7 +288,7 @@ std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
       if (correspMaterial == materialCorrespIndices.cend())
         Logger::error("[ObjLoad] No corresponding material found with the name '" + materialName + "'.");
       else
-        meshRenderer.getSubmeshRenderers().back().setMaterialIndex(correspMaterial->second);
+        objData.submeshMaterialIndices.back() = correspMaterial->second;
     } else if (line[0] == 'o' || line[0] == 'g') {
       if (!posIndices.front().empty()) {
         const std::size_t newSize = posIndices.size() + 1;
@@ -257,7 +297,7 @@ std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
         normalsIndices.resize(newSize);
 
         mesh.addSubmesh();
-        meshRenderer.addSubmeshRenderer().setMaterialIndex(std::numeric_limits<std::size_t>::max());
+        objData.submeshMaterialIndices.emplace_back(std::numeric_limits<std::size_t>::max());
       }
 
       std::getline(file, line);
@@ -356,14 +396,20 @@ std::pair<Mesh, MeshRenderer> load(const FilePath& filePath) {
 
   mesh.computeTangents();
 
-  // Creating the mesh renderer from the mesh's data
-  meshRenderer.load(mesh);
-
   Logger::debug("[ObjLoad] Loaded OBJ file (" + std::to_string(mesh.getSubmeshes().size()) + " submesh(es), "
                                               + std::to_string(mesh.recoverVertexCount()) + " vertices, "
                                               + std::to_string(mesh.recoverTriangleCount()) + " triangles)");
 
-  return { std::move(mesh), std::move(meshRenderer) };
+  return objData;
+}
+
+std::pair<Mesh, MeshRenderer> createMesh(ObjData&& objData, const std::function<Texture2DPtr(const FilePath&)>& textureLoader) {
+  MeshRenderer meshRenderer = createMeshRenderer(objData, textureLoader);
+  return { std::move(objData.mesh), std::move(meshRenderer) };
+}
+
+std::pair<Mesh, MeshRenderer> createMesh(const ObjData& objData, const std::function<Texture2DPtr(const FilePath&)>& textureLoader) {
+  return { objData.mesh.clone(), createMeshRenderer(objData, textureLoader) };
 }
 
 } // namespace Raz::ObjFormat
@@ -0,0 +1,44 @@
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+
+namespace Raz {
+
+Entity::~Entity() {
+  for (std::size_t compId = 0; compId < m_components.size(); ++compId) {
+    if (m_components[compId] != nullptr)
+      m_componentStorage->erase(compId, *m_components[compId]);
+  }
+}
+
+void Entity::enable(bool enabled) {
+  if (enabled == m_enabled)
+    return;
+
+  m_enabled = enabled;
+  markDirty();
+}
+
+ComponentStorage& Entity::recoverComponentStorage() {
+  if (m_componentStorage == nullptr) {
+    m_ownedComponentStorage = std::make_unique<ComponentStorage>();
+    m_componentStorage      = m_ownedComponentStorage.get();
+  }
+
+  return *m_componentStorage;
+}
+
+void Entity::markDirty() {
+  if (m_world == nullptr)
+    return;
+
+  // The views hold references to the components, and are thus updated immediately
+  m_world->forEachView([this] (ViewBase& view) { view.refreshEntity(*this); });
+
+  if (m_isDirty)
+    return;
+
+  m_isDirty = true;
+  m_world->m_dirtyEntities.emplace_back(getHandle());
+}
+
+} // namespace Raz
@@ -0,0 +1,136 @@
+#include "RaZ/Physics/Broadphase.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+
+namespace Raz {
+
+namespace {
+
+constexpr bool overlap(const Vec3f& minPos1, const Vec3f& maxPos1, const Vec3f& minPos2, const Vec3f& maxPos2) noexcept {
+  return (minPos1.x() <= maxPos2.x() && maxPos1.x() >= minPos2.x())
+      && (minPos1.y() <= maxPos2.y() && maxPos1.y() >= minPos2.y())
+      && (minPos1.z() <= maxPos2.z() && maxPos1.z() >= minPos2.z());
+}
+
+} // namespace
+
+void Broadphase::computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs) {
+  computePairs(boxes, pairs);
+
+  // The pairs' first index being always the lowest, a pair made of boxes of both groups has its first one in the first group & its second one in the other
+  pairs.erase(std::remove_if(pairs.begin(), pairs.end(), [firstGroupCount] (const BroadphasePair& pair) {
+    return (pair.first >= firstGroupCount || pair.second < firstGroupCount);
+  }), pairs.end());
+}
+
+void BruteForceBroadphase::computePairs(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs) {
+  pairs.clear();
+
+  for (std::size_t firstIndex = 0; firstIndex < boxes.size(); ++firstIndex) {
+    const AABB& firstBox = boxes[firstIndex];
+
+    for (std::size_t secondIndex = firstIndex + 1; secondIndex < boxes.size(); ++secondIndex) {
+      const AABB& secondBox = boxes[secondIndex];
+
+      if (overlap(firstBox.getMinPosition(), firstBox.getMaxPosition(), secondBox.getMinPosition(), secondBox.getMaxPosition()))
+        pairs.emplace_back(firstIndex, secondIndex);
+    }
+  }
+}
+
+void BruteForceBroadphase::computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs) {
+  pairs.clear();
+
+  for (std::size_t firstIndex = 0; firstIndex < std::min(firstGroupCount, boxes.size()); ++firstIndex) {
+    const AABB& firstBox = boxes[firstIndex];
+
+    for (std::size_t secondIndex = firstGroupCount; secondIndex < boxes.size(); ++secondIndex) {
+      const AABB& secondBox = boxes[secondIndex];
+
+      if (overlap(firstBox.getMinPosition(), firstBox.getMaxPosition(), secondBox.getMinPosition(), secondBox.getMaxPosition()))
+        pairs.emplace_back(firstIndex, secondIndex);
+    }
+  }
+}
+
+void SweepAndPruneBroadphase::computePairs(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs) {
+  sweepAndPrune(boxes, pairs, [] (std::size_t, std::size_t) noexcept { return true; });
+}
+
+void SweepAndPruneBroadphase::computeGroupPairs(const std::vector<AABB>& boxes, std::size_t firstGroupCount, std::vector<BroadphasePair>& pairs) {
+  // Boxes of a same group are still swept over, but are never checked against each other
+  sweepAndPrune(boxes, pairs, [firstGroupCount] (std::size_t firstIndex, std::size_t secondIndex) noexcept {
+    return ((firstIndex < firstGroupCount) != (secondIndex < firstGroupCount));
+  });
+}
+
+std::size_t SweepAndPruneBroadphase::computeMemoryUsage() const noexcept {
+  return m_endpoints.capacity() * sizeof(Endpoint) + (m_minPositions.capacity() + m_maxPositions.capacity()) * sizeof(Vec3f);
+}
+
+template <typename FilterT>
+void SweepAndPruneBroadphase::sweepAndPrune(const std::vector<AABB>& boxes, std::vector<BroadphasePair>& pairs, const FilterT& isPairRelevant) {
+  pairs.clear();
+
+  if (boxes.size() < 2)
+    return;
+
+  m_minPositions.resize(boxes.size());
+  m_maxPositions.resize(boxes.size());
+
+  // The boxes are swept along the axis on which their centers vary the most, so that as few of them as possible overlap along it
+  Vec3f centerSum;
+  Vec3f centerSquaredSum;
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex) {
+    m_minPositions[boxIndex] = boxes[boxIndex].getMinPosition();
+    m_maxPositions[boxIndex] = boxes[boxIndex].getMaxPosition();
+
+    const Vec3f center = (m_minPositions[boxIndex] + m_maxPositions[boxIndex]) * 0.5f;
+    centerSum        += center;
+    centerSquaredSum += center * center;
+  }
+
+  const float invBoxCount = 1.f / static_cast<float>(boxes.size());
+  const Vec3f centerMean  = centerSum * invBoxCount;
+  const Vec3f variance    = centerSquaredSum * invBoxCount - centerMean * centerMean;
+
+  std::size_t sweepAxis = 0;
+
+  if (variance.y() > variance[sweepAxis])
+    sweepAxis = 1;
+
+  if (variance.z() > variance[sweepAxis])
+    sweepAxis = 2;
+
+  m_endpoints.resize(boxes.size());
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+    m_endpoints[boxIndex] = Endpoint{ m_minPositions[boxIndex][sweepAxis], boxIndex };
+
+  std::sort(m_endpoints.begin(), m_endpoints.end(), [] (const Endpoint& endpoint1, const Endpoint& endpoint2) {
+    return (endpoint1.minValue < endpoint2.minValue || (endpoint1.minValue == endpoint2.minValue && endpoint1.boxIndex < endpoint2.boxIndex));
+  });
+
+  for (std::size_t endpointIndex = 0; endpointIndex < m_endpoints.size(); ++endpointIndex) {
+    const std::size_t firstIndex = m_endpoints[endpointIndex].boxIndex;
+    const Vec3f& firstMinPos     = m_minPositions[firstIndex];
+    const Vec3f& firstMaxPos     = m_maxPositions[firstIndex];
+
+    // Only the following boxes starting before the current one ends can overlap it; they are still checked on all axes
+    for (std::size_t nextEndpointIndex = endpointIndex + 1;
+         nextEndpointIndex < m_endpoints.size() && m_endpoints[nextEndpointIndex].minValue <= firstMaxPos[sweepAxis];
+         ++nextEndpointIndex) {
+      const std::size_t secondIndex = m_endpoints[nextEndpointIndex].boxIndex;
+
+      if (isPairRelevant(firstIndex, secondIndex) && overlap(firstMinPos, firstMaxPos, m_minPositions[secondIndex], m_maxPositions[secondIndex]))
+        pairs.emplace_back(std::min(firstIndex, secondIndex), std::max(firstIndex, secondIndex));
+    }
+  }
+
+  // The pairs are sorted so that the results never depend on the boxes' positions, but only on their order
+  std::sort(pairs.begin(), pairs.end());
+}
+
+} // namespace Raz
@@ -2,104 +2,60 @@
 
 namespace Raz {
 
-void Collider::setShape(Shape&& shape) {
-  m_shapeType = shape.getType();
+namespace {
 
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      m_colliderShape = std::make_unique<Line>(static_cast<Line&&>(shape));
-      break;
-
-    case ShapeType::PLANE:
-      m_colliderShape = std::make_unique<Plane>(static_cast<Plane&&>(shape));
-      break;
-
-    case ShapeType::SPHERE:
-      m_colliderShape = std::make_unique<Sphere>(static_cast<Sphere&&>(shape));
-      break;
-
-    case ShapeType::TRIANGLE:
-      m_colliderShape = std::make_unique<Triangle>(static_cast<Triangle&&>(shape));
-      break;
+template <ShapeType Type, typename ShapeT>
+constexpr bool isShapeIndexValid = std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(Type), ColliderShape>, ShapeT>;
 
-    case ShapeType::QUAD:
-      m_colliderShape = std::make_unique<Quad>(static_cast<Quad&&>(shape));
-      break;
+static_assert(isShapeIndexValid<ShapeType::LINE, Line> && isShapeIndexValid<ShapeType::PLANE, Plane> && isShapeIndexValid<ShapeType::SPHERE, Sphere>
+           && isShapeIndexValid<ShapeType::TRIANGLE, Triangle> && isShapeIndexValid<ShapeType::QUAD, Quad> && isShapeIndexValid<ShapeType::AABB, AABB>
+           && isShapeIndexValid<ShapeType::OBB, OBB>, "Error: The collider shapes must be ordered like their shape types.");
 
-    case ShapeType::AABB:
-      m_colliderShape = std::make_unique<AABB>(static_cast<AABB&&>(shape));
-      break;
+} // namespace
 
-    case ShapeType::OBB:
-      m_colliderShape = std::make_unique<OBB>(static_cast<OBB&&>(shape));
-      break;
-
-    default:
-      throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
-  }
+bool Collider::intersects(const Collider& collider) const {
+  // Both shapes being known with their actual type, the right intersection check is directly called
+  return visitShape([&collider] (const auto& shape) {
+    return collider.visitShape([&shape] (const auto& colliderShape) { return shape.intersects(colliderShape); });
+  });
 }
 
 bool Collider::intersects(const Shape& shape) const {
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      return shape.intersects(static_cast<const Line&>(*m_colliderShape));
-
-    case ShapeType::PLANE:
-      return shape.intersects(static_cast<const Plane&>(*m_colliderShape));
-
-    case ShapeType::SPHERE:
-      return shape.intersects(static_cast<const Sphere&>(*m_colliderShape));
-
-    case ShapeType::TRIANGLE:
-      return shape.intersects(static_cast<const Triangle&>(*m_colliderShape));
-
-    case ShapeType::QUAD:
-      return shape.intersects(static_cast<const Quad&>(*m_colliderShape));
-
-    case ShapeType::AABB:
-      return shape.intersects(static_cast<const AABB&>(*m_colliderShape));
-
-    case ShapeType::OBB:
-      return shape.intersects(static_cast<const OBB&>(*m_colliderShape));
-
-    default:
-      break;
-  }
-
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/shape intersection check");
+  return visitShape([&shape] (const auto& colliderShape) { return shape.intersects(colliderShape); });
 }
 
 bool Collider::intersects(const Ray& ray, RayHit* hit) const {
-  switch (m_shapeType) {
+  return visitShape([&] (const auto& shape) { return ray.intersects(shape, hit); });
+}
+
+ColliderShape Collider::createShape(Shape&& shape) {
+  switch (shape.getType()) {
     case ShapeType::LINE:
-      //return ray.intersects(static_cast<const Line&>(*m_colliderShape), hit);
-      break;
+      return static_cast<Line&&>(shape);
 
     case ShapeType::PLANE:
-      return ray.intersects(static_cast<const Plane&>(*m_colliderShape), hit);
+      return static_cast<Plane&&>(shape);
 
     case ShapeType::SPHERE:
-      return ray.intersects(static_cast<const Sphere&>(*m_colliderShape), hit);
+      return static_cast<Sphere&&>(shape);
 
     case ShapeType::TRIANGLE:
-      return ray.intersects(static_cast<const Triangle&>(*m_colliderShape), hit);
+      return static_cast<Triangle&&>(shape);
 
     case ShapeType::QUAD:
-      //return ray.intersects(static_cast<const Quad&>(*m_colliderShape), hit);
-      break;
+      return static_cast<Quad&&>(shape);
 
     case ShapeType::AABB:
-      return ray.intersects(static_cast<const AABB&>(*m_colliderShape), hit);
+      return static_cast<AABB&&>(shape);
 
     case ShapeType::OBB:
-      //return ray.intersects(static_cast<const OBB&>(*m_colliderShape), hit);
-      break;
+      return static_cast<OBB&&>(shape);
 
     default:
       break;
   }
 
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/ray intersection check");
+  throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
 }
 
 } // namespace Raz
@@ -2,106 +2,1010 @@
 #include "RaZ/Physics/Collider.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__AVX__)
+#define RAZ_PHYSICS_USE_AVX
+#include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAZ_PHYSICS_USE_SSE
+#include <xmmintrin.h>
+#endif
 
 namespace Raz {
 
+namespace {
+
+struct IntegrationParams {
+  std::size_t bodyCount {};
+  float deltaTime {};
+  float relativeFriction {};
+  const float* masses {};
+  const float* invMasses {};
+};
+
+/// Integrates the rigid bodies' velocities along a single axis.
+/// Several rigid bodies are processed at once when SIMD instructions are available, the remaining ones being integrated one by one.
+/// \param params Integration parameters, common to all axes.
+/// \param gravity Gravity acceleration along the axis.
+/// \param forces Additional forces applied to the rigid bodies along the axis.
+/// \param velocities Velocities of the rigid bodies, updated by the integration.
+void integrateVelocityAxis(const IntegrationParams& params, float gravity, const float* forces, float* velocities) noexcept {
+  std::size_t bodyIndex = 0;
+
+#if defined(RAZ_PHYSICS_USE_AVX)
+  const __m256 gravityValues  = _mm256_set1_ps(gravity);
+  const __m256 timeValues     = _mm256_set1_ps(params.deltaTime);
+  const __m256 frictionValues = _mm256_set1_ps(params.relativeFriction);
+
+  for (; bodyIndex + 8 <= params.bodyCount; bodyIndex += 8) {
+    const __m256 weights      = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(params.masses + bodyIndex), gravityValues), _mm256_loadu_ps(forces + bodyIndex));
+    const __m256 acceleration = _mm256_mul_ps(weights, _mm256_loadu_ps(params.invMasses + bodyIndex));
+    const __m256 velocity     = _mm256_mul_ps(_mm256_loadu_ps(velocities + bodyIndex), frictionValues);
+
+    _mm256_storeu_ps(velocities + bodyIndex, _mm256_add_ps(velocity, _mm256_mul_ps(acceleration, timeValues)));
+  }
+#elif defined(RAZ_PHYSICS_USE_SSE)
+  const __m128 gravityValues  = _mm_set1_ps(gravity);
+  const __m128 timeValues     = _mm_set1_ps(params.deltaTime);
+  const __m128 frictionValues = _mm_set1_ps(params.relativeFriction);
+
+  for (; bodyIndex + 4 <= params.bodyCount; bodyIndex += 4) {
+    const __m128 weights      = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(params.masses + bodyIndex), gravityValues), _mm_loadu_ps(forces + bodyIndex));
+    const __m128 acceleration = _mm_mul_ps(weights, _mm_loadu_ps(params.invMasses + bodyIndex));
+    const __m128 velocity     = _mm_mul_ps(_mm_loadu_ps(velocities + bodyIndex), frictionValues);
+
+    _mm_storeu_ps(velocities + bodyIndex, _mm_add_ps(velocity, _mm_mul_ps(acceleration, timeValues)));
+  }
+#endif
+
+  for (; bodyIndex < params.bodyCount; ++bodyIndex) {
+    const float acceleration = (params.masses[bodyIndex] * gravity + forces[bodyIndex]) * params.invMasses[bodyIndex];
+    velocities[bodyIndex]    = velocities[bodyIndex] * params.relativeFriction + acceleration * params.deltaTime;
+  }
+}
+
+/// Integrates the rigid bodies' positions along a single axis, from their velocities (semi-implicit Euler integration).
+/// Several rigid bodies are processed at once when SIMD instructions are available, the remaining ones being integrated one by one.
+/// \param bodyCount Number of rigid bodies to be integrated.
+/// \param deltaTime Time elapsed since the last step.
+/// \param oldPositions Positions of the rigid bodies before the integration.
+/// \param velocities Velocities of the rigid bodies.
+/// \param positions Integrated positions of the rigid bodies.
+void integratePositionAxis(std::size_t bodyCount, float deltaTime, const float* oldPositions, const float* velocities, float* positions) noexcept {
+  std::size_t bodyIndex = 0;
+
+#if defined(RAZ_PHYSICS_USE_AVX)
+  const __m256 timeValues = _mm256_set1_ps(deltaTime);
+
+  for (; bodyIndex + 8 <= bodyCount; bodyIndex += 8) {
+    const __m256 displacement = _mm256_mul_ps(_mm256_loadu_ps(velocities + bodyIndex), timeValues);
+    _mm256_storeu_ps(positions + bodyIndex, _mm256_add_ps(_mm256_loadu_ps(oldPositions + bodyIndex), displacement));
+  }
+#elif defined(RAZ_PHYSICS_USE_SSE)
+  const __m128 timeValues = _mm_set1_ps(deltaTime);
+
+  for (; bodyIndex + 4 <= bodyCount; bodyIndex += 4) {
+    const __m128 displacement = _mm_mul_ps(_mm_loadu_ps(velocities + bodyIndex), timeValues);
+    _mm_storeu_ps(positions + bodyIndex, _mm_add_ps(_mm_loadu_ps(oldPositions + bodyIndex), displacement));
+  }
+#endif
+
+  for (; bodyIndex < bodyCount; ++bodyIndex)
+    positions[bodyIndex] = oldPositions[bodyIndex] + velocities[bodyIndex] * deltaTime;
+}
+
+template <typename Vec3ArrayT>
+Vec3f loadVector(const Vec3ArrayT& array, std::size_t index) noexcept {
+  return Vec3f(array.x[index], array.y[index], array.z[index]);
+}
+
+template <typename Vec3ArrayT>
+void storeVector(Vec3ArrayT& array, std::size_t index, const Vec3f& value) noexcept {
+  array.x[index] = value.x();
+  array.y[index] = value.y();
+  array.z[index] = value.z();
+}
+
+/// Computes the contact between a point & a solid box, the point being expressed in the box's space.
+/// \param minPos Box's minimal position.
+/// \param maxPos Box's maximal position.
+/// \param point Point to compute the contact with.
+/// \param normal Contact normal, pointing from the box towards the point.
+/// \param separation Distance between the point & the box's surface, negative if the point is inside.
+void computeBoxContact(const Vec3f& minPos, const Vec3f& maxPos, const Vec3f& point, Vec3f& normal, float& separation) noexcept {
+  const Vec3f closestPoint = AABB(minPos, maxPos).computeProjection(point);
+  const Vec3f outerVec     = point - closestPoint;
+
+  if (!outerVec.strictlyEquals(Vec3f(0.f))) {
+    separation = outerVec.computeLength();
+    normal     = outerVec / separation;
+    return;
+  }
+
+  // The point being inside the box, it is pushed out through the closest face
+  separation = -std::numeric_limits<float>::max();
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const float minFaceDist = point[axisIndex] - minPos[axisIndex];
+    const float maxFaceDist = maxPos[axisIndex] - point[axisIndex];
+
+    if (-minFaceDist > separation) {
+      separation = -minFaceDist;
+      normal     = Vec3f(0.f);
+      normal[axisIndex] = -1.f;
+    }
+
+    if (-maxFaceDist > separation) {
+      separation = -maxFaceDist;
+      normal     = Vec3f(0.f);
+      normal[axisIndex] = 1.f;
+    }
+  }
+}
+
+// The contact between a point & a collider's shape is computed for each shape type, both being expressed in the same space
+// Planes are considered as half-spaces & spheres & boxes as solids; other shapes are considered as thin surfaces
+// Each computes the contact normal, pointing from the shape towards the point, & the distance between the point & the shape's surface,
+//  negative if the point is inside; it returns true if a contact could be computed, false otherwise
+
+bool computePointContact(const Plane& plane, const Vec3f& point, Vec3f& normal, float& separation) noexcept {
+  normal     = plane.getNormal();
+  separation = normal.dot(point) - plane.getDistance();
+  return true;
+}
+
+bool computePointContact(const Sphere& sphere, const Vec3f& point, Vec3f& normal, float& separation) noexcept {
+  const Vec3f outerVec = point - sphere.getCenter();
+  const float distance = outerVec.computeLength();
+
+  normal     = (distance > 0.f ? outerVec / distance : Axis::Y);
+  separation = distance - sphere.getRadius();
+  return true;
+}
+
+bool computePointContact(const AABB& aabb, const Vec3f& point, Vec3f& normal, float& separation) noexcept {
+  computeBoxContact(aabb.getMinPosition(), aabb.getMaxPosition(), point, normal, separation);
+  return true;
+}
+
+bool computePointContact(const OBB& obb, const Vec3f& point, Vec3f& normal, float& separation) noexcept {
+  // The point is brought into the box's local space, where it is axis-aligned & centered
+  const Vec3f centroid    = obb.computeCentroid();
+  const Vec3f halfExtents = (obb.getMaxPosition() - obb.getMinPosition()) * 0.5f;
+
+  computeBoxContact(-halfExtents, halfExtents, obb.getRotation() * (point - centroid), normal, separation);
+  normal = normal * obb.getRotation();
+  return true;
+}
+
+/// Computes the contact between a point & a thin surface from the point's projection.
+/// \return True if the point does not lie on the surface, the normal being then defined, false otherwise.
+bool computeSurfaceContact(const Shape& shape, const Vec3f& point, Vec3f& normal, float& separation) {
+  const Vec3f outerVec = point - shape.computeProjection(point);
+  separation = outerVec.computeLength();
+
+  if (separation <= 0.f)
+    return false;
+
+  normal = outerVec / separation;
+  return true;
+}
+
+bool computePointContact(const Line& line, const Vec3f& point, Vec3f& normal, float& separation) {
+  // A point lying right on a line has no normal to be pushed along
+  return computeSurfaceContact(line, point, normal, separation);
+}
+
+bool computePointContact(const Triangle& triangle, const Vec3f& point, Vec3f& normal, float& separation) {
+  if (!computeSurfaceContact(triangle, point, normal, separation))
+    normal = triangle.computeNormal();
+
+  return true;
+}
+
+bool computePointContact(const Quad& quad, const Vec3f& point, Vec3f& normal, float& separation) {
+  if (!computeSurfaceContact(quad, point, normal, separation))
+    normal = Triangle(quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos()).computeNormal();
+
+  return true;
+}
+
+struct SphereContactParams {
+  std::size_t contactCount {};
+  const float* posX {}; ///< Positions of the points along X, relative to their sphere's center.
+  const float* posY {};
+  const float* posZ {};
+  const float* radii {};
+};
+
+/// Computes the contacts between points & spheres, in the same way as computePointContact().
+/// Several contacts are computed at once when SIMD instructions are available, the remaining ones being computed one by one.
+/// \param params Points & spheres to compute the contacts of.
+/// \param normals Contact normals, pointing from the spheres towards the points.
+/// \param separations Distances between the points & the spheres' surfaces, negative if the points are inside.
+template <typename Vec3ArrayT>
+void computeSphereContacts(const SphereContactParams& params, Vec3ArrayT& normals, float* separations) noexcept {
+  std::size_t contactIndex = 0;
+
+#if defined(RAZ_PHYSICS_USE_AVX)
+  const __m256 zeroValues = _mm256_setzero_ps();
+  const __m256 oneValues  = _mm256_set1_ps(1.f);
+
+  for (; contactIndex + 8 <= params.contactCount; contactIndex += 8) {
+    const __m256 posX     = _mm256_loadu_ps(params.posX + contactIndex);
+    const __m256 posY     = _mm256_loadu_ps(params.posY + contactIndex);
+    const __m256 posZ     = _mm256_loadu_ps(params.posZ + contactIndex);
+    const __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(posX, posX), _mm256_mul_ps(posY, posY)), _mm256_mul_ps(posZ, posZ)));
+
+    // A point lying at its sphere's center is given an upward normal
+    const __m256 hasDistance = _mm256_cmp_ps(distance, zeroValues, _CMP_GT_OQ);
+    _mm256_storeu_ps(normals.x.data() + contactIndex, _mm256_and_ps(hasDistance, _mm256_div_ps(posX, distance)));
+    _mm256_storeu_ps(normals.y.data() + contactIndex, _mm256_blendv_ps(oneValues, _mm256_div_ps(posY, distance), hasDistance));
+    _mm256_storeu_ps(normals.z.data() + contactIndex, _mm256_and_ps(hasDistance, _mm256_div_ps(posZ, distance)));
+    _mm256_storeu_ps(separations + contactIndex, _mm256_sub_ps(distance, _mm256_loadu_ps(params.radii + contactIndex)));
+  }
+#elif defined(RAZ_PHYSICS_USE_SSE)
+  const __m128 zeroValues = _mm_setzero_ps();
+  const __m128 oneValues  = _mm_set1_ps(1.f);
+
+  for (; contactIndex + 4 <= params.contactCount; contactIndex += 4) {
+    const __m128 posX     = _mm_loadu_ps(params.posX + contactIndex);
+    const __m128 posY     = _mm_loadu_ps(params.posY + contactIndex);
+    const __m128 posZ     = _mm_loadu_ps(params.posZ + contactIndex);
+    const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(posX, posX), _mm_mul_ps(posY, posY)), _mm_mul_ps(posZ, posZ)));
+
+    // A point lying at its sphere's center is given an upward normal
+    const __m128 hasDistance = _mm_cmpgt_ps(distance, zeroValues);
+    _mm_storeu_ps(normals.x.data() + contactIndex, _mm_and_ps(hasDistance, _mm_div_ps(posX, distance)));
+    _mm_storeu_ps(normals.y.data() + contactIndex, _mm_or_ps(_mm_and_ps(hasDistance, _mm_div_ps(posY, distance)), _mm_andnot_ps(hasDistance, oneValues)));
+    _mm_storeu_ps(normals.z.data() + contactIndex, _mm_and_ps(hasDistance, _mm_div_ps(posZ, distance)));
+    _mm_storeu_ps(separations + contactIndex, _mm_sub_ps(distance, _mm_loadu_ps(params.radii + contactIndex)));
+  }
+#endif
+
+  for (; contactIndex < params.contactCount; ++contactIndex) {
+    const Vec3f outerVec(params.posX[contactIndex], params.posY[contactIndex], params.posZ[contactIndex]);
+    const float distance = std::sqrt(outerVec.x() * outerVec.x() + outerVec.y() * outerVec.y() + outerVec.z() * outerVec.z());
+
+    storeVector(normals, contactIndex, (distance > 0.f ? outerVec / distance : Axis::Y));
+    separations[contactIndex] = distance - params.radii[contactIndex];
+  }
+}
+
+/// Finds the root of the tree an element belongs to, halving the path to it along the way.
+/// \param parents Parent of each element; a root is its own parent.
+/// \param index Index of the element to find the root of.
+/// \return Index of the root.
+std::size_t findRoot(std::vector<std::size_t>& parents, std::size_t index) noexcept {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index          = parents[index];
+  }
+
+  return index;
+}
+
+/// Computes by conservative advancement when a point moving in a straight line hits a solid shape, both expressed in the same space.
+/// The point is repeatedly moved forward by its distance to the shape, which it cannot travel without hitting it, until touching the
+///   shape; the shape being convex, the point can never hit it once moving away from it.
+/// \tparam ShapeT Type of the shape; must be a sphere, an AABB or an OBB.
+/// \param shape Shape to compute the time of impact with.
+/// \param point Position of the point at the beginning of its movement.
+/// \param velocity Velocity of the point relative to the shape.
+/// \param maxTime Duration of the movement.
+/// \param normal Contact normal at the time of impact, pointing from the shape towards the point.
+/// \param time Time of impact.
+/// \param separation Distance between the point & the shape's surface at the time of impact.
+/// \return True if the point hits the shape before the end of its movement, false otherwise.
+template <typename ShapeT>
+bool computeTimeOfImpact(const ShapeT& shape, const Vec3f& point, const Vec3f& velocity, float maxTime,
+                         Vec3f& normal, float& time, float& separation) noexcept {
+  static_assert(std::is_same_v<ShapeT, Sphere> || std::is_same_v<ShapeT, AABB> || std::is_same_v<ShapeT, OBB>,
+                "Error: The time of impact can only be computed with a sphere, an AABB or an OBB.");
+
+  constexpr std::size_t maxIterationCount = 32;
+  constexpr float impactTolerance         = 0.001f; // Distance from the shape's surface below which the point is considered touching it.
+
+  const float speed = velocity.computeLength();
+  time = 0.f;
+
+  computePointContact(shape, point, normal, separation);
+
+  if (speed <= 0.f)
+    return (separation <= impactTolerance);
+
+  for (std::size_t iterationIndex = 0; iterationIndex < maxIterationCount && separation > impactTolerance; ++iterationIndex) {
+    time += separation / speed;
+
+    if (time > maxTime)
+      return false;
+
+    const float prevSeparation = separation;
+    computePointContact(shape, point + velocity * time, normal, separation);
+
+    if (separation >= prevSeparation)
+      return false;
+  }
+
+  // If not having converged, which may only happen when grazing the shape, the point is considered hitting it where it got to
+  return true;
+}
+
+template <typename... Ts>
+std::size_t computeVectorsMemory(const std::vector<Ts>&... vectors) noexcept {
+  return ((vectors.capacity() * sizeof(Ts)) + ...);
+}
+
+template <typename Vec3ArrayT>
+std::size_t computeArrayMemory(const Vec3ArrayT& array) noexcept {
+  return computeVectorsMemory(array.x, array.y, array.z);
+}
+
+/// Minimal number of collision candidates from which the islands are solved in parallel; below, the cost of dispatching them outweighs the gain.
+constexpr std::size_t minParallelCandidateCount = 256;
+
+constexpr float contactMargin         = 0.01f; ///< Distance from which contacts are created ahead of the rigid bodies' movement.
+constexpr float penetrationSlop       = 0.005f; ///< Penetration depth allowed without being corrected, avoiding jitter of resting contacts.
+constexpr float penetrationCorrection = 0.2f; ///< Fraction of the penetration depth corrected on each step (Baumgarte stabilization).
+constexpr float restitutionThreshold  = 0.5f; ///< Relative velocity under which rigid bodies do not bounce, letting them come to rest.
+constexpr float warmStartingNormalDot = 0.95f; ///< Minimal similarity between a contact's current & previous normals to reuse its impulse.
+
+} // namespace
+
 PhysicsSystem::PhysicsSystem() {
   registerComponents<Collider, RigidBody>();
+  registerReadComponents<Collider>();
+  registerWrittenComponents<RigidBody, Transform>();
+  registerViews(m_rigidBodies, m_colliders);
+}
+
+std::size_t PhysicsSystem::computeMemoryUsage() const noexcept {
+  std::size_t memory = m_broadphase->computeMemoryUsage();
+
+  memory += computeVectorsMemory(m_colliderEntries, m_rigidBodyEntries, m_entityRigidBodies, m_entityColliderIndices, m_unboundedColliderIndices,
+                                 m_boundedColliderIndices, m_boundingBoxes, m_broadphasePairs, m_collisionCandidates, m_sortedCandidates,
+                                 m_islandParents, m_rigidBodyIslandIndices, m_islandCandidateOffsets, m_contacts, m_contactManifolds);
+
+  memory += computeArrayMemory(m_rigidBodyStates.oldPositions) + computeArrayMemory(m_rigidBodyStates.positions)
+          + computeArrayMemory(m_rigidBodyStates.velocities) + computeArrayMemory(m_rigidBodyStates.forces)
+          + computeVectorsMemory(m_rigidBodyStates.masses, m_rigidBodyStates.invMasses);
+
+  for (const std::vector<std::size_t>& candidateIndices : m_shapeCandidateIndices)
+    memory += computeVectorsMemory(candidateIndices);
+
+  memory += computeArrayMemory(m_sphereContacts.relativePositions) + computeArrayMemory(m_sphereContacts.normals)
+          + computeVectorsMemory(m_sphereContacts.radii, m_sphereContacts.separations);
+
+  return memory;
 }
 
 bool PhysicsSystem::step(float deltaTime) {
+  // Nothing can move without time passing
+  if (deltaTime <= 0.f)
+    return true;
+
+  gatherRigidBodies();
+  integrateVelocities(deltaTime);
+  solveConstraints(deltaTime);
+  integratePositions(deltaTime);
+  applyImpactBounces();
+  applyRigidBodyStates();
+  updateSleepStates(deltaTime);
+
+  return true;
+}
+
+void PhysicsSystem::gatherRigidBodies() {
+  m_rigidBodyEntries.clear();
+  m_sleepingRigidBodyCount = 0;
+  std::fill(m_entityRigidBodies.begin(), m_entityRigidBodies.end(), std::make_pair(nullptr, std::numeric_limits<std::size_t>::max()));
+
+  m_rigidBodies.forEach([this] (const Entity& entity, RigidBody& rigidBody, Transform& transform) {
+    if (rigidBody.getMass() <= 0.f)
+      return;
+
+    if (entity.getId() >= m_entityRigidBodies.size())
+      m_entityRigidBodies.resize(entity.getId() + 1, std::make_pair(nullptr, std::numeric_limits<std::size_t>::max()));
+
+    if (entity.getId() >= m_entityGenerations.size())
+      m_entityGenerations.resize(entity.getId() + 1);
+    m_entityGenerations[entity.getId()] = entity.getGeneration();
+
+    if (rigidBody.isSleeping()) {
+      m_entityRigidBodies[entity.getId()].first = &rigidBody;
+      ++m_sleepingRigidBodyCount;
+      return;
+    }
+
+    m_entityRigidBodies[entity.getId()] = std::make_pair(&rigidBody, m_rigidBodyEntries.size());
+    m_rigidBodyEntries.push_back({ &entity, &rigidBody, &transform });
+  });
+
+  const std::size_t bodyCount = m_rigidBodyEntries.size();
+
+  const auto resizeArray = [bodyCount] (Vec3Array& array) {
+    array.x.resize(bodyCount);
+    array.y.resize(bodyCount);
+    array.z.resize(bodyCount);
+  };
+
+  resizeArray(m_rigidBodyStates.oldPositions);
+  resizeArray(m_rigidBodyStates.positions);
+  resizeArray(m_rigidBodyStates.velocities);
+  resizeArray(m_rigidBodyStates.forces);
+  m_rigidBodyStates.masses.resize(bodyCount);
+  m_rigidBodyStates.invMasses.resize(bodyCount);
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const RigidBody& rigidBody = *m_rigidBodyEntries[bodyIndex].rigidBody;
+
+    storeVector(m_rigidBodyStates.oldPositions, bodyIndex, m_rigidBodyEntries[bodyIndex].transform->getPosition());
+    storeVector(m_rigidBodyStates.velocities, bodyIndex, rigidBody.getVelocity());
+    storeVector(m_rigidBodyStates.forces, bodyIndex, rigidBody.getForces());
+    m_rigidBodyStates.masses[bodyIndex]    = rigidBody.getMass();
+    m_rigidBodyStates.invMasses[bodyIndex] = rigidBody.getInvMass();
+  }
+}
+
+void PhysicsSystem::integrateVelocities(float deltaTime) {
   const float relativeFriction = std::pow(m_friction, deltaTime);
+  const IntegrationParams params { m_rigidBodyEntries.size(), deltaTime, relativeFriction,
+                                   m_rigidBodyStates.masses.data(), m_rigidBodyStates.invMasses.data() };
+
+  RigidBodyStates& states = m_rigidBodyStates;
+  integrateVelocityAxis(params, m_gravity.x(), states.forces.x.data(), states.velocities.x.data());
+  integrateVelocityAxis(params, m_gravity.y(), states.forces.y.data(), states.velocities.y.data());
+  integrateVelocityAxis(params, m_gravity.z(), states.forces.z.data(), states.velocities.z.data());
+}
+
+void PhysicsSystem::integratePositions(float deltaTime) {
+  const std::size_t bodyCount = m_rigidBodyEntries.size();
+
+  RigidBodyStates& states = m_rigidBodyStates;
+  integratePositionAxis(bodyCount, deltaTime, states.oldPositions.x.data(), states.velocities.x.data(), states.positions.x.data());
+  integratePositionAxis(bodyCount, deltaTime, states.oldPositions.y.data(), states.velocities.y.data(), states.positions.y.data());
+  integratePositionAxis(bodyCount, deltaTime, states.oldPositions.z.data(), states.velocities.z.data(), states.positions.z.data());
+}
+
+void PhysicsSystem::applyRigidBodyStates() {
+  const RigidBodyStates& states = m_rigidBodyStates;
+
+  for (std::size_t bodyIndex = 0; bodyIndex < m_rigidBodyEntries.size(); ++bodyIndex) {
+    RigidBody& rigidBody = *m_rigidBodyEntries[bodyIndex].rigidBody;
+
+    const Vec3f oldPosition = loadVector(states.oldPositions, bodyIndex);
+    const Vec3f position    = loadVector(states.positions, bodyIndex);
+
+    rigidBody.m_oldPosition = oldPosition;
+    rigidBody.m_velocity    = loadVector(states.velocities, bodyIndex);
+
+    // Transforms are only modified (and thus marked as updated) for bodies having actually moved
+    if (!position.strictlyEquals(oldPosition))
+      m_rigidBodyEntries[bodyIndex].transform->setPosition(position);
+  }
+}
+
+void PhysicsSystem::computeCollisionCandidates(float deltaTime) {
+  m_colliderEntries.clear();
+  std::fill(m_entityColliderIndices.begin(), m_entityColliderIndices.end(), std::numeric_limits<std::size_t>::max());
+  m_unboundedColliderIndices.clear();
+  m_boundedColliderIndices.clear();
+  m_boundingBoxes.clear();
+
+  m_colliders.forEach([this, deltaTime] (const Entity& entity, const Collider& collider, const Transform& transform) {
+    const std::size_t colliderIndex = m_colliderEntries.size();
+    m_colliderEntries.push_back({ &entity, &collider, &transform, nullptr, std::numeric_limits<std::size_t>::max() });
+
+    if (entity.getId() >= m_entityColliderIndices.size())
+      m_entityColliderIndices.resize(entity.getId() + 1, std::numeric_limits<std::size_t>::max());
+    m_entityColliderIndices[entity.getId()] = colliderIndex;
+
+    if (entity.getId() >= m_entityGenerations.size())
+      m_entityGenerations.resize(entity.getId() + 1);
+    m_entityGenerations[entity.getId()] = entity.getGeneration();
+
+    if (entity.getId() < m_entityRigidBodies.size())
+      std::tie(m_colliderEntries.back().rigidBody, m_colliderEntries.back().rigidBodyIndex) = m_entityRigidBodies[entity.getId()];
+
+    if (collider.getShapeType() == ShapeType::PLANE) {
+      m_unboundedColliderIndices.emplace_back(colliderIndex);
+      return;
+    }
+
+    // The collider's shape being defined in its local space, its bounding box must be translated into the world's
+    AABB boundingBox = collider.getShape().computeBoundingBox();
+    boundingBox.translate(transform.getPosition());
+
+    // A collider held by a moving rigid body is bounded along the whole movement it may make during the step
+    const std::size_t colliderBodyIndex = m_colliderEntries.back().rigidBodyIndex;
 
-  for (Entity* entity : m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
+    if (colliderBodyIndex != std::numeric_limits<std::size_t>::max()) {
+      const Vec3f displacement = loadVector(m_rigidBodyStates.velocities, colliderBodyIndex) * deltaTime;
+      const Vec3f minDisplacement(std::min(displacement.x(), 0.f), std::min(displacement.y(), 0.f), std::min(displacement.z(), 0.f));
+      const Vec3f maxDisplacement(std::max(displacement.x(), 0.f), std::max(displacement.y(), 0.f), std::max(displacement.z(), 0.f));
+
+      boundingBox = AABB(boundingBox.getMinPosition() + minDisplacement, boundingBox.getMaxPosition() + maxDisplacement);
+    }
+
+    m_boundingBoxes.emplace_back(boundingBox);
+    m_boundedColliderIndices.emplace_back(colliderIndex);
+  });
+
+  const std::size_t colliderBoxCount = m_boundingBoxes.size();
+
+  const RigidBodyStates& states = m_rigidBodyStates;
+
+  for (std::size_t bodyIndex = 0; bodyIndex < m_rigidBodyEntries.size(); ++bodyIndex) {
+    const Vec3f position     = loadVector(states.oldPositions, bodyIndex);
+    const Vec3f nextPosition = position + loadVector(states.velocities, bodyIndex) * deltaTime;
+
+    // The whole movement the rigid body may make is bounded, so that a fast one finds the colliders it would otherwise travel right through
+    const AABB movementBox = Line(position, nextPosition).computeBoundingBox();
+    m_boundingBoxes.emplace_back(movementBox.getMinPosition() - Vec3f(contactMargin), movementBox.getMaxPosition() + Vec3f(contactMargin));
+  }
+
+  // Only the pairs made of a collider & a rigid body are relevant; the colliders' boxes being listed first, they come first in such pairs
+  m_broadphase->computeGroupPairs(m_boundingBoxes, colliderBoxCount, m_broadphasePairs);
+
+  // A rigid body can't collide with its own collider; these pairs are discarded so that the remaining ones are all checked precisely
+  m_broadphasePairs.erase(std::remove_if(m_broadphasePairs.begin(), m_broadphasePairs.end(), [this, colliderBoxCount] (const BroadphasePair& pair) {
+    return (m_colliderEntries[m_boundedColliderIndices[pair.first]].entity == m_rigidBodyEntries[pair.second - colliderBoxCount].entity);
+  }), m_broadphasePairs.end());
+
+  m_collisionCandidates.clear();
+
+  for (const auto& [colliderBoxIndex, movementBoxIndex] : m_broadphasePairs)
+    m_collisionCandidates.emplace_back(movementBoxIndex - colliderBoxCount, m_boundedColliderIndices[colliderBoxIndex]);
+
+  for (std::size_t rigidBodyIndex = 0; rigidBodyIndex < m_rigidBodyEntries.size(); ++rigidBodyIndex) {
+    for (const std::size_t colliderIndex : m_unboundedColliderIndices) {
+      if (m_colliderEntries[colliderIndex].entity != m_rigidBodyEntries[rigidBodyIndex].entity)
+        m_collisionCandidates.emplace_back(rigidBodyIndex, colliderIndex);
+    }
+  }
+
+  // The contacts are solved in the order of the rigid bodies, then of the colliders
+  std::sort(m_collisionCandidates.begin(), m_collisionCandidates.end());
+}
+
+void PhysicsSystem::computeIslands() {
+  const std::size_t bodyCount = m_rigidBodyEntries.size();
+
+  m_islandParents.resize(bodyCount);
+  std::iota(m_islandParents.begin(), m_islandParents.end(), static_cast<std::size_t>(0));
+
+  // A rigid body possibly colliding with another one's collider may alter the other's next collisions; both must be in the same island
+  for (const auto& [rigidBodyIndex, colliderIndex] : m_collisionCandidates) {
+    const std::size_t colliderBodyIndex = m_colliderEntries[colliderIndex].rigidBodyIndex;
+
+    if (colliderBodyIndex == std::numeric_limits<std::size_t>::max())
       continue;
 
-    auto& rigidBody = entity->getComponent<RigidBody>();
+    const std::size_t firstRoot  = findRoot(m_islandParents, rigidBodyIndex);
+    const std::size_t secondRoot = findRoot(m_islandParents, colliderBodyIndex);
 
-    if (rigidBody.getMass() <= 0.f)
+    // The lowest index always becomes the root, so that each island's root is its first rigid body
+    if (firstRoot < secondRoot)
+      m_islandParents[secondRoot] = firstRoot;
+    else if (secondRoot < firstRoot)
+      m_islandParents[firstRoot] = secondRoot;
+  }
+
+  // Islands are numbered in the order of their first rigid body, which is always processed before the other ones of its island
+  m_rigidBodyIslandIndices.resize(bodyCount);
+  std::size_t islandCount = 0;
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const std::size_t rootIndex = findRoot(m_islandParents, bodyIndex);
+    m_rigidBodyIslandIndices[bodyIndex] = (rootIndex == bodyIndex ? islandCount++ : m_rigidBodyIslandIndices[rootIndex]);
+  }
+
+  // The candidates are stably sorted by island, counting those of each island to find where they begin
+  m_islandCandidateOffsets.assign(islandCount + 1, 0);
+
+  for (const auto& candidate : m_collisionCandidates)
+    ++m_islandCandidateOffsets[m_rigidBodyIslandIndices[candidate.first] + 1];
+
+  std::partial_sum(m_islandCandidateOffsets.begin(), m_islandCandidateOffsets.end(), m_islandCandidateOffsets.begin());
+
+  m_sortedCandidates.resize(m_collisionCandidates.size());
+
+  // Each offset is used as the insertion index of its island, thus ending up as the next island's offset
+  for (const auto& candidate : m_collisionCandidates)
+    m_sortedCandidates[m_islandCandidateOffsets[m_rigidBodyIslandIndices[candidate.first]]++] = candidate;
+
+  std::copy_backward(m_islandCandidateOffsets.begin(), m_islandCandidateOffsets.end() - 1, m_islandCandidateOffsets.end());
+  m_islandCandidateOffsets.front() = 0;
+
+  std::swap(m_collisionCandidates, m_sortedCandidates);
+}
+
+void PhysicsSystem::computeContactGeometries() {
+  for (std::vector<std::size_t>& candidateIndices : m_shapeCandidateIndices)
+    candidateIndices.clear();
+
+  for (std::size_t candidateIndex = 0; candidateIndex < m_collisionCandidates.size(); ++candidateIndex) {
+    const auto [rigidBodyIndex, colliderIndex] = m_collisionCandidates[candidateIndex];
+    const ColliderEntry& colliderEntry = m_colliderEntries[colliderIndex];
+
+    Contact& contact          = m_contacts[candidateIndex];
+    contact.rigidBodyIndex    = rigidBodyIndex;
+    contact.colliderBodyIndex = colliderEntry.rigidBodyIndex;
+    contact.normalImpulse     = 0.f;
+    contact.hasImpact         = false;
+    contact.isActive          = false;
+
+    m_shapeCandidateIndices[static_cast<std::size_t>(colliderEntry.collider->getShapeType())].emplace_back(candidateIndex);
+  }
+
+  computeSphereContactGeometries();
+
+  // The other shapes are processed by a loop specialized for each of them, without any dynamic dispatch per contact
+  for (std::size_t shapeIndex = 0; shapeIndex < m_shapeCandidateIndices.size(); ++shapeIndex) {
+    if (shapeIndex == static_cast<std::size_t>(ShapeType::SPHERE))
       continue;
 
-    const Vec3f acceleration = (rigidBody.getMass() * m_gravity + rigidBody.getForces()) * rigidBody.getInvMass();
-    const Vec3f oldVelocity  = rigidBody.getVelocity();
+    const std::vector<std::size_t>& candidateIndices = m_shapeCandidateIndices[shapeIndex];
+
+    const auto computeGeometries = [this, &candidateIndices] (std::size_t beginIndex, std::size_t endIndex) {
+      for (std::size_t index = beginIndex; index < endIndex; ++index) {
+        const std::size_t candidateIndex   = candidateIndices[index];
+        const ColliderEntry& colliderEntry = m_colliderEntries[m_collisionCandidates[candidateIndex].second];
+        Contact& contact                   = m_contacts[candidateIndex];
+
+        // The contact is computed in the collider's local space, from the positions at the beginning of the step
+        const Vec3f localPos = loadVector(m_rigidBodyStates.oldPositions, contact.rigidBodyIndex) - colliderEntry.transform->getPosition();
+
+        colliderEntry.collider->visitShape([&contact, &localPos] (const auto& shape) noexcept {
+          contact.isActive = computePointContact(shape, localPos, contact.normal, contact.separation);
+        });
+      }
+    };
+
+    if (candidateIndices.size() < minParallelCandidateCount) {
+      computeGeometries(0, candidateIndices.size());
+    } else {
+      Threading::parallelFor(0, candidateIndices.size(), [&computeGeometries] (const Threading::IndexRange& range) {
+        computeGeometries(range.beginIndex, range.endIndex);
+      });
+    }
+  }
+}
+
+void PhysicsSystem::computeSphereContactGeometries() {
+  const std::vector<std::size_t>& candidateIndices = m_shapeCandidateIndices[static_cast<std::size_t>(ShapeType::SPHERE)];
+  const std::size_t contactCount = candidateIndices.size();
+
+  if (contactCount == 0)
+    return;
 
-    const Vec3f velocity = oldVelocity * relativeFriction + acceleration * deltaTime;
-    rigidBody.setVelocity(velocity);
+  for (Vec3Array* array : { &m_sphereContacts.relativePositions, &m_sphereContacts.normals }) {
+    array->x.resize(contactCount);
+    array->y.resize(contactCount);
+    array->z.resize(contactCount);
+  }
 
-    auto& transform = entity->getComponent<Transform>();
+  m_sphereContacts.radii.resize(contactCount);
+  m_sphereContacts.separations.resize(contactCount);
 
-    rigidBody.m_oldPosition = transform.getPosition();
-    transform.translate((oldVelocity + velocity) * 0.5f * deltaTime);
+  for (std::size_t index = 0; index < contactCount; ++index) {
+    const auto [rigidBodyIndex, colliderIndex] = m_collisionCandidates[candidateIndices[index]];
+    const ColliderEntry& colliderEntry = m_colliderEntries[colliderIndex];
+    const auto& sphere = colliderEntry.collider->getShape<Sphere>();
 
-    // The following acceleration calculation should be added to the translation to get a more accurate result:
-    //    acceleration * deltaTime * deltaTime * 0.5f
-    //  However, the acceleration would be multiplied by a tiny factor, making its effect barely noticeable
-    //  for a standard acceleration value. As such, it is left out of the displacement equation
+    const Vec3f localPos = loadVector(m_rigidBodyStates.oldPositions, rigidBodyIndex) - colliderEntry.transform->getPosition();
+    storeVector(m_sphereContacts.relativePositions, index, localPos - sphere.getCenter());
+    m_sphereContacts.radii[index] = sphere.getRadius();
   }
 
-  solveConstraints();
+  const SphereContactParams params { contactCount,
+                                     m_sphereContacts.relativePositions.x.data(),
+                                     m_sphereContacts.relativePositions.y.data(),
+                                     m_sphereContacts.relativePositions.z.data(),
+                                     m_sphereContacts.radii.data() };
+  computeSphereContacts(params, m_sphereContacts.normals, m_sphereContacts.separations.data());
+
+  for (std::size_t index = 0; index < contactCount; ++index) {
+    Contact& contact   = m_contacts[candidateIndices[index]];
+    contact.normal     = loadVector(m_sphereContacts.normals, index);
+    contact.separation = m_sphereContacts.separations[index];
+    contact.isActive   = true;
+  }
+}
 
-  return true;
+void PhysicsSystem::computeContact(std::size_t candidateIndex, float invDeltaTime) {
+  Contact& contact = m_contacts[candidateIndex];
+
+  // A contact whose geometry could not be computed is ignored
+  if (!contact.isActive)
+    return;
+
+  contact.isActive = false;
+
+  const std::size_t rigidBodyIndex = contact.rigidBodyIndex;
+  const bool hasColliderBody = (contact.colliderBodyIndex != std::numeric_limits<std::size_t>::max());
+
+  Vec3f relativeVelocity = loadVector(m_rigidBodyStates.velocities, rigidBodyIndex);
+  float invMassSum       = m_rigidBodyStates.invMasses[rigidBodyIndex];
+  float bounciness       = m_rigidBodyEntries[rigidBodyIndex].rigidBody->getBounciness();
+
+  if (hasColliderBody) {
+    relativeVelocity -= loadVector(m_rigidBodyStates.velocities, contact.colliderBodyIndex);
+    invMassSum       += m_rigidBodyStates.invMasses[contact.colliderBodyIndex];
+    bounciness        = std::max(bounciness, m_rigidBodyEntries[contact.colliderBodyIndex].rigidBody->getBounciness());
+  }
+
+  const bool isContinuous = m_rigidBodyEntries[rigidBodyIndex].rigidBody->isContinuousCollisionEnabled()
+                         || (hasColliderBody && m_rigidBodyEntries[contact.colliderBodyIndex].rigidBody->isContinuousCollisionEnabled());
+
+  // A continuous contact is taken where the rigid body hits the collider during the step, the contact being ignored if it never does; the
+  //  separation is then the distance from its starting position to the collider's tangent plane at the point of impact. Other shapes than
+  //  solid ones, or a rigid body already touching the collider, keep the contact found from its starting position
+  if (isContinuous && contact.separation > contactMargin) {
+    const ColliderEntry& colliderEntry = m_colliderEntries[m_collisionCandidates[candidateIndex].second];
+    const Vec3f localPos = loadVector(m_rigidBodyStates.oldPositions, rigidBodyIndex) - colliderEntry.transform->getPosition();
+    bool hasImpact       = true;
+
+    colliderEntry.collider->visitShape([&contact, &localPos, &relativeVelocity, &hasImpact, invDeltaTime] (const auto& shape) noexcept {
+      using ShapeT = std::decay_t<decltype(shape)>;
+
+      if constexpr (std::is_same_v<ShapeT, Sphere> || std::is_same_v<ShapeT, AABB> || std::is_same_v<ShapeT, OBB>) {
+        float impactTime {};
+        float impactSeparation {};
+        hasImpact = computeTimeOfImpact(shape, localPos, relativeVelocity, 1.f / invDeltaTime, contact.normal, impactTime, impactSeparation);
+        contact.separation = impactSeparation - relativeVelocity.dot(contact.normal) * impactTime;
+      }
+    });
+
+    if (!hasImpact)
+      return;
+
+    contact.hasImpact = true;
+  }
+
+  const float normalVelocity = relativeVelocity.dot(contact.normal);
+
+  // Speculative contact: the rigid body is only checked against the collider if it can reach it during the step
+  if (contact.separation > std::max(-normalVelocity, 0.f) / invDeltaTime + contactMargin)
+    return;
+
+  contact.isActive      = true;
+  contact.effectiveMass = 1.f / invMassSum;
+
+  // A separated rigid body may approach the collider by at most their distance, while a penetrating one is gradually pushed out
+  if (contact.separation > 0.f)
+    contact.targetVelocity = -contact.separation * invDeltaTime;
+  else
+    contact.targetVelocity = std::max(-contact.separation - penetrationSlop, 0.f) * penetrationCorrection * invDeltaTime;
+
+  // A rigid body hitting the collider during the step bounces off, unless being too slow, which allows it to come to rest. The contact first
+  //  brings it to the point of impact, the bounce velocity only being given once there, so that it bounces off from the collider's surface
+  //  instead of from wherever it started the step
+  const bool isBouncing = (normalVelocity < -restitutionThreshold && contact.separation + normalVelocity / invDeltaTime <= 0.f);
+
+  if (isBouncing)
+    contact.hasImpact = true;
+
+  if (contact.hasImpact)
+    contact.bounceVelocity = (isBouncing ? -normalVelocity * bounciness : 0.f);
+
+  if (!m_isWarmStartingEnabled)
+    return;
+
+  const std::size_t colliderIndex = m_collisionCandidates[candidateIndex].second;
+  const Entity& bodyEntity        = *m_rigidBodyEntries[rigidBodyIndex].entity;
+  const Entity& colliderEntity    = *m_colliderEntries[colliderIndex].entity;
+
+  const std::pair<std::size_t, std::size_t> entityIds(bodyEntity.getId(), colliderEntity.getId());
+  const auto manifoldIter = std::lower_bound(m_contactManifolds.cbegin(), m_contactManifolds.cend(), entityIds,
+                                             [] (const ContactManifold& manifold, const auto& ids) { return (manifold.entityIds < ids); });
+
+  // A manifold whose entities have been replaced by others reusing their IDs must not give them its impulse
+  if (manifoldIter == m_contactManifolds.cend() || manifoldIter->entityIds != entityIds
+   || manifoldIter->entityGenerations != std::make_pair(bodyEntity.getGeneration(), colliderEntity.getGeneration()))
+    return;
+
+  if (manifoldIter->normal.dot(contact.normal) >= warmStartingNormalDot)
+    contact.normalImpulse = manifoldIter->normalImpulse;
+}
+
+void PhysicsSystem::solveIsland(std::size_t islandIndex, float invDeltaTime) {
+  const std::size_t firstCandidateIndex = m_islandCandidateOffsets[islandIndex];
+  const std::size_t lastCandidateIndex  = m_islandCandidateOffsets[islandIndex + 1];
+
+  // All contacts are computed before any impulse is applied, so that they are all found from the same velocities, whatever their order
+  for (std::size_t candidateIndex = firstCandidateIndex; candidateIndex < lastCandidateIndex; ++candidateIndex)
+    computeContact(candidateIndex, invDeltaTime);
+
+  // The impulses found on the last step are applied beforehand, so that the iterations start close to the solution
+  for (std::size_t candidateIndex = firstCandidateIndex; candidateIndex < lastCandidateIndex; ++candidateIndex) {
+    const Contact& contact = m_contacts[candidateIndex];
+
+    if (contact.isActive && contact.normalImpulse != 0.f)
+      applyImpulse(contact, contact.normalImpulse);
+  }
+
+  for (std::size_t iterationIndex = 0; iterationIndex < m_solverIterationCount; ++iterationIndex) {
+    for (std::size_t candidateIndex = firstCandidateIndex; candidateIndex < lastCandidateIndex; ++candidateIndex) {
+      Contact& contact = m_contacts[candidateIndex];
+
+      if (!contact.isActive)
+        continue;
+
+      Vec3f relativeVelocity = loadVector(m_rigidBodyStates.velocities, contact.rigidBodyIndex);
+      if (contact.colliderBodyIndex != std::numeric_limits<std::size_t>::max())
+        relativeVelocity -= loadVector(m_rigidBodyStates.velocities, contact.colliderBodyIndex);
+
+      // The accumulated impulse is clamped instead of each individual one, so that an excessive impulse can later be compensated; it
+      //  however can never become negative, since contacts can only push rigid bodies apart
+      const float impulse      = (contact.targetVelocity - relativeVelocity.dot(contact.normal)) * contact.effectiveMass;
+      const float totalImpulse = std::max(contact.normalImpulse + impulse, 0.f);
+
+      applyImpulse(contact, totalImpulse - contact.normalImpulse);
+      contact.normalImpulse = totalImpulse;
+    }
+  }
+}
+
+void PhysicsSystem::applyImpulse(const Contact& contact, float impulse) {
+  const Vec3f impulseVec = contact.normal * impulse;
+
+  const std::size_t bodyIndex = contact.rigidBodyIndex;
+  storeVector(m_rigidBodyStates.velocities, bodyIndex,
+              loadVector(m_rigidBodyStates.velocities, bodyIndex) + impulseVec * m_rigidBodyStates.invMasses[bodyIndex]);
+
+  const std::size_t colliderBodyIndex = contact.colliderBodyIndex;
+
+  if (colliderBodyIndex != std::numeric_limits<std::size_t>::max()) {
+    storeVector(m_rigidBodyStates.velocities, colliderBodyIndex,
+                loadVector(m_rigidBodyStates.velocities, colliderBodyIndex) - impulseVec * m_rigidBodyStates.invMasses[colliderBodyIndex]);
+  }
+}
+
+void PhysicsSystem::solveConstraints(float deltaTime) {
+  computeCollisionCandidates(deltaTime);
+  computeIslands();
+
+  m_contacts.resize(m_collisionCandidates.size());
+  computeContactGeometries();
+
+  const float invDeltaTime      = 1.f / deltaTime;
+  const std::size_t islandCount = getIslandCount();
+
+  if (m_collisionCandidates.size() < minParallelCandidateCount) {
+    for (std::size_t islandIndex = 0; islandIndex < islandCount; ++islandIndex)
+      solveIsland(islandIndex, invDeltaTime);
+  } else {
+    // Islands being independent from each other & the contacts of each being solved in a fixed order, the results never depend on the
+    //  number of threads nor on the islands' processing order
+    Threading::parallelFor(0, islandCount, [this, invDeltaTime] (const Threading::IndexRange& range) {
+      for (std::size_t islandIndex = range.beginIndex; islandIndex < range.endIndex; ++islandIndex)
+        solveIsland(islandIndex, invDeltaTime);
+    });
+  }
+
+  storeContactManifolds();
 }
 
-void PhysicsSystem::solveConstraints() {
-  for (Entity* entity : m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
+void PhysicsSystem::applyImpactBounces() {
+  for (const Contact& contact : m_contacts) {
+    if (!contact.isActive || !contact.hasImpact)
       continue;
 
-    auto& rigidBody = entity->getComponent<RigidBody>();
+    Vec3f relativeVelocity = loadVector(m_rigidBodyStates.velocities, contact.rigidBodyIndex);
+    if (contact.colliderBodyIndex != std::numeric_limits<std::size_t>::max())
+      relativeVelocity -= loadVector(m_rigidBodyStates.velocities, contact.colliderBodyIndex);
 
-    if (rigidBody.getMass() <= 0.f)
+    const float normalVelocity = relativeVelocity.dot(contact.normal);
+
+    if (normalVelocity < contact.bounceVelocity)
+      applyImpulse(contact, (contact.bounceVelocity - normalVelocity) * contact.effectiveMass);
+  }
+}
+
+void PhysicsSystem::storeContactManifolds() {
+  // The manifolds of the sleeping rigid bodies are kept, so that they can be woken up if what they rest on moves away, & then be warm started
+  m_contactManifolds.erase(std::remove_if(m_contactManifolds.begin(), m_contactManifolds.end(), [this] (const ContactManifold& manifold) {
+    const std::size_t bodyEntityId = manifold.entityIds.first;
+    return (bodyEntityId >= m_entityRigidBodies.size() || m_entityRigidBodies[bodyEntityId].first == nullptr
+                                                       || m_entityRigidBodies[bodyEntityId].second != std::numeric_limits<std::size_t>::max()
+                                                       || m_entityGenerations[bodyEntityId] != manifold.entityGenerations.first);
+  }), m_contactManifolds.end());
+
+  for (std::size_t candidateIndex = 0; candidateIndex < m_contacts.size(); ++candidateIndex) {
+    const Contact& contact = m_contacts[candidateIndex];
+
+    if (!contact.isActive)
       continue;
 
-    const Vec3f velocity    = rigidBody.getVelocity();
-    const Vec3f velocityDir = (velocity.computeSquaredLength() != 0.f ? velocity.normalize() : Vec3f(0.f));
+    const std::size_t colliderIndex = m_collisionCandidates[candidateIndex].second;
+    const Entity& bodyEntity        = *m_rigidBodyEntries[contact.rigidBodyIndex].entity;
+    const Entity& colliderEntity    = *m_colliderEntries[colliderIndex].entity;
 
-    for (Entity* collidableEntity : m_entities) {
-      if (collidableEntity == entity || !collidableEntity->isEnabled() || !collidableEntity->hasComponent<Collider>())
-        continue;
+    m_contactManifolds.push_back({ std::make_pair(bodyEntity.getId(), colliderEntity.getId()),
+                                   std::make_pair(bodyEntity.getGeneration(), colliderEntity.getGeneration()),
+                                   contact.normal,
+                                   contact.normalImpulse });
+  }
 
-      assert("Error: A collidable entity must have a Transform component." && collidableEntity->hasComponent<Transform>());
+  std::sort(m_contactManifolds.begin(), m_contactManifolds.end(), [] (const ContactManifold& manifold1, const ContactManifold& manifold2) {
+    return (manifold1.entityIds < manifold2.entityIds);
+  });
+}
 
-      auto& collider = collidableEntity->getComponent<Collider>();
+void PhysicsSystem::updateSleepStates(float deltaTime) {
+  // The rigid bodies' velocity is deduced from their actual displacement, which accounts for the collisions & their corrections
+  const float maxRestingDistance = m_sleepVelocity * deltaTime;
+  const RigidBodyStates& states  = m_rigidBodyStates;
 
-      // The collision detection is made in the collider's local space
-      // The test shapes/rays must thus be translated into that space
-      const Vec3f colliderPos   = collidableEntity->getComponent<Transform>().getPosition();
-      const Vec3f localStartPos = rigidBody.m_oldPosition - colliderPos;
+  for (std::size_t bodyIndex = 0; bodyIndex < m_rigidBodyEntries.size(); ++bodyIndex) {
+    RigidBody& rigidBody = *m_rigidBodyEntries[bodyIndex].rigidBody;
 
-      auto& transform = entity->getComponent<Transform>();
+    const Vec3f displacement = loadVector(states.positions, bodyIndex) - loadVector(states.oldPositions, bodyIndex);
 
-      // We first try to determine if the last movement gave an intersection
-      // This is necessary in case our object has travelled too fast right through the collider,
-      //  ending behind it
-      const Line movementLine(localStartPos, transform.getPosition() - colliderPos);
-      if (!collider.intersects(movementLine))
-        continue;
+    if (displacement.computeSquaredLength() >= maxRestingDistance * maxRestingDistance) {
+      rigidBody.m_restingTime = 0.f;
+      continue;
+    }
 
-      const Ray ray(localStartPos, velocityDir);
+    rigidBody.m_restingTime += deltaTime;
 
-      RayHit hit;
-      if (!collider.intersects(ray, &hit))
-        continue;
+    if (rigidBody.m_restingTime >= m_sleepDelay) {
+      rigidBody.m_isSleeping = true;
+      rigidBody.m_velocity   = Vec3f(0.f);
+    }
+  }
+
+  // Moving rigid bodies pushing a sleeping one's collider wake it up, so that it reacts to the collision on the next step; those merely
+  //  resting on it do not, so that stacks can fall asleep
+  for (std::size_t candidateIndex = 0; candidateIndex < m_contacts.size(); ++candidateIndex) {
+    const Contact& contact = m_contacts[candidateIndex];
 
-      // Setting the entity's new position a little above the collision point
-      const Vec3f newPos = hit.position + hit.normal * 0.002f + colliderPos;
+    if (!contact.isActive || contact.normalImpulse <= 0.f || m_rigidBodyEntries[contact.rigidBodyIndex].rigidBody->m_restingTime > 0.f)
+      continue;
 
-      rigidBody.m_oldPosition = newPos;
-      transform.setPosition(newPos);
+    RigidBody* colliderRigidBody = m_colliderEntries[m_collisionCandidates[candidateIndex].second].rigidBody;
 
-      //                                     Vt/paraVec
-      //  Vel  N  Refl                  \---->
-      //    \  ^  ^                     | \          Vn is the velocity's perpendicular component to the surface
-      //     \ | /        ->            |   \        Vt is the velocity's parallel component to the surface
-      // _____v|/______      Vn/perpVec v    v Vel
+    if (colliderRigidBody != nullptr && colliderRigidBody->isSleeping())
+      colliderRigidBody->wakeUp();
+  }
 
-      const Vec3f paraVec = hit.normal * velocity.dot(hit.normal);
-      const Vec3f perpVec = velocity - paraVec;
+  if (m_sleepingRigidBodyCount == 0)
+    return;
 
-      rigidBody.setVelocity(perpVec - paraVec * rigidBody.getBounciness());
+  // Sleeping rigid bodies whose support, that is a collider they were in contact with when falling asleep, has moved or does not exist anymore
+  //  are woken up, so that they do not float in the air. A woken rigid body may in turn be the support of others, hence repeating until none
+  //  is woken anymore; the manifolds being sorted by entity, stacks built from the bottom usually take a single pass
+  bool hasWokenRigidBody = true;
+
+  while (hasWokenRigidBody) {
+    hasWokenRigidBody = false;
+
+    for (const ContactManifold& manifold : m_contactManifolds) {
+      const auto [bodyEntityId, colliderEntityId] = manifold.entityIds;
+      RigidBody* rigidBody = (bodyEntityId < m_entityRigidBodies.size() ? m_entityRigidBodies[bodyEntityId].first : nullptr);
+
+      if (rigidBody == nullptr || !rigidBody->isSleeping())
+        continue;
+
+      // A collider whose entity has been replaced by another reusing its ID does not exist anymore
+      const bool hasCollider = (colliderEntityId < m_entityColliderIndices.size()
+                             && m_entityColliderIndices[colliderEntityId] != std::numeric_limits<std::size_t>::max()
+                             && m_entityGenerations[colliderEntityId] == manifold.entityGenerations.second);
+      const RigidBody* supportRigidBody = (colliderEntityId < m_entityRigidBodies.size() ? m_entityRigidBodies[colliderEntityId].first : nullptr);
+      const bool hasSupportMoved = (supportRigidBody != nullptr && !supportRigidBody->isSleeping() && supportRigidBody->m_restingTime <= 0.f);
+
+      if (hasCollider && !hasSupportMoved)
+        continue;
 
-      break;
+      rigidBody->wakeUp();
+      hasWokenRigidBody = true;
     }
   }
 }
@@ -1,5 +1,3 @@
-#include "RaZ/Math/Transform.hpp"
-#include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/MeshRenderer.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
@@ -31,8 +29,6 @@ void RenderGraph::updateShaders() const {
 }
 
 void RenderGraph::execute(RenderSystem& renderSystem) {
-  assert("Error: The render system needs a camera for the render graph to be executed." && (renderSystem.m_cameraEntity != nullptr));
-
   Renderer::clear(MaskType::COLOR | MaskType::DEPTH | MaskType::STENCIL);
 
   const Framebuffer& geometryFramebuffer = m_geometryPass.getFramebuffer();
@@ -45,43 +41,22 @@ void RenderGraph::execute(RenderSystem& renderSystem) {
   if (!geometryFramebuffer.isEmpty())
     geometryFramebuffer.bind();
 
-  auto& camera       = renderSystem.m_cameraEntity->getComponent<Camera>();
-  auto& camTransform = renderSystem.m_cameraEntity->getComponent<Transform>();
+  // The frame is rendered only from its captured state, the entities possibly being modified meanwhile
+  const RenderPacket& renderPacket = renderSystem.m_renderPacket;
 
   renderSystem.m_cameraUbo.bind();
-
-  if (camTransform.hasUpdated()) {
-    if (camera.getCameraType() == CameraType::LOOK_AT)
-      camera.computeLookAt(camTransform.getPosition());
-    else
-      camera.computeViewMatrix(camTransform);
-
-    camera.computeInverseViewMatrix();
-
-    renderSystem.sendViewMatrix(camera.getViewMatrix());
-    renderSystem.sendInverseViewMatrix(camera.getInverseViewMatrix());
-    renderSystem.sendCameraPosition(camTransform.getPosition());
-
-    camTransform.setUpdated(false);
-  }
-
-  renderSystem.sendProjectionMatrix(camera.getProjectionMatrix());
-  renderSystem.sendInverseProjectionMatrix(camera.getInverseProjectionMatrix());
-  renderSystem.sendViewProjectionMatrix(camera.getProjectionMatrix() * camera.getViewMatrix());
+  renderSystem.sendViewMatrix(renderPacket.viewMatrix);
+  renderSystem.sendInverseViewMatrix(renderPacket.inverseViewMatrix);
+  renderSystem.sendProjectionMatrix(renderPacket.projectionMatrix);
+  renderSystem.sendInverseProjectionMatrix(renderPacket.inverseProjectionMatrix);
+  renderSystem.sendViewProjectionMatrix(renderPacket.projectionMatrix * renderPacket.viewMatrix);
+  renderSystem.sendCameraPosition(renderPacket.cameraPosition);
 
   renderSystem.m_modelUbo.bind();
 
-  for (const Entity* entity : renderSystem.m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<MeshRenderer>() || !entity->hasComponent<Transform>())
-      continue;
-
-    const auto& meshRenderer = entity->getComponent<MeshRenderer>();
-
-    if (!meshRenderer.isEnabled())
-      continue;
-
-    renderSystem.m_modelUbo.sendData(entity->getComponent<Transform>().computeTransformMatrix(), 0);
-    meshRenderer.draw();
+  for (const RenderPacket::MeshInstance& meshInstance : renderPacket.meshInstances) {
+    renderSystem.m_modelUbo.sendData(meshInstance.transformMatrix, 0);
+    meshInstance.meshRenderer->draw();
   }
 
   if (renderSystem.hasCubemap())
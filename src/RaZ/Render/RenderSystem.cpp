@@ -25,11 +25,63 @@ void RenderSystem::resizeViewport(unsigned int width, unsigned int height) {
   m_renderGraph.resizeViewport(m_sceneWidth, m_sceneHeight);
 }
 
+void RenderSystem::captureFrame() {
+  assert("Error: The render system needs a camera for a frame to be captured." && (m_cameraEntity != nullptr));
+
+  auto& camera       = m_cameraEntity->getComponent<Camera>();
+  auto& camTransform = m_cameraEntity->getComponent<Transform>();
+
+  if (camTransform.hasUpdated()) {
+    if (camera.getCameraType() == CameraType::LOOK_AT)
+      camera.computeLookAt(camTransform.getPosition());
+    else
+      camera.computeViewMatrix(camTransform);
+
+    camera.computeInverseViewMatrix();
+
+    camTransform.setUpdated(false);
+  }
+
+  m_renderPacket.viewMatrix              = camera.getViewMatrix();
+  m_renderPacket.inverseViewMatrix       = camera.getInverseViewMatrix();
+  m_renderPacket.projectionMatrix        = camera.getProjectionMatrix();
+  m_renderPacket.inverseProjectionMatrix = camera.getInverseProjectionMatrix();
+  m_renderPacket.cameraPosition          = camTransform.getPosition();
+
+  m_renderPacket.meshInstances.clear();
+
+  m_meshRenderers.forEach([this] (const MeshRenderer& meshRenderer, const Transform& transform) {
+    if (meshRenderer.isEnabled())
+      m_renderPacket.meshInstances.push_back({ &meshRenderer, transform.computeTransformMatrix() });
+  });
+
+  m_renderPacket.lights.clear();
+  m_lights.forEach([this] (const Entity& entity, const Light&) { m_renderPacket.lights.emplace_back(computeLightData(entity)); });
+
+  m_isFrameCaptured = true;
+}
+
 bool RenderSystem::update([[maybe_unused]] float deltaTime) {
+  // Executing the uploads first, so that the objects they create can be rendered in this frame
+  m_uploadQueue.execute(m_uploadTimeBudget);
+
+  if (!m_isFrameCaptured)
+    captureFrame();
+
+  m_isFrameCaptured = false;
+
   m_cameraUbo.bindBase(0);
   m_lightsUbo.bindBase(1);
   m_modelUbo.bindBase(2);
 
+  // The lights are sent on every frame, since the captured state is all that can be safely accessed while the frames are pipelined
+  m_lightsUbo.bind();
+
+  for (std::size_t lightIndex = 0; lightIndex < m_renderPacket.lights.size(); ++lightIndex)
+    sendLight(m_renderPacket.lights[lightIndex], static_cast<unsigned int>(lightIndex));
+
+  m_lightsUbo.sendData(static_cast<unsigned int>(m_renderPacket.lights.size()), sizeof(Vec4f) * 4 * 100);
+
   m_renderGraph.execute(*this);
 
 #if defined(RAZ_CONFIG_DEBUG) && !defined(SKIP_RENDERER_ERRORS)
@@ -59,20 +111,7 @@ void RenderSystem::sendCameraMatrices() const {
 }
 
 void RenderSystem::updateLight(const Entity& entity, unsigned int lightIndex) const {
-  const auto& light = entity.getComponent<Light>();
-  const std::size_t dataStride = sizeof(Vec4f) * 4 * lightIndex;
-
-  if (light.getType() == LightType::DIRECTIONAL) {
-    m_lightsUbo.sendData(Vec4f(0.f), static_cast<unsigned int>(dataStride));
-  } else {
-    assert("Error: A non-directional light needs to have a Transform component." && entity.hasComponent<Transform>());
-    m_lightsUbo.sendData(Vec4f(entity.getComponent<Transform>().getPosition(), 1.f), static_cast<unsigned int>(dataStride));
-  }
-
-  m_lightsUbo.sendData(light.getDirection(), static_cast<unsigned int>(dataStride + sizeof(Vec4f)));
-  m_lightsUbo.sendData(light.getColor(), static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 2));
-  m_lightsUbo.sendData(light.getEnergy(), static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3));
-  m_lightsUbo.sendData(light.getAngle().value, static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3 + sizeof(float)));
+  sendLight(computeLightData(entity), lightIndex);
 }
 
 void RenderSystem::updateLights() const {
@@ -157,17 +196,17 @@ void RenderSystem::destroy() {
 #endif
 }
 
-void RenderSystem::linkEntity(const EntityPtr& entity) {
+void RenderSystem::linkEntity(Entity& entity) {
   System::linkEntity(entity);
 
-  if (entity->hasComponent<Camera>())
-    m_cameraEntity = entity.get();
+  if (entity.hasComponent<Camera>())
+    m_cameraEntity = &entity;
 
-  if (entity->hasComponent<Light>())
+  if (entity.hasComponent<Light>())
     updateLights();
 
-  if (entity->hasComponent<MeshRenderer>())
-    updateMaterials(entity->getComponent<MeshRenderer>());
+  if (entity.hasComponent<MeshRenderer>())
+    updateMaterials(entity.getComponent<MeshRenderer>());
 }
 
 void RenderSystem::initialize() {
@@ -183,6 +222,11 @@ void RenderSystem::initialize() {
 #endif
 
   registerComponents<Camera, Light, MeshRenderer>();
+  registerViews(m_meshRenderers, m_lights);
+
+  // The rendering requires the graphics context, which is bound to the main thread
+  // Its component accesses are left undeclared, since the window's callbacks it executes may modify any component
+  requireMainThread();
 
 #if !defined(USE_OPENGL_ES)
   // Setting the depth to a [0; 1] range instead of a [-1; 1] one is always a good thing, since the [-1; 0] subrange is never used anyway
@@ -202,4 +246,32 @@ void RenderSystem::initialize(unsigned int sceneWidth, unsigned int sceneHeight)
   resizeViewport(sceneWidth, sceneHeight);
 }
 
+RenderPacket::LightData RenderSystem::computeLightData(const Entity& entity) {
+  const auto& light = entity.getComponent<Light>();
+
+  RenderPacket::LightData lightData;
+
+  if (light.getType() != LightType::DIRECTIONAL) {
+    assert("Error: A non-directional light needs to have a Transform component." && entity.hasComponent<Transform>());
+    lightData.position = Vec4f(entity.getComponent<Transform>().getPosition(), 1.f);
+  }
+
+  lightData.direction = light.getDirection();
+  lightData.color     = light.getColor();
+  lightData.energy    = light.getEnergy();
+  lightData.angle     = light.getAngle().value;
+
+  return lightData;
+}
+
+void RenderSystem::sendLight(const RenderPacket::LightData& lightData, unsigned int lightIndex) const {
+  const std::size_t dataStride = sizeof(Vec4f) * 4 * lightIndex;
+
+  m_lightsUbo.sendData(lightData.position, static_cast<unsigned int>(dataStride));
+  m_lightsUbo.sendData(lightData.direction, static_cast<unsigned int>(dataStride + sizeof(Vec4f)));
+  m_lightsUbo.sendData(lightData.color, static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 2));
+  m_lightsUbo.sendData(lightData.energy, static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3));
+  m_lightsUbo.sendData(lightData.angle, static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3 + sizeof(float)));
+}
+
 } // namespace Raz
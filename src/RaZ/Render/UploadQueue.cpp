@@ -0,0 +1,58 @@
+#include "RaZ/Render/UploadQueue.hpp"
+
+#include <chrono>
+
+namespace Raz {
+
+std::size_t UploadQueue::execute(float timeBudget) {
+  const auto startTime = std::chrono::steady_clock::now();
+
+  std::function<void()> upload;
+  std::size_t executedUploadCount = 0;
+
+  while (takeUpload(upload)) {
+    upload();
+    ++executedUploadCount;
+
+    if (std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count() >= timeBudget)
+      break;
+  }
+
+  return executedUploadCount;
+}
+
+std::size_t UploadQueue::executeAll() {
+  std::function<void()> upload;
+  std::size_t executedUploadCount = 0;
+
+  while (takeUpload(upload)) {
+    upload();
+    ++executedUploadCount;
+  }
+
+  return executedUploadCount;
+}
+
+void UploadQueue::clear() {
+  // The uploads are destroyed outside of the lock, since destroying their tasks may execute arbitrary code
+  std::deque<std::function<void()>> uploads;
+
+  {
+    std::lock_guard<std::mutex> lock(m_uploadsMutex);
+    uploads.swap(m_uploads);
+  }
+}
+
+bool UploadQueue::takeUpload(std::function<void()>& upload) {
+  std::lock_guard<std::mutex> lock(m_uploadsMutex);
+
+  if (m_uploads.empty())
+    return false;
+
+  upload = std::move(m_uploads.front());
+  m_uploads.pop_front();
+
+  return true;
+}
+
+} // namespace Raz
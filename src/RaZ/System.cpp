@@ -1,27 +1,54 @@
 #include "RaZ/System.hpp"
 
+#include <stdexcept>
+
 namespace Raz {
 
-bool System::containsEntity(const Entity& entity) const noexcept {
-  for (const Entity* entityPtr : m_entities) {
-    if (entityPtr->getId() == entity.getId())
-      return true;
-  }
+bool System::conflictsWith(const System& system) const {
+  if (!m_hasDeclaredAccesses || !system.m_hasDeclaredAccesses)
+    return true;
+
+  // Writing a component conflicts with any other access to it; concurrent reads are safe
+  return (m_writtenComponents.andAny(system.m_writtenComponents)
+       || m_writtenComponents.andAny(system.m_readComponents)
+       || m_readComponents.andAny(system.m_writtenComponents));
+}
+
+void System::setStepRate(float stepRate) {
+  if (stepRate < 0.f)
+    throw std::invalid_argument("Error: A system's step rate can't be negative.");
+
+  m_stepTime          = (stepRate > 0.f ? 1.f / stepRate : 0.f);
+  m_remainingStepTime = 0.f;
+}
 
-  return false;
+bool System::containsEntity(const Entity& entity) const noexcept {
+  return (m_entityIndices.find(entity.getId()) != m_entityIndices.cend());
 }
 
-void System::linkEntity(const EntityPtr& entity) {
-  m_entities.emplace_back(entity.get());
+void System::linkEntity(Entity& entity) {
+  if (!m_entityIndices.try_emplace(entity.getId(), m_entities.size()).second)
+    return; // The entity is already linked
+
+  m_entities.emplace_back(&entity);
 }
 
-void System::unlinkEntity(const EntityPtr& entity) {
-  for (std::size_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex) {
-    if (m_entities[entityIndex]->getId() == entity->getId()) {
-      m_entities.erase(m_entities.begin() + static_cast<std::ptrdiff_t>(entityIndex));
-      break;
-    }
+void System::unlinkEntity(Entity& entity) {
+  const auto indexIter = m_entityIndices.find(entity.getId());
+
+  if (indexIter == m_entityIndices.end())
+    return;
+
+  const std::size_t entityIndex = indexIter->second;
+  m_entityIndices.erase(indexIter);
+
+  // The last entity is moved in place of the unlinked one, avoiding to shift all the following ones
+  if (entityIndex != m_entities.size() - 1) {
+    m_entities[entityIndex] = m_entities.back();
+    m_entityIndices[m_entities[entityIndex]->getId()] = entityIndex;
   }
+
+  m_entities.pop_back();
 }
 
 } // namespace Raz
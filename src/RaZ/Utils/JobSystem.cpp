@@ -0,0 +1,149 @@
+#include "RaZ/Utils/JobSystem.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <cassert>
+
+namespace Raz {
+
+namespace {
+
+thread_local const JobHandle* currentJob = nullptr;
+
+} // namespace
+
+JobHandle JobSystem::getCurrentJob() {
+  return (currentJob != nullptr ? *currentJob : JobHandle());
+}
+
+JobSystem::~JobSystem() {
+  // The pool's actions executing the jobs refer to the job system, which must thus outlive all of them
+  m_threadPool.executeUntil([this] () { return (m_unfinishedJobCount.load(std::memory_order_acquire) == 0); });
+}
+
+void JobSystem::wait(const JobHandle& job) {
+  if (!job.isValid())
+    return;
+
+  m_threadPool.executeUntil([&job] () { return job.isFinished(); });
+
+  std::exception_ptr exception;
+
+  {
+    std::lock_guard<std::mutex> lock(job.m_job->mutex);
+    exception = job.m_job->exception;
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+void JobSystem::wait(std::initializer_list<JobHandle> jobs) {
+  for (const JobHandle& job : jobs)
+    wait(job);
+}
+
+JobHandle JobSystem::addJob(ThreadPool::Action action, const JobHandle* dependenciesBegin, const JobHandle* dependenciesEnd, const JobHandle& parent) {
+  m_unfinishedJobCount.fetch_add(1, std::memory_order_relaxed);
+
+  JobHandle job(std::make_shared<JobHandle::Job>());
+  job.m_job->action = std::move(action);
+
+  if (parent.isValid()) {
+    assert("Error: A child job cannot be added to a finished job." && !parent.isFinished());
+
+    parent.m_job->unfinishedCount.fetch_add(1, std::memory_order_relaxed);
+    job.m_job->parent = parent.m_job;
+  }
+
+  for (const JobHandle* dependency = dependenciesBegin; dependency != dependenciesEnd; ++dependency) {
+    if (!dependency->isValid())
+      continue;
+
+    // The dependency may be finishing concurrently; checking its state under its lock guarantees it will release the job if not already finished
+    std::lock_guard<std::mutex> lock(dependency->m_job->mutex);
+
+    if (dependency->isFinished())
+      continue;
+
+    job.m_job->remainingDependencyCount.fetch_add(1, std::memory_order_relaxed);
+    dependency->m_job->dependents.emplace_back(job.m_job);
+  }
+
+  // Releasing the dependency held while adding the job, which is scheduled right away if all the others are already finished
+  releaseDependency(job);
+
+  return job;
+}
+
+void JobSystem::releaseDependency(const JobHandle& job) {
+  if (job.m_job->remainingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+
+#if !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  m_threadPool.addAction([this, job] () { executeJob(job); });
+#else
+  executeJob(job);
+#endif
+}
+
+void JobSystem::executeJob(const JobHandle& job) {
+  // Jobs can be executed while waiting inside another one, thus the previous current job must be restored afterward
+  const JobHandle* const prevJob = currentJob;
+  currentJob = &job;
+
+  try {
+    job.m_job->action();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.m_job->mutex);
+
+    if (!job.m_job->exception)
+      job.m_job->exception = std::current_exception();
+  }
+
+  currentJob = prevJob;
+
+  finishJob(job);
+}
+
+void JobSystem::finishJob(const JobHandle& job) {
+  if (job.m_job->unfinishedCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+
+  // The action's captures are released as soon as possible, since handles to the job may be kept for long
+  job.m_job->action = ThreadPool::Action();
+
+  std::vector<std::shared_ptr<JobHandle::Job>> dependents;
+  std::exception_ptr exception;
+
+  {
+    std::lock_guard<std::mutex> lock(job.m_job->mutex);
+
+    job.m_job->isFinished.store(true, std::memory_order_release);
+    dependents.swap(job.m_job->dependents);
+    exception = job.m_job->exception;
+  }
+
+  for (std::shared_ptr<JobHandle::Job>& dependent : dependents)
+    releaseDependency(JobHandle(std::move(dependent)));
+
+  const JobHandle parent(std::move(job.m_job->parent));
+
+  if (parent.isValid()) {
+    if (exception) {
+      std::lock_guard<std::mutex> lock(parent.m_job->mutex);
+
+      if (!parent.m_job->exception)
+        parent.m_job->exception = std::move(exception);
+    }
+
+    finishJob(parent);
+  }
+
+  // This is the last access to the job system made for this job, which may be destroyed right after
+  m_unfinishedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace Raz
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -2,6 +2,9 @@
 #include "RaZ/Utils/Ray.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace Raz {
 
 namespace {
@@ -56,6 +59,51 @@ bool Ray::intersects(const Vec3f& point, RayHit* hit) const {
   return true;
 }
 
+bool Ray::intersects(const Line& line, RayHit* hit) const {
+  const Vec3f lineVec      = line.getEndPos() - line.getBeginPos();
+  const float lineSqLength = lineVec.computeSquaredLength();
+
+  if (FloatUtils::areNearlyEqual(lineSqLength, 0.f)) // The line is degenerate, being a mere point
+    return intersects(line.getBeginPos(), hit);
+
+  // The closest points between the ray & the line are found from their respective parameters; see Real-Time Collision Detection (Ericson, 2005), §5.1.9
+  const Vec3f lineOriginDir = m_origin - line.getBeginPos();
+  const float raySqLength   = m_direction.computeSquaredLength();
+  const float rayLineAngle  = m_direction.dot(lineVec);
+  const float rayOriginDist = m_direction.dot(lineOriginDir);
+  const float determinant   = raySqLength * lineSqLength - rayLineAngle * rayLineAngle;
+
+  float rayDist {};
+
+  if (FloatUtils::areNearlyEqual(determinant, 0.f)) {
+    // The ray & the line are parallel; the closest point along the ray is the nearest of the line's extremities, or its origin if they are behind it
+    rayDist = std::max(std::min(-rayOriginDist, rayLineAngle - rayOriginDist) / raySqLength, 0.f);
+  } else {
+    rayDist = std::max((rayLineAngle * lineVec.dot(lineOriginDir) - rayOriginDist * lineSqLength) / determinant, 0.f);
+  }
+
+  float lineDist = (rayLineAngle * rayDist + lineVec.dot(lineOriginDir)) / lineSqLength;
+
+  // If the closest point lies beyond one of the line's extremities, the closest point along the ray is recomputed from this extremity
+  if (lineDist < 0.f || lineDist > 1.f) {
+    lineDist = std::clamp(lineDist, 0.f, 1.f);
+    rayDist  = std::max((rayLineAngle * lineDist - rayOriginDist) / raySqLength, 0.f);
+  }
+
+  const Vec3f linePoint = line.getBeginPos() + lineVec * lineDist;
+
+  if (m_origin + m_direction * rayDist != linePoint)
+    return false;
+
+  if (hit) {
+    hit->position = linePoint;
+    hit->normal   = -m_direction;
+    hit->distance = rayDist;
+  }
+
+  return true;
+}
+
 bool Ray::intersects(const Plane& plane, RayHit* hit) const {
   const float dirAngle = m_direction.dot(plane.getNormal());
 
@@ -152,6 +200,44 @@ bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
   return true;
 }
 
+bool Ray::intersects(const Quad& quad, RayHit* hit) const {
+  const std::array<const Vec3f*, 4> vertices = { &quad.getLeftTopPos(), &quad.getRightTopPos(), &quad.getRightBottomPos(), &quad.getLeftBottomPos() };
+
+  const Vec3f normal   = (*vertices[1] - *vertices[0]).cross(*vertices[3] - *vertices[0]);
+  const float dirAngle    = normal.dot(m_direction);
+
+  if (FloatUtils::areNearlyEqual(dirAngle, 0.f)) // The ray is parallel to the quad
+    return false;
+
+  const float hitDist = normal.dot(*vertices[0] - m_origin) / dirAngle;
+
+  if (hitDist <= 0.f) // The quad is behind the ray
+    return false;
+
+  const Vec3f hitPos = m_origin + m_direction * hitDist;
+
+  // The hit point must lie on the inner side of each of the quad's edges, all of them being in the same winding order
+  for (std::size_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+    const Vec3f& edgeBegin = *vertices[vertexIndex];
+    const Vec3f& edgeEnd   = *vertices[(vertexIndex + 1) % vertices.size()];
+
+    if ((edgeEnd - edgeBegin).cross(hitPos - edgeBegin).dot(normal) < 0.f)
+      return false;
+  }
+
+  if (hit) {
+    hit->position = hitPos;
+
+    // As with triangles, the normal is made to face the ray
+    const Vec3f normedNormal = normal.normalize();
+    hit->normal = (dirAngle > 0.f ? -normedNormal : normedNormal);
+
+    hit->distance = hitDist;
+  }
+
+  return true;
+}
+
 bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
   // Branchless algorithm based on Tavianator's:
   //  - https://tavianator.com/fast-branchless-raybounding-box-intersections/
@@ -191,6 +277,23 @@ bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
   return true;
 }
 
+bool Ray::intersects(const OBB& obb, RayHit* hit) const {
+  // The ray is brought into the box's local space, in which the box is an AABB; the rotation preserving lengths, the hit distance is unchanged
+  const Vec3f centroid  = obb.computeCentroid();
+  const Mat3f& rotation = obb.getRotation();
+  const Ray localRay(rotation * (m_origin - centroid) + centroid, rotation * m_direction);
+
+  if (!localRay.intersects(AABB(obb.getMinPosition(), obb.getMaxPosition()), hit))
+    return false;
+
+  if (hit) {
+    hit->position = centroid + (hit->position - centroid) * rotation;
+    hit->normal   = hit->normal * rotation;
+  }
+
+  return true;
+}
+
 Vec3f Ray::computeProjection(const Vec3f& point) const {
   const float pointDist = m_direction.dot(point - m_origin);
   return (m_origin + m_direction * std::max(pointDist, 0.f));
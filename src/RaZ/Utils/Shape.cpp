@@ -1,11 +1,490 @@
 #include "RaZ/Utils/Shape.hpp"
 
+#include <array>
+
 namespace Raz {
 
+namespace {
+
+constexpr std::size_t maxGjkIterationCount = 32;
+constexpr std::size_t maxEpaIterationCount = 64;
+constexpr std::size_t maxEpaVertexCount    = maxEpaIterationCount + 4;
+constexpr std::size_t maxEpaFaceCount      = maxEpaVertexCount * 2; // A closed convex polytope with V vertices has at most 2V - 4 faces
+constexpr float contactTolerance           = 0.0001f; ///< Distance under which shapes are considered touching each other.
+constexpr float convergenceTolerance       = 0.0001f; ///< Relative progress under which the GJK & the EPA are considered converged.
+
+/// Point of the Minkowski difference between two shapes, along with the support points of each shape it has been computed from.
+struct SupportPoint {
+  Vec3f point {};
+  Vec3f firstPoint {};
+  Vec3f secondPoint {};
+};
+
+/// Simplex of up to 4 points of the Minkowski difference, along with the barycentric coordinates of its point closest to the origin.
+struct Simplex {
+  std::array<SupportPoint, 4> points {};
+  std::array<float, 4> weights {};
+  std::size_t pointCount = 0;
+
+  void addPoint(const SupportPoint& point, float weight) {
+    points[pointCount]  = point;
+    weights[pointCount] = weight;
+    ++pointCount;
+  }
+
+  SupportPoint computeClosestPoint() const {
+    SupportPoint closestPoint;
+
+    for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+      closestPoint.point       += points[pointIndex].point * weights[pointIndex];
+      closestPoint.firstPoint  += points[pointIndex].firstPoint * weights[pointIndex];
+      closestPoint.secondPoint += points[pointIndex].secondPoint * weights[pointIndex];
+    }
+
+    return closestPoint;
+  }
+};
+
+/// Polytope face used by the EPA, whose vertices are ordered counterclockwise when seen from outside.
+struct EpaFace {
+  std::array<std::size_t, 3> vertexIndices {};
+  Vec3f normal {};
+  float distance {}; ///< Distance between the origin & the face's plane.
+};
+
+SupportPoint computeSupportPoint(const Shape& first, const Shape& second, const Vec3f& direction) {
+  const Vec3f firstPoint  = first.computeSupport(direction);
+  const Vec3f secondPoint = second.computeSupport(-direction);
+
+  return { firstPoint - secondPoint, firstPoint, secondPoint };
+}
+
+Simplex computeSegmentClosestPoint(const SupportPoint& first, const SupportPoint& second) {
+  Simplex simplex;
+
+  const Vec3f segmentVec = second.point - first.point;
+  const float pointDist  = -first.point.dot(segmentVec);
+  const float sqLength   = segmentVec.computeSquaredLength();
+
+  if (pointDist <= 0.f || sqLength <= 0.f) {
+    simplex.addPoint(first, 1.f);
+  } else if (pointDist >= sqLength) {
+    simplex.addPoint(second, 1.f);
+  } else {
+    simplex.addPoint(first, 1.f - pointDist / sqLength);
+    simplex.addPoint(second, pointDist / sqLength);
+  }
+
+  return simplex;
+}
+
+Simplex computeTriangleClosestPoint(const SupportPoint& first, const SupportPoint& second, const SupportPoint& third) {
+  // The origin's location is found among the triangle's Voronoi regions, in the same way as in Triangle::computeProjection()
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.5
+
+  const Vec3f firstEdge  = second.point - first.point;
+  const Vec3f secondEdge = third.point - first.point;
+
+  const float firstDot1  = -firstEdge.dot(first.point);
+  const float secondDot1 = -secondEdge.dot(first.point);
+
+  Simplex simplex;
+
+  if (firstDot1 <= 0.f && secondDot1 <= 0.f) {
+    simplex.addPoint(first, 1.f);
+    return simplex;
+  }
+
+  const float firstDot2  = -firstEdge.dot(second.point);
+  const float secondDot2 = -secondEdge.dot(second.point);
+
+  if (firstDot2 >= 0.f && secondDot2 <= firstDot2) {
+    simplex.addPoint(second, 1.f);
+    return simplex;
+  }
+
+  const float thirdArea = firstDot1 * secondDot2 - firstDot2 * secondDot1;
+
+  if (thirdArea <= 0.f && firstDot1 >= 0.f && firstDot2 <= 0.f)
+    return computeSegmentClosestPoint(first, second);
+
+  const float firstDot3  = -firstEdge.dot(third.point);
+  const float secondDot3 = -secondEdge.dot(third.point);
+
+  if (secondDot3 >= 0.f && firstDot3 <= secondDot3) {
+    simplex.addPoint(third, 1.f);
+    return simplex;
+  }
+
+  const float secondArea = firstDot3 * secondDot1 - firstDot1 * secondDot3;
+
+  if (secondArea <= 0.f && secondDot1 >= 0.f && secondDot3 <= 0.f)
+    return computeSegmentClosestPoint(first, third);
+
+  const float firstArea = firstDot2 * secondDot3 - firstDot3 * secondDot2;
+
+  if (firstArea <= 0.f && (secondDot2 - firstDot2) >= 0.f && (firstDot3 - secondDot3) >= 0.f)
+    return computeSegmentClosestPoint(second, third);
+
+  const float totalArea = firstArea + secondArea + thirdArea;
+
+  // A degenerate triangle has no face region; its closest point is then on its longest edge, which contains the others
+  if (totalArea <= 0.f) {
+    const float firstSqLength  = firstEdge.computeSquaredLength();
+    const float secondSqLength = secondEdge.computeSquaredLength();
+    const float thirdSqLength  = (third.point - second.point).computeSquaredLength();
+
+    if (firstSqLength >= secondSqLength && firstSqLength >= thirdSqLength)
+      return computeSegmentClosestPoint(first, second);
+
+    return (secondSqLength >= thirdSqLength ? computeSegmentClosestPoint(first, third) : computeSegmentClosestPoint(second, third));
+  }
+
+  simplex.addPoint(first, firstArea / totalArea);
+  simplex.addPoint(second, secondArea / totalArea);
+  simplex.addPoint(third, thirdArea / totalArea);
+
+  return simplex;
+}
+
+/// Checks if the origin lies on the other side of a triangle's plane than a given point.
+/// If the point lies on the plane, the tetrahedron it forms with the triangle being flat, the origin is always considered to be outside.
+bool isOriginOutsidePlane(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos, const Vec3f& oppositePos) {
+  const Vec3f normal       = (secondPos - firstPos).cross(thirdPos - firstPos);
+  const float originSide   = -normal.dot(firstPos);
+  const float oppositeSide = normal.dot(oppositePos - firstPos);
+
+  return (originSide * oppositeSide <= 0.f);
+}
+
+Simplex computeTetrahedronClosestPoint(const Simplex& tetrahedron) {
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.6
+  const std::array<std::array<std::size_t, 4>, 4> faces = {{ { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } }};
+
+  Simplex closestSimplex = tetrahedron;
+  float minSqDist        = std::numeric_limits<float>::max();
+  bool isOriginInside    = true;
+
+  for (const auto& [firstIndex, secondIndex, thirdIndex, oppositeIndex] : faces) {
+    const SupportPoint& first  = tetrahedron.points[firstIndex];
+    const SupportPoint& second = tetrahedron.points[secondIndex];
+    const SupportPoint& third  = tetrahedron.points[thirdIndex];
+
+    if (!isOriginOutsidePlane(first.point, second.point, third.point, tetrahedron.points[oppositeIndex].point))
+      continue;
+
+    isOriginInside = false;
+
+    const Simplex faceSimplex = computeTriangleClosestPoint(first, second, third);
+    const float sqDist        = faceSimplex.computeClosestPoint().point.computeSquaredLength();
+
+    if (sqDist < minSqDist) {
+      closestSimplex = faceSimplex;
+      minSqDist      = sqDist;
+    }
+  }
+
+  // If the origin is inside the tetrahedron, the latter is kept whole; its closest point being the origin itself, its weights are unused
+  return (isOriginInside ? tetrahedron : closestSimplex);
+}
+
+/// Finds with the GJK algorithm the simplex of the Minkowski difference between two shapes which is the closest to the origin.
+/// See: A fast procedure for computing the distance between complex objects in three-dimensional space (Gilbert, Johnson & Keerthi)
+/// \param first First shape.
+/// \param second Second shape.
+/// \param simplex Simplex closest to the origin, along with the barycentric coordinates of its closest point.
+/// \return True if the shapes intersect each other, the Minkowski difference then containing the origin, false otherwise.
+bool computeClosestSimplex(const Shape& first, const Shape& second, Simplex& simplex) {
+  Vec3f direction = first.computeCentroid() - second.computeCentroid();
+
+  if (direction.computeSquaredLength() <= 0.f)
+    direction = Axis::X;
+
+  simplex = Simplex();
+  simplex.addPoint(computeSupportPoint(first, second, direction), 1.f);
+
+  Vec3f closestPoint = simplex.points[0].point;
+
+  for (std::size_t iterationIndex = 0; iterationIndex < maxGjkIterationCount; ++iterationIndex) {
+    const float sqDist = closestPoint.computeSquaredLength();
+
+    if (sqDist <= contactTolerance * contactTolerance)
+      return true;
+
+    const SupportPoint supportPoint = computeSupportPoint(first, second, -closestPoint);
+
+    // If the new point does not get significantly closer to the origin than the current closest one, the latter is the closest possible
+    if (sqDist - closestPoint.dot(supportPoint.point) <= sqDist * convergenceTolerance)
+      return false;
+
+    simplex.points[simplex.pointCount++] = supportPoint;
+
+    switch (simplex.pointCount) {
+      case 2:
+        simplex = computeSegmentClosestPoint(simplex.points[0], simplex.points[1]);
+        break;
+
+      case 3:
+        simplex = computeTriangleClosestPoint(simplex.points[0], simplex.points[1], simplex.points[2]);
+        break;
+
+      case 4:
+      default:
+        simplex = computeTetrahedronClosestPoint(simplex);
+        break;
+    }
+
+    // A simplex remaining a tetrahedron contains the origin
+    if (simplex.pointCount == 4)
+      return true;
+
+    closestPoint = simplex.computeClosestPoint().point;
+  }
+
+  return false;
+}
+
+/// Expands a simplex containing the origin into a tetrahedron, from which the EPA can start.
+/// \return True if the simplex could be expanded, false if the Minkowski difference is flat.
+bool expandToTetrahedron(const Shape& first, const Shape& second, Simplex& simplex) {
+  constexpr std::array<Vec3f, 3> axes = { Axis::X, Axis::Y, Axis::Z };
+
+  if (simplex.pointCount == 1) {
+    for (const Vec3f& axis : axes) {
+      for (const Vec3f& direction : { axis, -axis }) {
+        const SupportPoint supportPoint = computeSupportPoint(first, second, direction);
+
+        if ((supportPoint.point - simplex.points[0].point).computeSquaredLength() > contactTolerance * contactTolerance) {
+          simplex.points[simplex.pointCount++] = supportPoint;
+          break;
+        }
+      }
+
+      if (simplex.pointCount == 2)
+        break;
+    }
+  }
+
+  if (simplex.pointCount == 2) {
+    const Vec3f lineDir = (simplex.points[1].point - simplex.points[0].point).normalize();
+
+    for (const Vec3f& axis : axes) {
+      const Vec3f perpDir = lineDir.cross(axis);
+
+      if (perpDir.computeSquaredLength() <= convergenceTolerance)
+        continue;
+
+      for (const Vec3f& direction : { perpDir, -perpDir }) {
+        const SupportPoint supportPoint = computeSupportPoint(first, second, direction);
+
+        if ((supportPoint.point - simplex.points[0].point).cross(lineDir).computeSquaredLength() > contactTolerance * contactTolerance) {
+          simplex.points[simplex.pointCount++] = supportPoint;
+          break;
+        }
+      }
+
+      if (simplex.pointCount == 3)
+        break;
+    }
+  }
+
+  if (simplex.pointCount == 3) {
+    const Vec3f normal = (simplex.points[1].point - simplex.points[0].point).cross(simplex.points[2].point - simplex.points[0].point).normalize();
+
+    for (const Vec3f& direction : { normal, -normal }) {
+      const SupportPoint supportPoint = computeSupportPoint(first, second, direction);
+
+      if (std::abs((supportPoint.point - simplex.points[0].point).dot(normal)) > contactTolerance) {
+        simplex.points[simplex.pointCount++] = supportPoint;
+        break;
+      }
+    }
+  }
+
+  return (simplex.pointCount == 4);
+}
+
+EpaFace makeEpaFace(const std::array<SupportPoint, maxEpaVertexCount>& vertices, std::size_t firstIndex, std::size_t secondIndex, std::size_t thirdIndex) {
+  EpaFace face { { firstIndex, secondIndex, thirdIndex }, Vec3f(0.f), std::numeric_limits<float>::max() };
+
+  const Vec3f& firstPos    = vertices[firstIndex].point;
+  const Vec3f normal       = (vertices[secondIndex].point - firstPos).cross(vertices[thirdIndex].point - firstPos);
+  const float normalLength = normal.computeLength();
+
+  // A degenerate face has no normal; its distance is left infinite so that it is never picked as the closest one
+  if (normalLength > 0.f) {
+    face.normal   = normal / normalLength;
+    face.distance = face.normal.dot(firstPos);
+  }
+
+  return face;
+}
+
+/// Finds with the EPA the face of the Minkowski difference closest to the origin, which gives the penetration depth & direction.
+/// See: Proximity Queries and Penetration Depth Computation on 3D Game Objects (Gino van den Bergen)
+/// \param first First shape.
+/// \param second Second shape.
+/// \param tetrahedron Tetrahedron of the Minkowski difference containing the origin.
+/// \param contact Contact between both shapes.
+void computePenetration(const Shape& first, const Shape& second, const Simplex& tetrahedron, ShapeContact& contact) {
+  std::array<SupportPoint, maxEpaVertexCount> vertices {};
+  std::copy(tetrahedron.points.cbegin(), tetrahedron.points.cend(), vertices.begin());
+  std::size_t vertexCount = 4;
+
+  // The faces are ordered so that their normal points outward, the fourth vertex having to be behind the first face
+  const Vec3f firstNormal = (vertices[1].point - vertices[0].point).cross(vertices[2].point - vertices[0].point);
+
+  if (firstNormal.dot(vertices[3].point - vertices[0].point) > 0.f)
+    std::swap(vertices[1], vertices[2]);
+
+  std::array<EpaFace, maxEpaFaceCount> faces {};
+  faces[0] = makeEpaFace(vertices, 0, 1, 2);
+  faces[1] = makeEpaFace(vertices, 0, 3, 1);
+  faces[2] = makeEpaFace(vertices, 0, 2, 3);
+  faces[3] = makeEpaFace(vertices, 1, 3, 2);
+  std::size_t faceCount = 4;
+
+  std::array<std::pair<std::size_t, std::size_t>, maxEpaFaceCount * 3> horizonEdges {};
+  EpaFace closestFace {};
+  SupportPoint supportPoint;
+  bool hasConverged = false;
+
+  // Each iteration adds a vertex to the polytope, until it reaches the Minkowski difference's boundary or all the vertices are used
+  while (true) {
+    std::size_t closestFaceIndex = 0;
+
+    for (std::size_t faceIndex = 1; faceIndex < faceCount; ++faceIndex) {
+      if (faces[faceIndex].distance < faces[closestFaceIndex].distance)
+        closestFaceIndex = faceIndex;
+    }
+
+    closestFace  = faces[closestFaceIndex];
+    supportPoint = computeSupportPoint(first, second, closestFace.normal);
+
+    // If the polytope cannot be expanded significantly further in the closest face's direction, it is the Minkowski difference's boundary
+    const float supportDist = supportPoint.point.dot(closestFace.normal);
+    hasConverged            = (supportDist - closestFace.distance <= contactTolerance);
+
+    if (hasConverged || vertexCount == maxEpaVertexCount)
+      break;
+
+    // The faces visible from the new point are removed, the edges bordering them forming the horizon from which the new faces are made
+    std::size_t horizonEdgeCount = 0;
+
+    for (std::size_t faceIndex = faceCount; faceIndex-- > 0;) {
+      const EpaFace& face = faces[faceIndex];
+
+      if (face.normal.dot(supportPoint.point - vertices[face.vertexIndices[0]].point) <= 0.f)
+        continue;
+
+      for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+        const std::size_t edgeBegin = face.vertexIndices[edgeIndex];
+        const std::size_t edgeEnd   = face.vertexIndices[(edgeIndex + 1) % 3];
+
+        // An edge shared by two removed faces is found in reverse order; it is then inside the hole & not part of the horizon
+        const auto edgeEndIter = horizonEdges.begin() + static_cast<std::ptrdiff_t>(horizonEdgeCount);
+        const auto reverseEdge = std::find(horizonEdges.begin(), edgeEndIter, std::make_pair(edgeEnd, edgeBegin));
+
+        if (reverseEdge != edgeEndIter)
+          *reverseEdge = horizonEdges[--horizonEdgeCount];
+        else
+          horizonEdges[horizonEdgeCount++] = std::make_pair(edgeBegin, edgeEnd);
+      }
+
+      faces[faceIndex] = faces[--faceCount];
+    }
+
+    // The polytope cannot be expanded anymore; the closest face found before the removal is kept
+    if (faceCount + horizonEdgeCount > maxEpaFaceCount || horizonEdgeCount == 0)
+      break;
+
+    vertices[vertexCount] = supportPoint;
+
+    for (std::size_t edgeIndex = 0; edgeIndex < horizonEdgeCount; ++edgeIndex)
+      faces[faceCount++] = makeEpaFace(vertices, horizonEdges[edgeIndex].first, horizonEdges[edgeIndex].second, vertexCount);
+
+    ++vertexCount;
+  }
+
+  // The shapes are separated by moving the first one along the opposite of the face's normal
+  contact.normal = -closestFace.normal;
+
+  if (!hasConverged) {
+    // The polytope not having reached the Minkowski difference's boundary, which happens with curved shapes, its closest face underestimates
+    //  the penetration depth; the support point in that face's direction is used instead, so that the penetration is never underestimated
+    contact.separation  = -supportPoint.point.dot(closestFace.normal);
+    contact.firstPoint  = supportPoint.firstPoint;
+    contact.secondPoint = supportPoint.secondPoint;
+    return;
+  }
+
+  const SupportPoint closestPoint = computeTriangleClosestPoint(vertices[closestFace.vertexIndices[0]],
+                                                                vertices[closestFace.vertexIndices[1]],
+                                                                vertices[closestFace.vertexIndices[2]]).computeClosestPoint();
+
+  contact.separation  = -closestFace.distance;
+  contact.firstPoint  = closestPoint.firstPoint;
+  contact.secondPoint = closestPoint.secondPoint;
+}
+
+bool areIntersecting(const Shape& first, const Shape& second) {
+  Simplex simplex;
+  return computeClosestSimplex(first, second, simplex);
+}
+
+bool isIntersectingPlane(const Plane& plane, const Shape& shape) {
+  // The shape intersects the plane if its farthest points on each side of it are not on the same side
+  const float maxDist = plane.getNormal().dot(shape.computeSupport(plane.getNormal())) - plane.getDistance();
+  const float minDist = plane.getNormal().dot(shape.computeSupport(-plane.getNormal())) - plane.getDistance();
+
+  return (minDist <= 0.f && maxDist >= 0.f);
+}
+
+} // namespace
+
+// Shape functions
+
+bool Shape::computeContact(const Shape& shape, ShapeContact& contact) const {
+  Simplex simplex;
+
+  if (!computeClosestSimplex(*this, shape, simplex)) {
+    const SupportPoint closestPoint = simplex.computeClosestPoint();
+    const float distance            = closestPoint.point.computeLength();
+
+    contact.normal      = closestPoint.point / distance;
+    contact.separation  = distance;
+    contact.firstPoint  = closestPoint.firstPoint;
+    contact.secondPoint = closestPoint.secondPoint;
+
+    return false;
+  }
+
+  const SupportPoint touchingPoint = simplex.computeClosestPoint();
+
+  if (simplex.pointCount == 4 || expandToTetrahedron(*this, shape, simplex)) {
+    computePenetration(*this, shape, simplex, contact);
+    return true;
+  }
+
+  // The Minkowski difference being flat, the shapes can be separated without any movement along its normal; they are merely touching
+  contact.separation  = 0.f;
+  contact.firstPoint  = touchingPoint.firstPoint;
+  contact.secondPoint = touchingPoint.secondPoint;
+
+  if (simplex.pointCount == 3) {
+    contact.normal = (simplex.points[1].point - simplex.points[0].point).cross(simplex.points[2].point - simplex.points[0].point).normalize();
+  } else {
+    const Vec3f lineDir = (simplex.pointCount == 2 ? simplex.points[1].point - simplex.points[0].point : Axis::Z);
+    contact.normal      = (std::abs(lineDir.y()) < std::abs(lineDir.x()) ? Vec3f(-lineDir.z(), 0.f, lineDir.x()) : Vec3f(0.f, lineDir.z(), -lineDir.y())).normalize();
+  }
+
+  return true;
+}
+
 // Line functions
 
-bool Line::intersects(const Line&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Line& line) const {
+  return areIntersecting(*this, line);
 }
 
 bool Line::intersects(const Plane& plane) const {
@@ -29,12 +508,12 @@ bool Line::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Line::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Triangle& triangle) const {
+  return areIntersecting(*this, triangle);
 }
 
-bool Line::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Quad& quad) const {
+  return areIntersecting(*this, quad);
 }
 
 bool Line::intersects(const AABB& aabb) const {
@@ -62,8 +541,8 @@ bool Line::intersects(const AABB& aabb) const {
   return (hit.distance * hit.distance <= computeSquaredLength());
 }
 
-bool Line::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
 }
 
 void Line::translate(const Vec3f& translation) noexcept {
@@ -108,12 +587,12 @@ bool Plane::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Plane::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Triangle& triangle) const {
+  return isIntersectingPlane(*this, triangle);
 }
 
-bool Plane::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Quad& quad) const {
+  return isIntersectingPlane(*this, quad);
 }
 
 bool Plane::intersects(const AABB& aabb) const {
@@ -127,8 +606,8 @@ bool Plane::intersects(const AABB& aabb) const {
   return (std::abs(boxDist) <= topBoxDist);
 }
 
-bool Plane::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const OBB& obb) const {
+  return isIntersectingPlane(*this, obb);
 }
 
 AABB Plane::computeBoundingBox() const {
@@ -164,8 +643,17 @@ bool Sphere::intersects(const AABB& aabb) const {
   return contains(projPoint);
 }
 
-bool Sphere::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Sphere::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
+}
+
+Vec3f Sphere::computeSupport(const Vec3f& direction) const {
+  const float dirLength = direction.computeLength();
+
+  if (dirLength <= 0.f)
+    return m_centerPos;
+
+  return m_centerPos + direction * (m_radius / dirLength);
 }
 
 AABB Sphere::computeBoundingBox() const {
@@ -174,20 +662,20 @@ AABB Sphere::computeBoundingBox() const {
 
 // Triangle functions
 
-bool Triangle::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Triangle& triangle) const {
+  return areIntersecting(*this, triangle);
 }
 
-bool Triangle::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Quad& quad) const {
+  return areIntersecting(*this, quad);
 }
 
-bool Triangle::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const AABB& aabb) const {
+  return areIntersecting(*this, aabb);
 }
 
-bool Triangle::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
 }
 
 void Triangle::translate(const Vec3f& translation) noexcept {
@@ -196,8 +684,63 @@ void Triangle::translate(const Vec3f& translation) noexcept {
   m_thirdPos  += translation;
 }
 
-Vec3f Triangle::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Triangle::computeProjection(const Vec3f& point) const {
+  // The point's location is found among the triangle's Voronoi regions: each vertex's, each edge's or the face's
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.5
+
+  const Vec3f firstEdge  = m_secondPos - m_firstPos;
+  const Vec3f secondEdge = m_thirdPos - m_firstPos;
+
+  const Vec3f firstPointDir = point - m_firstPos;
+  const float firstDot1     = firstEdge.dot(firstPointDir);
+  const float secondDot1    = secondEdge.dot(firstPointDir);
+
+  if (firstDot1 <= 0.f && secondDot1 <= 0.f)
+    return m_firstPos;
+
+  const Vec3f secondPointDir = point - m_secondPos;
+  const float firstDot2      = firstEdge.dot(secondPointDir);
+  const float secondDot2     = secondEdge.dot(secondPointDir);
+
+  if (firstDot2 >= 0.f && secondDot2 <= firstDot2)
+    return m_secondPos;
+
+  const float thirdArea = firstDot1 * secondDot2 - firstDot2 * secondDot1;
+
+  if (thirdArea <= 0.f && firstDot1 >= 0.f && firstDot2 <= 0.f)
+    return m_firstPos + firstEdge * (firstDot1 / (firstDot1 - firstDot2));
+
+  const Vec3f thirdPointDir = point - m_thirdPos;
+  const float firstDot3     = firstEdge.dot(thirdPointDir);
+  const float secondDot3    = secondEdge.dot(thirdPointDir);
+
+  if (secondDot3 >= 0.f && firstDot3 <= secondDot3)
+    return m_thirdPos;
+
+  const float secondArea = firstDot3 * secondDot1 - firstDot1 * secondDot3;
+
+  if (secondArea <= 0.f && secondDot1 >= 0.f && secondDot3 <= 0.f)
+    return m_firstPos + secondEdge * (secondDot1 / (secondDot1 - secondDot3));
+
+  const float firstArea = firstDot2 * secondDot3 - firstDot3 * secondDot2;
+
+  if (firstArea <= 0.f && (secondDot2 - firstDot2) >= 0.f && (firstDot3 - secondDot3) >= 0.f)
+    return m_secondPos + (m_thirdPos - m_secondPos) * ((secondDot2 - firstDot2) / ((secondDot2 - firstDot2) + (firstDot3 - secondDot3)));
+
+  // The point is located above the face; its projection is computed from its barycentric coordinates
+  const float invTotalArea = 1.f / (firstArea + secondArea + thirdArea);
+  return m_firstPos + firstEdge * (secondArea * invTotalArea) + secondEdge * (thirdArea * invTotalArea);
+}
+
+Vec3f Triangle::computeSupport(const Vec3f& direction) const {
+  const float firstDist  = m_firstPos.dot(direction);
+  const float secondDist = m_secondPos.dot(direction);
+  const float thirdDist  = m_thirdPos.dot(direction);
+
+  if (firstDist >= secondDist && firstDist >= thirdDist)
+    return m_firstPos;
+
+  return (secondDist >= thirdDist ? m_secondPos : m_thirdPos);
 }
 
 AABB Triangle::computeBoundingBox() const {
@@ -226,16 +769,16 @@ void Triangle::makeCounterClockwise(const Vec3f& normal) {
 
 // Quad functions
 
-bool Quad::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const Quad& quad) const {
+  return areIntersecting(*this, quad);
 }
 
-bool Quad::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const AABB& aabb) const {
+  return areIntersecting(*this, aabb);
 }
 
-bool Quad::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
 }
 
 void Quad::translate(const Vec3f& translation) noexcept {
@@ -245,8 +788,20 @@ void Quad::translate(const Vec3f& translation) noexcept {
   m_leftBottomPos  += translation;
 }
 
-Vec3f Quad::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Quad::computeProjection(const Vec3f& point) const {
+  // The quad is split into two triangles, the closest projection of both being kept
+  const Vec3f firstProj  = Triangle(m_leftTopPos, m_rightTopPos, m_rightBottomPos).computeProjection(point);
+  const Vec3f secondProj = Triangle(m_leftTopPos, m_rightBottomPos, m_leftBottomPos).computeProjection(point);
+
+  return ((point - firstProj).computeSquaredLength() <= (point - secondProj).computeSquaredLength() ? firstProj : secondProj);
+}
+
+Vec3f Quad::computeSupport(const Vec3f& direction) const {
+  const std::array<const Vec3f*, 4> vertices = { &m_leftTopPos, &m_rightTopPos, &m_rightBottomPos, &m_leftBottomPos };
+
+  return **std::max_element(vertices.cbegin(), vertices.cend(), [&direction] (const Vec3f* vertex1, const Vec3f* vertex2) {
+    return (vertex1->dot(direction) < vertex2->dot(direction));
+  });
 }
 
 AABB Quad::computeBoundingBox() const {
@@ -296,8 +851,8 @@ bool AABB::intersects(const AABB& aabb) const {
   return (intersectsX && intersectsY && intersectsZ);
 }
 
-bool AABB::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool AABB::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
 }
 
 void AABB::translate(const Vec3f& translation) noexcept {
@@ -313,6 +868,12 @@ Vec3f AABB::computeProjection(const Vec3f& point) const {
   return Vec3f(closestX, closestY, closestZ);
 }
 
+Vec3f AABB::computeSupport(const Vec3f& direction) const {
+  return Vec3f(direction.x() >= 0.f ? m_maxPos.x() : m_minPos.x(),
+               direction.y() >= 0.f ? m_maxPos.y() : m_minPos.y(),
+               direction.z() >= 0.f ? m_maxPos.z() : m_minPos.z());
+}
+
 // OBB functions
 
 void OBB::setRotation(const Mat3f& rotation) {
@@ -320,20 +881,48 @@ void OBB::setRotation(const Mat3f& rotation) {
   m_invRotation = m_rotation.inverse();
 }
 
-bool OBB::contains(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool OBB::contains(const Vec3f& point) const {
+  // The point is brought into the box's local space, in which it can be checked as with an AABB
+  const Vec3f centroid = computeCentroid();
+  return m_aabb.contains(m_rotation * (point - centroid) + centroid);
 }
 
-bool OBB::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool OBB::intersects(const OBB& obb) const {
+  return areIntersecting(*this, obb);
 }
 
-Vec3f OBB::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f OBB::computeProjection(const Vec3f& point) const {
+  // The point is projected onto the box in its local space, then brought back into the world one
+  const Vec3f centroid  = computeCentroid();
+  const Vec3f localProj = m_aabb.computeProjection(m_rotation * (point - centroid) + centroid);
+
+  return centroid + (localProj - centroid) * m_rotation;
+}
+
+Vec3f OBB::computeSupport(const Vec3f& direction) const {
+  // The direction is brought into the box's local space, where the support point is the corner lying the farthest along it
+  const Vec3f localDir    = m_rotation * direction;
+  const Vec3f halfExtents = m_aabb.computeHalfExtents();
+  const Vec3f localCorner(localDir.x() >= 0.f ? halfExtents.x() : -halfExtents.x(),
+                          localDir.y() >= 0.f ? halfExtents.y() : -halfExtents.y(),
+                          localDir.z() >= 0.f ? halfExtents.z() : -halfExtents.z());
+
+  return computeCentroid() + localCorner * m_rotation;
 }
 
 AABB OBB::computeBoundingBox() const {
-  throw std::runtime_error("Error: Not implemented yet.");
+  const Vec3f centroid    = computeCentroid();
+  const Vec3f halfExtents = m_aabb.computeHalfExtents();
+
+  // The bounding box's extent along each axis is reached by the corner whose rotated half extents all point toward it
+  Vec3f extents;
+
+  for (std::size_t widthIndex = 0; widthIndex < 3; ++widthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < 3; ++heightIndex)
+      extents[widthIndex] += halfExtents[heightIndex] * std::abs(m_rotation.getElement(widthIndex, heightIndex));
+  }
+
+  return AABB(centroid - extents, centroid + extents);
 }
 
 } // namespace Raz
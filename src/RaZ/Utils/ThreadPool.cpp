@@ -2,32 +2,149 @@
 #include "RaZ/Utils/Threading.hpp"
 #include "RaZ/Utils/ThreadPool.hpp"
 
+#include <limits>
+#include <utility>
+
 namespace Raz {
 
+namespace {
+
+constexpr std::size_t invalidWorkerIndex = std::numeric_limits<std::size_t>::max();
+constexpr int spinCountBeforeSleeping = 64;
+
+// Pool & index of the worker running on the current thread, if any; actions added from a worker are pushed into its own deque
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentWorkerIndex = invalidWorkerIndex;
+thread_local const void* currentContext = nullptr;
+
+} // namespace
+
+ThreadPool::Action& ThreadPool::Action::operator=(Action&& action) noexcept {
+  if (&action == this)
+    return *this;
+
+  reset();
+
+  if (action.m_operations != nullptr) {
+    action.m_operations->move(m_storage, action.m_storage);
+    m_operations        = action.m_operations;
+    action.m_operations = nullptr;
+  }
+
+  m_context = std::exchange(action.m_context, nullptr);
+
+  return *this;
+}
+
+void ThreadPool::Action::reset() noexcept {
+  if (m_operations == nullptr)
+    return;
+
+  m_operations->destroy(m_storage);
+  m_operations = nullptr;
+  m_context    = nullptr;
+}
+
+bool ThreadPool::ActionDeque::push(Action* action) noexcept {
+  const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+  const int64_t top    = m_top.load(std::memory_order_acquire);
+
+  if (bottom - top >= static_cast<int64_t>(dequeCapacity))
+    return false;
+
+  m_actions[static_cast<std::size_t>(bottom) % dequeCapacity].store(action, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+  return true;
+}
+
+ThreadPool::Action* ThreadPool::ActionDeque::pop() noexcept {
+  const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+  m_bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = m_top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  Action* action = m_actions[static_cast<std::size_t>(bottom) % dequeCapacity].load(std::memory_order_relaxed);
+
+  if (top == bottom) {
+    // This was the last action, which a thief may be trying to steal at the same time
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      action = nullptr;
+
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  return action;
+}
+
+ThreadPool::Action* ThreadPool::ActionDeque::steal() noexcept {
+  int64_t top = m_top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom)
+    return nullptr;
+
+  Action* action = m_actions[static_cast<std::size_t>(top) % dequeCapacity].load(std::memory_order_relaxed);
+
+  // If another thread has taken the action first, the latter is left to it
+  if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    return nullptr;
+
+  return action;
+}
+
 ThreadPool::ThreadPool() : ThreadPool(Threading::getSystemThreadCount()) {}
 
 ThreadPool::ThreadPool(unsigned int threadCount) {
   Logger::debug("[ThreadPool] Initializing (with " + std::to_string(threadCount) + " thread(s))...");
 
+  // All workers must exist before any thread starts, since they may be stolen from right away
+  m_workers.reserve(threadCount);
+  for (unsigned int i = 0; i < threadCount; ++i)
+    m_workers.emplace_back(std::make_unique<Worker>());
+
   m_threads.reserve(threadCount);
 
-  for (unsigned int i = 0; i < threadCount; ++i) {
-    m_threads.emplace_back([this] () {
-      std::function<void()> action;
+  for (std::size_t workerIndex = 0; workerIndex < threadCount; ++workerIndex) {
+    m_threads.emplace_back([this, workerIndex] () {
+      currentPool        = this;
+      currentWorkerIndex = workerIndex;
 
-      while (true) {
-        {
-          std::unique_lock<std::mutex> lock(m_actionsMutex);
-          m_condVar.wait(lock, [this] () { return (!m_actions.empty() || m_shouldStop); });
+      Action action;
+      int spinCount = 0;
 
-          if (m_shouldStop)
-            return;
+      while (true) {
+        if (takeAction(action)) {
+          executeAction(action);
+          action = Action();
+          spinCount = 0;
+          continue;
+        }
 
-          action = std::move(m_actions.front());
-          m_actions.pop();
+        // Actions are frequently added in bursts; spinning a bit before sleeping avoids having to be woken up right after
+        if (++spinCount < spinCountBeforeSleeping) {
+          std::this_thread::yield();
+          continue;
         }
 
-        action();
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+
+        ++m_sleepingWorkerCount;
+        m_sleepCondVar.wait(lock, [this] () { return (m_pendingActionCount > 0 || m_shouldStop); });
+        --m_sleepingWorkerCount;
+
+        if (m_shouldStop)
+          return;
+
+        spinCount = 0;
       }
     });
   }
@@ -35,29 +152,168 @@ ThreadPool::ThreadPool(unsigned int threadCount) {
   Logger::debug("[ThreadPool] Initialized");
 }
 
-void ThreadPool::addAction(std::function<void()> action) {
-  {
-    std::lock_guard<std::mutex> lock(m_actionsMutex);
-    m_actions.push(std::move(action));
+const void* ThreadPool::getCurrentContext() noexcept {
+  return currentContext;
+}
+
+void ThreadPool::setCurrentContext(const void* context) noexcept {
+  currentContext = context;
+}
+
+void ThreadPool::addAction(Action action) {
+  action.m_context = currentContext;
+
+  if (currentPool == this) {
+    Worker& worker = *m_workers[currentWorkerIndex];
+
+    // The action is stored in a free slot, avoiding to allocate it; only if all are used by pending actions is it allocated instead
+    // Slots being used in order, checking them from the one following the last used finds a free one almost immediately
+    Action* storedAction = nullptr;
+
+    for (std::size_t slotIndex = 0; slotIndex < dequeCapacity && storedAction == nullptr; ++slotIndex) {
+      const std::size_t candidateIndex = (worker.nextSlotIndex + slotIndex) % dequeCapacity;
+
+      if (!worker.busySlots[candidateIndex].load(std::memory_order_acquire)) {
+        worker.busySlots[candidateIndex].store(true, std::memory_order_relaxed);
+        worker.actionSlots[candidateIndex] = std::move(action);
+
+        storedAction         = &worker.actionSlots[candidateIndex];
+        worker.nextSlotIndex = candidateIndex + 1;
+      }
+    }
+
+    if (storedAction == nullptr)
+      storedAction = new Action(std::move(action));
+
+    if (!worker.deque.push(storedAction)) {
+      // The deque being full, the action is executed right away
+      Action fullAction = releaseAction(worker, storedAction);
+      executeAction(fullAction);
+      return;
+    }
+  } else {
+    // The actions added from external threads are distributed among the workers, to avoid contending on a single queue
+    Worker& worker = *m_workers[m_nextInboxIndex.fetch_add(1, std::memory_order_relaxed) % m_workers.size()];
+
+    std::lock_guard<std::mutex> lock(worker.inboxMutex);
+    worker.inbox.emplace_back(std::move(action));
   }
 
-  m_condVar.notify_one();
+  ++m_pendingActionCount;
+  notifyWorker();
+}
+
+bool ThreadPool::executePendingAction() {
+  Action action;
+
+  if (!takeAction(action))
+    return false;
+
+  executeAction(action);
+  return true;
 }
 
 ThreadPool::~ThreadPool() {
   Logger::debug("[ThreadPool] Destroying...");
 
   {
-    std::lock_guard<std::mutex> lock(m_actionsMutex);
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
     m_shouldStop = true;
   }
 
-  m_condVar.notify_all();
+  m_sleepCondVar.notify_all();
 
   for (std::thread& thread : m_threads)
     thread.join();
 
+  // The actions which have not been executed are released
+  for (const std::unique_ptr<Worker>& worker : m_workers) {
+    while (Action* action = worker->deque.pop())
+      releaseAction(*worker, action);
+  }
+
   Logger::debug("[ThreadPool] Destroyed");
 }
 
+bool ThreadPool::takeAction(Action& action) {
+  const std::size_t workerCount = m_workers.size();
+  const bool isWorker           = (currentPool == this);
+
+  if (isWorker) {
+    Worker& worker = *m_workers[currentWorkerIndex];
+
+    if (Action* ownAction = worker.deque.pop()) {
+      action = releaseAction(worker, ownAction);
+      --m_pendingActionCount;
+      return true;
+    }
+  }
+
+  // The other workers are checked starting from the next one, so that not all threads try to take from the same worker
+  const std::size_t firstWorkerIndex = (isWorker ? currentWorkerIndex : m_nextInboxIndex.load(std::memory_order_relaxed));
+
+  for (std::size_t i = 0; i < workerCount; ++i) {
+    Worker& worker = *m_workers[(firstWorkerIndex + i) % workerCount];
+
+    if (i != 0 || !isWorker) {
+      if (Action* stolenAction = worker.deque.steal()) {
+        action = releaseAction(worker, stolenAction);
+        --m_pendingActionCount;
+        return true;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(worker.inboxMutex);
+
+    if (!worker.inbox.empty()) {
+      action = std::move(worker.inbox.front());
+      worker.inbox.pop_front();
+      --m_pendingActionCount;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::executeAction(Action& action) {
+  // The calling thread's context must be restored even if the action throws, since the thread may be helping while waiting for its own task
+  struct ContextGuard {
+    explicit ContextGuard(const void* context) noexcept : previousContext{ std::exchange(currentContext, context) } {}
+    ContextGuard(const ContextGuard&) = delete;
+    ContextGuard(ContextGuard&&) noexcept = delete;
+
+    ContextGuard& operator=(const ContextGuard&) = delete;
+    ContextGuard& operator=(ContextGuard&&) noexcept = delete;
+
+    ~ContextGuard() { currentContext = previousContext; }
+
+    const void* previousContext;
+  } contextGuard(action.m_context);
+
+  action();
+}
+
+ThreadPool::Action ThreadPool::releaseAction(Worker& worker, Action* storedAction) noexcept {
+  Action action = std::move(*storedAction);
+
+  if (storedAction >= worker.actionSlots.data() && storedAction < worker.actionSlots.data() + dequeCapacity) {
+    const auto slotIndex = static_cast<std::size_t>(storedAction - worker.actionSlots.data());
+    worker.busySlots[slotIndex].store(false, std::memory_order_release);
+  } else {
+    delete storedAction;
+  }
+
+  return action;
+}
+
+void ThreadPool::notifyWorker() {
+  if (m_sleepingWorkerCount == 0)
+    return;
+
+  // The mutex must be locked before notifying, so that a worker about to sleep can't miss the notification
+  { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+  m_sleepCondVar.notify_one();
+}
+
 } // namespace Raz
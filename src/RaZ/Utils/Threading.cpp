@@ -9,25 +9,30 @@ ThreadPool& getDefaultThreadPool() {
   return threadPool;
 }
 
+ThreadPool& getIoThreadPool() {
+  static ThreadPool threadPool(std::max(getSystemThreadCount() / 2, 1u));
+  return threadPool;
+}
+
 void parallelize(const std::function<void()>& action, unsigned int threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
 #if !defined(RAZ_PLATFORM_EMSCRIPTEN)
   ThreadPool& threadPool = getDefaultThreadPool();
-
-  std::vector<std::promise<void>> promises;
-  promises.resize(threadCount);
+  std::atomic<unsigned int> remainingActionCount = threadCount;
+  Details::ExceptionStorage exceptionStorage;
 
   for (unsigned int i = 0; i < threadCount; ++i) {
-    threadPool.addAction([&action, &promises, i] () {
-      action();
-      promises[i].set_value();
+    threadPool.addAction([&action, &remainingActionCount, &exceptionStorage] () noexcept {
+      exceptionStorage.execute(action);
+      --remainingActionCount;
     });
   }
 
-  // Blocking here to wait for all threads to finish their action
-  for (std::promise<void>& promise : promises)
-    promise.get_future().wait();
+  // Waiting for all threads to finish their action, helping executing them meanwhile; the actions are always counted as finished, even if
+  //  throwing, the first exception being then rethrown
+  threadPool.executeUntil([&remainingActionCount] () { return (remainingActionCount == 0); });
+  exceptionStorage.rethrow();
 #else
   for (unsigned int i = 0; i < threadCount; ++i)
     action();
@@ -37,21 +42,20 @@ void parallelize(const std::function<void()>& action, unsigned int threadCount)
 void parallelize(std::initializer_list<std::function<void()>> actions) {
 #if !defined(RAZ_PLATFORM_EMSCRIPTEN)
   ThreadPool& threadPool = getDefaultThreadPool();
+  std::atomic<std::size_t> remainingActionCount = actions.size();
+  Details::ExceptionStorage exceptionStorage;
 
-  std::vector<std::promise<void>> promises;
-  promises.resize(actions.size());
-
-  for (unsigned int i = 0; i < actions.size(); ++i) {
-    threadPool.addAction([&actions, &promises, i] () {
-      const std::function<void()>& action = *(actions.begin() + i);
-      action();
-      promises[i].set_value();
+  for (const std::function<void()>& action : actions) {
+    threadPool.addAction([&action, &remainingActionCount, &exceptionStorage] () noexcept {
+      exceptionStorage.execute(action);
+      --remainingActionCount;
     });
   }
 
-  // Blocking here to wait for all threads to finish their action
-  for (std::promise<void>& promise : promises)
-    promise.get_future().wait();
+  // Waiting for all threads to finish their action, helping executing them meanwhile; the actions are always counted as finished, even if
+  //  throwing, the first exception being then rethrown
+  threadPool.executeUntil([&remainingActionCount] () { return (remainingActionCount == 0); });
+  exceptionStorage.rethrow();
 #else
   for (const std::function<void()>& action : actions)
     action();
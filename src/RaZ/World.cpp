@@ -1,123 +1,580 @@
 #include "RaZ/World.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <utility>
 
 namespace Raz {
 
+namespace {
+
+constexpr std::size_t noSystemIndex = std::numeric_limits<std::size_t>::max();
+
+#if defined(RAZ_THREADS_AVAILABLE)
+// The system being updated is stored as the thread pool's context, so that the actions it adds to the pool, such as parallelized loops,
+//  are attributed to it whichever thread executes them; a thread executing another system's actions while waiting then records into the
+//  latter's buffer
+const System* getCurrentSystem() noexcept { return static_cast<const System*>(ThreadPool::getCurrentContext()); }
+void setCurrentSystem(const System* system) noexcept { ThreadPool::setCurrentContext(system); }
+#else
+thread_local const System* currentSystem = nullptr; ///< System being updated by the calling thread, if any.
+
+const System* getCurrentSystem() noexcept { return currentSystem; }
+void setCurrentSystem(const System* system) noexcept { currentSystem = system; }
+#endif
+
+} // namespace
+
+World::World(World&& world) noexcept
+  : m_systems{ std::move(world.m_systems) },
+    m_activeSystems{ std::move(world.m_activeSystems) },
+    m_entityPool{ std::move(world.m_entityPool) },
+    m_componentStorage{ std::move(world.m_componentStorage) },
+    m_entities{ std::move(world.m_entities) },
+    m_activeEntityCount{ std::exchange(world.m_activeEntityCount, 0) },
+    m_entitySlots{ std::move(world.m_entitySlots) },
+    m_freeEntityIndices{ std::move(world.m_freeEntityIndices) },
+    m_views{ std::move(world.m_views) },
+    m_dirtyEntities{ std::move(world.m_dirtyEntities) },
+    m_refreshedEntities{ std::move(world.m_refreshedEntities) },
+    m_commandBuffers{ std::move(world.m_commandBuffers) },
+    m_remainingTime{ world.m_remainingTime },
+    m_isParallelUpdateEnabled{ world.m_isParallelUpdateEnabled },
+    m_isFramePipeliningEnabled{ world.m_isFramePipeliningEnabled },
+    m_pendingSimulation{ std::move(world.m_pendingSimulation) } {
+  // The entities themselves are not moved, but they must now refer to their new owner
+  m_entityPool.forEach([this] (Entity& entity) { entity.m_world = this; });
+}
+
+bool World::requiresMainThread() const noexcept {
+  return std::any_of(m_systems.cbegin(), m_systems.cend(), [] (const SystemPtr& system) { return (system && system->requiresMainThread()); });
+}
+
 Entity& World::addEntity(bool enabled) {
-  m_entities.emplace_back(Entity::create(m_maxEntityIndex++, enabled));
-  m_activeEntityCount += enabled;
+  const bool isSlotReused       = !m_freeEntityIndices.empty();
+  const std::size_t entityIndex = (isSlotReused ? m_freeEntityIndices.back() : m_entitySlots.size());
 
-  return *m_entities.back();
+  if (!isSlotReused)
+    m_entitySlots.emplace_back();
+
+  Entity& entity = m_entityPool.emplace(entityIndex, *m_componentStorage, enabled);
+
+  if (isSlotReused)
+    m_freeEntityIndices.pop_back();
+
+  EntitySlot& slot = m_entitySlots[entityIndex];
+  slot.entity      = &entity;
+  slot.position    = m_entities.size();
+
+  entity.m_generation = slot.generation;
+  entity.m_world      = this;
+
+  m_entities.emplace_back(&entity);
+
+  // An enabled entity takes the place of the first disabled one, if any, so that the enabled entities remain packed together
+  if (enabled) {
+    swapEntities(slot.position, m_activeEntityCount);
+    ++m_activeEntityCount;
+  }
+
+  entity.markDirty();
+
+  return entity;
 }
 
-void World::removeEntity(const Entity& entity) {
-  auto iter = std::find_if(m_entities.begin(), m_entities.end(), [&entity] (const EntityPtr& entityPtr) { return (&entity == entityPtr.get()); });
+const Entity* World::recoverEntity(EntityHandle handle) const noexcept {
+  if (handle.index >= m_entitySlots.size())
+    return nullptr;
 
-  if (iter == m_entities.end())
+  const EntitySlot& slot = m_entitySlots[handle.index];
+  return (slot.generation == handle.generation ? slot.entity : nullptr);
+}
+
+void World::removeEntity(const Entity& entity) {
+  if (entity.getId() >= m_entitySlots.size() || m_entitySlots[entity.getId()].entity != &entity)
     throw std::invalid_argument("Error: The entity isn't owned by this world");
 
-  for (SystemPtr& system : m_systems)
-    system->unlinkEntity(*iter);
+  removeEntity(entity.getHandle());
+}
+
+void World::removeEntity(EntityHandle handle) {
+  Entity* entity = recoverEntity(handle);
+
+  if (entity == nullptr)
+    throw std::invalid_argument("Error: The entity to be removed doesn't exist");
+
+  // While the command buffers are being executed, the systems are notified only once all of them have been, along with the refreshed entities
+  Bitset removalRelinkedSystems(m_relinkedSystems != nullptr ? 0 : m_systems.size());
+  Bitset& relinkedSystems = (m_relinkedSystems != nullptr ? *m_relinkedSystems : removalRelinkedSystems);
+
+  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
+    System* system = m_systems[systemIndex].get();
+
+    if (system && system->containsEntity(*entity)) {
+      system->unlinkEntity(*entity);
+      relinkedSystems.setBit(systemIndex);
+    }
+  }
+
+  if (m_relinkedSystems == nullptr)
+    notifyRelinkedSystems(removalRelinkedSystems);
+
+  forEachView([entity] (ViewBase& view) { view.removeEntity(*entity); });
+
+  EntitySlot& slot         = m_entitySlots[handle.index];
+  std::size_t lastPosition = slot.position;
+
+  // An entity in the enabled part of the list is first swapped with the last enabled one, so that the enabled entities remain packed together
+  if (slot.position < m_activeEntityCount) {
+    --m_activeEntityCount;
+    swapEntities(slot.position, m_activeEntityCount);
+    lastPosition = m_activeEntityCount;
+  }
+
+  // It is then swapped with the very last entity, so that it can be removed without having to shift the following ones
+  swapEntities(lastPosition, m_entities.size() - 1);
+  m_entities.pop_back();
+
+  // Any handle still referring to the removed entity is now stale
+  slot.entity = nullptr;
+  ++slot.generation;
+  m_freeEntityIndices.emplace_back(handle.index);
 
-  m_entities.erase(iter);
+  m_entityPool.erase(*entity);
 }
 
-bool World::update(float deltaTime) {
+void World::waitForSimulation() {
+  if (!m_pendingSimulation.valid())
+    return;
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  Threading::getDefaultThreadPool().executeUntil([this] () {
+    return (m_pendingSimulation.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+  });
+#endif
+
+  // If any system has thrown an exception, it is rethrown here
+  for (const std::size_t systemIndex : m_pendingSimulation.get())
+    m_activeSystems.setBit(systemIndex, false);
+}
+
+bool World::update(const FrameTimeInfo& timeInfo) {
+  // If the previous frame has been pipelined, its simulation must be finished before the world can be refreshed
+  waitForSimulation();
   refresh();
 
-  // The fixed time step may need to be user-definable later; moreover, it should probably be handled by the Application
-  constexpr float fixedTimeStep = 0.016666f;
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  if (m_isFramePipeliningEnabled) {
+    updateSystemsPipelined(timeInfo);
+    return !m_activeSystems.isEmpty();
+  }
+
+  if (m_isParallelUpdateEnabled) {
+    updateSystemsInParallel(timeInfo);
+    return !m_activeSystems.isEmpty();
+  }
+#endif
 
   for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
     if (!m_activeSystems[systemIndex])
       continue;
 
-    System& system = *m_systems[systemIndex];
+    if (!updateSystem(*m_systems[systemIndex], timeInfo))
+      m_activeSystems.setBit(systemIndex, false);
+  }
+
+  return !m_activeSystems.isEmpty();
+}
+
+bool World::update(float deltaTime) {
+  FrameTimeInfo timeInfo;
+  timeInfo.deltaTime = deltaTime;
+
+  // The number of fixed steps is computed once for the whole frame, so that all systems using the default step time execute the same amount of them
+  m_remainingTime            += deltaTime;
+  timeInfo.substepCount       = consumeFixedSteps(m_remainingTime, timeInfo.substepTime);
+  timeInfo.interpolationAlpha = m_remainingTime / timeInfo.substepTime;
 
-    bool isSystemActive = system.update(deltaTime);
-    m_remainingTime    += deltaTime;
+  return update(timeInfo);
+}
 
-    while (m_remainingTime >= fixedTimeStep) {
-      isSystemActive   = system.step(fixedTimeStep) && isSystemActive;
-      m_remainingTime -= fixedTimeStep;
+CommandBuffer& World::getCommandBuffer() {
+  // The buffers are bound to the system being updated, so that they can be executed in the systems' order; since a system may record from
+  //  several threads at once (for example from parallelized loops), each thread is also given its own buffer
+  std::size_t systemIndex = noSystemIndex;
+
+  if (const System* currentSystem = getCurrentSystem()) {
+    for (std::size_t i = 0; i < m_systems.size(); ++i) {
+      if (m_systems[i].get() == currentSystem) {
+        systemIndex = i;
+        break;
+      }
     }
+  }
 
-    if (!isSystemActive)
-      m_activeSystems.setBit(systemIndex, false);
+  const std::thread::id threadId = std::this_thread::get_id();
+  std::lock_guard<std::mutex> lock(m_commandBuffersMutex);
+
+  for (const CommandBufferEntry& entry : m_commandBuffers) {
+    if (entry.systemIndex == systemIndex && entry.threadId == threadId)
+      return *entry.commandBuffer;
   }
 
-  return !m_activeSystems.isEmpty();
+  return *m_commandBuffers.emplace_back(CommandBufferEntry{ systemIndex, threadId, std::make_unique<CommandBuffer>() }).commandBuffer;
 }
 
 void World::refresh() {
-  if (m_entities.empty())
-    return;
+  // The systems are notified only once all commands have been executed & all entities have been refreshed, so that they can process their
+  //  new entities in bulk
+  Bitset relinkedSystems(m_systems.size());
 
-  sortEntities();
+  executeCommandBuffers(relinkedSystems);
 
-  for (std::size_t entityIndex = 0; entityIndex < m_activeEntityCount; ++entityIndex) {
-    const EntityPtr& entity = m_entities[entityIndex];
+  // Entities may be marked as dirty again while being refreshed (for example if a system adds a component to a linked entity)
+  // The list being processed is thus swapped with another, so that those are checked on the next refresh
+  std::swap(m_dirtyEntities, m_refreshedEntities);
 
-    for (const SystemPtr& system : m_systems) {
-      if (system == nullptr)
-        continue;
+  for (const EntityHandle handle : m_refreshedEntities) {
+    Entity* entity = recoverEntity(handle);
 
-      const Bitset matchingComponents = system->getAcceptedComponents() & entity->getEnabledComponents();
+    // The entity may have been removed since being marked as dirty
+    if (entity == nullptr)
+      continue;
 
-      // If the system doesn't contain the entity, check if it should (possesses the accepted components); if yes, link it
-      // Else, if the system contains the entity but shouldn't, unlink it
-      if (!system->containsEntity(*entity)) {
-        if (!matchingComponents.isEmpty())
-          system->linkEntity(entity);
-      } else {
-        if (matchingComponents.isEmpty())
-          system->unlinkEntity(entity);
-      }
-    }
+    entity->m_isDirty = false;
+    repositionEntity(*entity);
+
+    // Disabled entities are left untouched; they will be marked as dirty again once enabled
+    if (entity->isEnabled())
+      refreshEntity(*entity, relinkedSystems);
   }
+
+  m_refreshedEntities.clear();
+
+  notifyRelinkedSystems(relinkedSystems);
 }
 
 void World::destroy() {
+  // The systems may still be simulated if the last frame has been pipelined; its outcome, including any exception, is irrelevant from now on
+  try {
+    waitForSimulation();
+  } catch (...) {}
+
   // Entities must be released before the systems, since their destruction may depend on those
   m_entities.clear();
+  m_entitySlots.clear();
+  m_freeEntityIndices.clear();
+  m_dirtyEntities.clear();
+  m_entityPool.clear();
   m_activeEntityCount = 0;
-  m_maxEntityIndex    = 0;
+
+  // The views refer to the entities & their components, and must be emptied as well
+  forEachView([] (ViewBase& view) { view.clear(); });
+  m_views.clear();
 
   // This means that no entity must be used in any system destructor, since they will all be invalid
   // Their list is thus cleared to avoid any invalid usage
   for (const SystemPtr& system : m_systems) {
-    if (system)
+    if (system) {
       system->m_entities.clear();
+      system->m_entityIndices.clear();
+    }
   }
 
   m_systems.clear();
   m_activeSystems.clear();
+
+  m_commandBuffers.clear();
+}
+
+World& World::operator=(World&& world) noexcept {
+  // The currently held entities & systems must be released before taking those of the other world
+  destroy();
+
+  m_systems           = std::move(world.m_systems);
+  m_activeSystems     = std::move(world.m_activeSystems);
+  m_entityPool        = std::move(world.m_entityPool);
+  m_componentStorage  = std::move(world.m_componentStorage);
+  m_entities          = std::move(world.m_entities);
+  m_activeEntityCount = std::exchange(world.m_activeEntityCount, 0);
+  m_entitySlots       = std::move(world.m_entitySlots);
+  m_freeEntityIndices = std::move(world.m_freeEntityIndices);
+  m_views             = std::move(world.m_views);
+  m_dirtyEntities     = std::move(world.m_dirtyEntities);
+  m_refreshedEntities = std::move(world.m_refreshedEntities);
+  m_commandBuffers    = std::move(world.m_commandBuffers);
+  m_remainingTime     = world.m_remainingTime;
+
+  m_isParallelUpdateEnabled  = world.m_isParallelUpdateEnabled;
+  m_isFramePipeliningEnabled = world.m_isFramePipeliningEnabled;
+  m_pendingSimulation        = std::move(world.m_pendingSimulation);
+
+  m_entityPool.forEach([this] (Entity& entity) { entity.m_world = this; });
+
+  return *this;
+}
+
+void World::swapEntities(std::size_t firstPosition, std::size_t secondPosition) noexcept {
+  if (firstPosition == secondPosition)
+    return;
+
+  std::swap(m_entities[firstPosition], m_entities[secondPosition]);
+  m_entitySlots[m_entities[firstPosition]->getId()].position  = firstPosition;
+  m_entitySlots[m_entities[secondPosition]->getId()].position = secondPosition;
+}
+
+void World::repositionEntity(const Entity& entity) noexcept {
+  const std::size_t position = m_entitySlots[entity.getId()].position;
+  const bool isInEnabledPart = (position < m_activeEntityCount);
+
+  // A newly enabled entity is swapped with the first disabled one, and a newly disabled entity with the last enabled one
+  if (entity.isEnabled() && !isInEnabledPart) {
+    swapEntities(position, m_activeEntityCount);
+    ++m_activeEntityCount;
+  } else if (!entity.isEnabled() && isInEnabledPart) {
+    --m_activeEntityCount;
+    swapEntities(position, m_activeEntityCount);
+  }
+}
+
+void World::refreshEntity(Entity& entity, Bitset& relinkedSystems) {
+  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
+    System* system = m_systems[systemIndex].get();
+
+    if (system == nullptr)
+      continue;
+
+    const bool hasMatchingComponents = system->getAcceptedComponents().andAny(entity.getEnabledComponents());
+
+    // If the system doesn't contain the entity, check if it should (possesses the accepted components); if yes, link it
+    // Else, if the system contains the entity but shouldn't, unlink it
+    if (!system->containsEntity(entity)) {
+      if (hasMatchingComponents) {
+        system->linkEntity(entity);
+        relinkedSystems.setBit(systemIndex);
+      }
+    } else {
+      if (!hasMatchingComponents) {
+        system->unlinkEntity(entity);
+        relinkedSystems.setBit(systemIndex);
+      }
+    }
+  }
+}
+
+void World::executeCommandBuffers(Bitset& relinkedSystems) {
+  m_relinkedSystems = &relinkedSystems;
+
+  // The buffers are not locked while being executed, since a command may itself request the command buffer; they must thus not be recorded into
+  //  concurrently, which is guaranteed as long as the world is not refreshed while its systems are being updated
+  // The buffers of the systems are executed first following the systems' order, then those requested outside of any system update in the order
+  //  they were first requested; new buffers may be requested while executing the commands, hence iterating by index
+  std::stable_sort(m_commandBuffers.begin(), m_commandBuffers.end(), [] (const CommandBufferEntry& firstEntry, const CommandBufferEntry& secondEntry) {
+    return (firstEntry.systemIndex < secondEntry.systemIndex);
+  });
+
+  try {
+    for (std::size_t bufferIndex = 0; bufferIndex < m_commandBuffers.size(); ++bufferIndex)
+      m_commandBuffers[bufferIndex].commandBuffer->execute(*this);
+  } catch (...) {
+    m_relinkedSystems = nullptr;
+    throw;
+  }
+
+  m_relinkedSystems = nullptr;
+}
+
+void World::notifyRelinkedSystems(const Bitset& relinkedSystems) {
+  for (std::size_t systemIndex = relinkedSystems.findFirstEnabledBit(); systemIndex < relinkedSystems.getSize();
+       systemIndex = relinkedSystems.findFirstEnabledBit(systemIndex + 1)) {
+    // The system may have been removed in the meantime
+    if (systemIndex < m_systems.size() && m_systems[systemIndex])
+      m_systems[systemIndex]->onLinkedEntitiesChanged();
+  }
+}
+
+bool World::updateSystem(System& system, const FrameTimeInfo& timeInfo) {
+  // The system is set as the current one while being updated, so that it records into its own command buffer; the previous one is restored
+  //  afterward, since the thread may be updating another system while helping to execute the thread pool's actions
+  struct CurrentSystemGuard {
+    explicit CurrentSystemGuard(const System& system) noexcept : previousSystem{ getCurrentSystem() } { setCurrentSystem(&system); }
+    CurrentSystemGuard(const CurrentSystemGuard&) = delete;
+    CurrentSystemGuard(CurrentSystemGuard&&) noexcept = delete;
+
+    CurrentSystemGuard& operator=(const CurrentSystemGuard&) = delete;
+    CurrentSystemGuard& operator=(CurrentSystemGuard&&) noexcept = delete;
+
+    ~CurrentSystemGuard() { setCurrentSystem(previousSystem); }
+
+    const System* previousSystem;
+  } currentSystemGuard(system);
+
+  float stepTime        = timeInfo.substepTime;
+  std::size_t stepCount = timeInfo.substepCount;
+
+  if (system.m_stepTime > 0.f) {
+    // The system having its own step rate, it keeps track of its own remaining time
+    stepTime                    = system.m_stepTime;
+    system.m_remainingStepTime += timeInfo.deltaTime;
+    stepCount                   = consumeFixedSteps(system.m_remainingStepTime, stepTime, timeInfo.maxSubstepCount);
+    system.m_interpolationAlpha = system.m_remainingStepTime / stepTime;
+  } else {
+    system.m_interpolationAlpha = timeInfo.interpolationAlpha;
+  }
+
+  bool isSystemActive = system.update(timeInfo.deltaTime);
+
+  for (std::size_t stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+    isSystemActive = system.step(stepTime) && isSystemActive;
+
+  return isSystemActive;
 }
 
-void World::sortEntities() {
-  // Reorganizing the entites, swapping enabled & disabled ones so that the enabled ones are in front
-  auto firstEntity = m_entities.begin();
-  auto lastEntity  = m_entities.end() - 1;
+void World::updateSystemsInParallel(const FrameTimeInfo& timeInfo) {
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  // Each system is assigned a level one higher than the highest of the previous systems it conflicts with, forming a dependency graph
+  //  ordered by levels: all the systems of a same level can be updated concurrently, once those of the previous levels are done
+  std::vector<System*> systems;
+  std::vector<std::size_t> systemIndices;
+  std::vector<std::size_t> systemLevels;
+  std::size_t levelCount = 0;
 
-  while (firstEntity != lastEntity) {
-    // Iterating from the beginning to the end, trying to find a disabled entity
-    if ((*firstEntity)->isEnabled()) {
-      ++firstEntity;
+  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
+    if (!m_activeSystems[systemIndex])
       continue;
+
+    System& system    = *m_systems[systemIndex];
+    std::size_t level = 0;
+
+    for (std::size_t prevSystemIndex = 0; prevSystemIndex < systems.size(); ++prevSystemIndex) {
+      if (systemLevels[prevSystemIndex] >= level && system.conflictsWith(*systems[prevSystemIndex]))
+        level = systemLevels[prevSystemIndex] + 1;
+    }
+
+    systems.emplace_back(&system);
+    systemIndices.emplace_back(systemIndex);
+    systemLevels.emplace_back(level);
+    levelCount = std::max(levelCount, level + 1);
+  }
+
+  ThreadPool& threadPool = Threading::getDefaultThreadPool();
+
+  std::vector<std::promise<bool>> promises(systems.size());
+  std::vector<std::future<bool>> futures;
+  futures.reserve(systems.size());
+
+  for (std::promise<bool>& promise : promises)
+    futures.emplace_back(promise.get_future());
+
+  std::vector<std::size_t> levelSystems;
+
+  for (std::size_t level = 0; level < levelCount; ++level) {
+    levelSystems.clear();
+
+    for (std::size_t i = 0; i < systems.size(); ++i) {
+      if (systemLevels[i] == level)
+        levelSystems.emplace_back(i);
     }
 
-    // Iterating from the end to the beginning, trying to find an enabled entity
-    while (firstEntity != lastEntity && (*lastEntity == nullptr || !(*lastEntity)->isEnabled()))
-      --lastEntity;
+    // The systems requiring the main thread are kept for the calling one; if there is none, the latter still updates a system instead of just waiting
+    const bool hasMainThreadSystem = std::any_of(levelSystems.cbegin(), levelSystems.cend(), [&systems] (std::size_t i) {
+      return systems[i]->requiresMainThread();
+    });
+    const auto isUpdatedByCaller = [&] (std::size_t levelSystemIndex) {
+      return (systems[levelSystems[levelSystemIndex]]->requiresMainThread() || (!hasMainThreadSystem && levelSystemIndex == levelSystems.size() - 1));
+    };
+    const auto updateLevelSystem = [&systems, &promises, &timeInfo] (std::size_t i) {
+      try {
+        promises[i].set_value(updateSystem(*systems[i], timeInfo));
+      } catch (...) {
+        promises[i].set_exception(std::current_exception());
+      }
+    };
+
+    for (std::size_t levelSystemIndex = 0; levelSystemIndex < levelSystems.size(); ++levelSystemIndex) {
+      if (!isUpdatedByCaller(levelSystemIndex))
+        threadPool.addAction([&updateLevelSystem, i = levelSystems[levelSystemIndex]] () { updateLevelSystem(i); });
+    }
+
+    for (std::size_t levelSystemIndex = 0; levelSystemIndex < levelSystems.size(); ++levelSystemIndex) {
+      if (isUpdatedByCaller(levelSystemIndex))
+        updateLevelSystem(levelSystems[levelSystemIndex]);
+    }
 
-    // If both iterators are equal to each other, the list is sorted
-    if (firstEntity == lastEntity)
-      break;
+    // Waiting for all systems of the level to be updated before starting the next one, helping executing the pool's actions meanwhile
+    threadPool.executeUntil([&futures, &levelSystems] () {
+      return std::all_of(levelSystems.cbegin(), levelSystems.cend(), [&futures] (std::size_t i) {
+        return (futures[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+      });
+    });
 
-    std::swap(*firstEntity, *lastEntity);
-    --lastEntity;
+    // If any system has thrown an exception, it is rethrown here
+    for (const std::size_t i : levelSystems) {
+      if (!futures[i].get())
+        m_activeSystems.setBit(systemIndices[i], false);
+    }
+  }
+#else
+  static_cast<void>(timeInfo);
+#endif
+}
+
+void World::updateSystemsPipelined(const FrameTimeInfo& timeInfo) {
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  std::vector<System*> simulatedSystems;
+  std::vector<std::size_t> simulatedSystemIndices;
+  std::vector<std::size_t> mainThreadSystemIndices;
+
+  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
+    if (!m_activeSystems[systemIndex])
+      continue;
+
+    if (m_systems[systemIndex]->requiresMainThread()) {
+      mainThreadSystemIndices.emplace_back(systemIndex);
+    } else {
+      simulatedSystems.emplace_back(m_systems[systemIndex].get());
+      simulatedSystemIndices.emplace_back(systemIndex);
+    }
   }
 
-  m_activeEntityCount = static_cast<std::size_t>(std::distance(m_entities.begin(), lastEntity) + 1);
+  // The systems requiring the main thread capture what they need before the simulation starts modifying the entities
+  for (const std::size_t systemIndex : mainThreadSystemIndices)
+    m_systems[systemIndex]->captureFrame();
+
+  if (!simulatedSystems.empty()) {
+    auto promise        = std::make_shared<std::promise<std::vector<std::size_t>>>();
+    m_pendingSimulation = promise->get_future();
+
+    // The systems are referred to directly rather than through the world, which may be moved while they are being updated
+    // They are updated one after the other, following the systems' order
+    Threading::getDefaultThreadPool().addAction([systems = std::move(simulatedSystems), systemIndices = std::move(simulatedSystemIndices),
+                                                 timeInfo, promise = std::move(promise)] () {
+      try {
+        std::vector<std::size_t> inactiveSystemIndices;
+
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+          if (!updateSystem(*systems[i], timeInfo))
+            inactiveSystemIndices.emplace_back(systemIndices[i]);
+        }
+
+        promise->set_value(std::move(inactiveSystemIndices));
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    });
+  }
+
+  // Meanwhile, the systems requiring the main thread are updated from their captured state, usually rendering the previous frame
+  for (const std::size_t systemIndex : mainThreadSystemIndices) {
+    if (!updateSystem(*m_systems[systemIndex], timeInfo))
+      m_activeSystems.setBit(systemIndex, false);
+  }
+#else
+  static_cast<void>(timeInfo);
+#endif
 }
 
 } // namespace Raz
@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef RAZ_PHYSICSTESTUTILS_HPP
+#define RAZ_PHYSICSTESTUTILS_HPP
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace TestUtils {
+
+/// Hashes the positions of all the rigid bodies of a world, using their exact binary representation (FNV-1a).
+/// \note This is shared by the tests & the benchmarks, so that both check the physics' determinism in the same way.
+/// \param world World whose rigid bodies' positions are to be hashed.
+/// \return Hash of the positions.
+inline std::uint64_t hashRigidBodyPositions(const Raz::World& world) {
+  std::uint64_t hash = 14695981039346656037ull;
+
+  for (const Raz::Entity* entity : world.getEntities()) {
+    if (!entity->hasComponent<Raz::RigidBody>())
+      continue;
+
+    const Raz::Vec3f& position = entity->getComponent<Raz::Transform>().getPosition();
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      std::uint32_t bits {};
+      std::memcpy(&bits, &position[axisIndex], sizeof(bits));
+
+      for (std::size_t byteIndex = 0; byteIndex < sizeof(bits); ++byteIndex) {
+        hash ^= (bits >> (byteIndex * 8)) & 0xFF;
+        hash *= 1099511628211ull;
+      }
+    }
+  }
+
+  return hash;
+}
+
+} // namespace TestUtils
+
+#endif // RAZ_PHYSICSTESTUTILS_HPP
@@ -0,0 +1,169 @@
+#include "Catch.hpp"
+
+#include "RaZ/Application.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+class ThreadRecordingSystem final : public Raz::System {
+public:
+  explicit ThreadRecordingSystem(bool requiresMainThread = false) {
+    if (requiresMainThread)
+      requireMainThread();
+  }
+
+  bool update(float /* deltaTime */) override {
+    Raz::Threading::sleep(10);
+
+    threadId = std::this_thread::get_id();
+    return (++updateCount < 2);
+  }
+
+  std::thread::id threadId {};
+  int updateCount = 0;
+};
+
+class ThrowingSystem final : public Raz::System {
+public:
+  explicit ThrowingSystem(bool requiresMainThread = false) {
+    if (requiresMainThread)
+      requireMainThread();
+  }
+
+  bool update(float /* deltaTime */) override {
+    if (++updateCount == 1)
+      throw std::runtime_error("Error: First update");
+
+    return false;
+  }
+
+  int updateCount = 0;
+};
+
+class SingleUpdateSystem final : public Raz::System {
+public:
+  explicit SingleUpdateSystem(bool requiresMainThread = false) {
+    if (requiresMainThread)
+      requireMainThread();
+  }
+
+  bool update(float /* deltaTime */) override {
+    ++updateCount;
+    return false;
+  }
+
+  int updateCount = 0;
+};
+
+} // namespace
+
+TEST_CASE("Application basic") {
+  Raz::Application app(2);
+  CHECK(app.getWorlds().empty());
+
+  CHECK_THROWS(app.setFixedTimeStep(0.f));
+  CHECK_THROWS(app.setMaxSubstepCount(0));
+
+  app.setFixedTimeStep(0.01f);
+  app.setMaxSubstepCount(4);
+  CHECK(app.getFixedTimeStep() == 0.01f);
+  CHECK(app.getMaxSubstepCount() == 4);
+
+  app.addWorld().addSystem<ThreadRecordingSystem>();
+  app.addWorld().addSystem<ThreadRecordingSystem>();
+
+  // Each world becomes inactive after two updates, stopping the application
+  CHECK(app.runOnce());
+  CHECK(app.getWorldUpdateTimes().size() == 2);
+  CHECK(app.getWorldUpdateTimes()[0] > 0.f);
+  CHECK(app.getWorldUpdateTimes()[1] > 0.f);
+  CHECK(app.getTimeInfo().substepCount <= 4);
+  CHECK(app.getInterpolationAlpha() < 1.f);
+
+  CHECK_FALSE(app.runOnce());
+
+  // Running once more keeps returning false, as no world is active anymore
+  CHECK_FALSE(app.runOnce());
+}
+
+TEST_CASE("Application parallel update") {
+  Raz::Application app(3);
+  app.enableParallelUpdate();
+  CHECK(app.isParallelUpdateEnabled());
+
+  const auto& mainThreadSystem = app.addWorld().addSystem<ThreadRecordingSystem>(true);
+  const auto& poolSystem1      = app.addWorld().addSystem<ThreadRecordingSystem>();
+  const auto& poolSystem2      = app.addWorld().addSystem<ThreadRecordingSystem>();
+
+  CHECK(app.getWorlds()[0].requiresMainThread());
+  CHECK_FALSE(app.getWorlds()[1].requiresMainThread());
+
+  CHECK(app.runOnce());
+  CHECK(mainThreadSystem.updateCount == 1);
+  CHECK(poolSystem1.updateCount == 1);
+  CHECK(poolSystem2.updateCount == 1);
+
+  // A world requiring the main thread is always updated on the calling one
+  // The calling thread helps executing the pool's actions while waiting, thus may also have updated any of the other worlds
+  CHECK(mainThreadSystem.threadId == std::this_thread::get_id());
+
+  for (const float updateTime : app.getWorldUpdateTimes())
+    CHECK(updateTime > 0.f);
+
+  CHECK_FALSE(app.runOnce());
+}
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+TEST_CASE("Application parallel update exceptions") {
+  // Systems added after an exception has been thrown are only updated if their world has wrongly been left active
+
+  {
+    // The world updated on the calling thread throws, while the ones updated by the pool become inactive
+    Raz::Application app(3);
+    app.enableParallelUpdate();
+
+    app.addWorld().addSystem<ThrowingSystem>(true);
+    Raz::World& poolWorld1 = app.addWorld();
+    Raz::World& poolWorld2 = app.addWorld();
+    poolWorld1.addSystem<SingleUpdateSystem>();
+    poolWorld2.addSystem<SingleUpdateSystem>();
+
+    CHECK_THROWS(app.runOnce());
+
+    const auto& lateSystem1 = poolWorld1.addSystem<SingleUpdateSystem>();
+    const auto& lateSystem2 = poolWorld2.addSystem<SingleUpdateSystem>();
+
+    CHECK_FALSE(app.runOnce());
+    CHECK(lateSystem1.updateCount == 0);
+    CHECK(lateSystem2.updateCount == 0);
+  }
+
+  {
+    // A world updated by the pool throws, while the other ones become inactive
+    Raz::Application app(4);
+    app.enableParallelUpdate();
+
+    Raz::World& mainThreadWorld = app.addWorld();
+    mainThreadWorld.addSystem<SingleUpdateSystem>(true);
+    app.addWorld().addSystem<ThrowingSystem>();
+    Raz::World& poolWorld1 = app.addWorld();
+    Raz::World& poolWorld2 = app.addWorld();
+    poolWorld1.addSystem<SingleUpdateSystem>();
+    poolWorld2.addSystem<SingleUpdateSystem>();
+
+    CHECK_THROWS(app.runOnce());
+
+    const auto& lateMainThreadSystem = mainThreadWorld.addSystem<SingleUpdateSystem>(true);
+    const auto& lateSystem1          = poolWorld1.addSystem<SingleUpdateSystem>();
+    const auto& lateSystem2          = poolWorld2.addSystem<SingleUpdateSystem>();
+
+    CHECK_FALSE(app.runOnce());
+    CHECK(lateMainThreadSystem.updateCount == 0);
+    CHECK(lateSystem1.updateCount == 0);
+    CHECK(lateSystem2.updateCount == 0);
+  }
+}
+#endif
@@ -0,0 +1,288 @@
+#include "Catch.hpp"
+
+#include "RaZ/CommandBuffer.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace {
+
+struct PositionComp : public Raz::Component {
+  explicit PositionComp(float val = 0.f) : value{ val } {}
+
+  float value;
+};
+
+struct TagComp : public Raz::Component {};
+
+class RelinkCountingSystem final : public Raz::System {
+public:
+  RelinkCountingSystem() { registerComponents<PositionComp>(); }
+
+  const std::vector<Raz::Entity*>& getEntities() const { return m_entities; }
+
+  void linkEntity(Raz::Entity& entity) override { System::linkEntity(entity); ++linkCount; }
+  void onLinkedEntitiesChanged() override { ++relinkCount; }
+
+  std::size_t linkCount = 0;
+  std::size_t relinkCount = 0;
+};
+
+template <int Value>
+class RecordingSystem final : public Raz::System {
+public:
+  bool update(float) override {
+    Raz::CommandBuffer& commandBuffer = world->getCommandBuffer();
+    commandBuffer.addComponent<PositionComp>(commandBuffer.addEntity(), static_cast<float>(Value));
+    return true;
+  }
+
+  Raz::World* world {};
+};
+
+template <int Value>
+class ParallelRecordingSystem final : public Raz::System {
+public:
+  bool update(float) override {
+    // The commands recorded from the parallelized actions, whichever thread executes them, must be attributed to this system
+    Raz::Threading::parallelFor(0, 8, [this] (const Raz::Threading::IndexRange& range) {
+      Raz::Threading::sleep(1); // Giving the other threads the opportunity to execute some of the chunks
+
+      Raz::CommandBuffer& commandBuffer = world->getCommandBuffer();
+
+      for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+        commandBuffer.addComponent<PositionComp>(commandBuffer.addEntity(), static_cast<float>(Value));
+    }, 1);
+
+    return true;
+  }
+
+  Raz::World* world {};
+};
+
+} // namespace
+
+TEST_CASE("CommandBuffer recording") {
+  Raz::World world;
+  Raz::Entity& entity = world.addEntity();
+
+  Raz::CommandBuffer commandBuffer;
+  CHECK(commandBuffer.isEmpty());
+
+  const Raz::CommandBuffer::PendingEntity pendingEntity = commandBuffer.addEntity();
+  commandBuffer.addComponent<PositionComp>(pendingEntity, 3.f);
+  commandBuffer.addComponent<TagComp>(entity.getHandle());
+  commandBuffer.disableEntity(entity.getHandle());
+  CHECK(commandBuffer.getCommandCount() == 4);
+
+  // Nothing is applied until the buffer is executed
+  CHECK(world.getEntities().size() == 1);
+  CHECK_FALSE(entity.hasComponent<TagComp>());
+
+  commandBuffer.execute(world);
+  CHECK(commandBuffer.isEmpty());
+
+  REQUIRE(world.getEntities().size() == 2);
+  CHECK(entity.hasComponent<TagComp>());
+  CHECK_FALSE(entity.isEnabled());
+
+  const Raz::Entity& createdEntity = *world.getEntities().back();
+  REQUIRE(createdEntity.hasComponent<PositionComp>());
+  CHECK(createdEntity.getComponent<PositionComp>().value == 3.f);
+
+  // Commands targeting an entity which has been removed in the meantime are ignored
+  commandBuffer.removeEntity(createdEntity.getHandle());
+  commandBuffer.removeComponent<PositionComp>(createdEntity.getHandle());
+  commandBuffer.enableEntity(entity.getHandle());
+  commandBuffer.removeComponent<TagComp>(entity.getHandle());
+  CHECK_NOTHROW(commandBuffer.execute(world));
+
+  CHECK(world.getEntities().size() == 1);
+  CHECK(entity.isEnabled());
+  CHECK_FALSE(entity.hasComponent<TagComp>());
+
+  // A cleared buffer doesn't apply anything
+  commandBuffer.addEntity();
+  commandBuffer.clear();
+  commandBuffer.execute(world);
+  CHECK(world.getEntities().size() == 1);
+}
+
+TEST_CASE("CommandBuffer arguments") {
+  struct OwningComp : public Raz::Component {
+    explicit OwningComp(std::shared_ptr<int> val) : value{ std::move(val) } {}
+
+    std::shared_ptr<int> value;
+  };
+
+  Raz::World world;
+  Raz::Entity& entity = world.addEntity();
+
+  auto value = std::make_shared<int>(42);
+
+  Raz::CommandBuffer commandBuffer;
+  commandBuffer.addComponent<OwningComp>(entity.getHandle(), value);
+  CHECK(value.use_count() == 2); // The argument is held by the buffer until it is executed
+
+  commandBuffer.execute(world);
+  CHECK(value.use_count() == 2); // It has then been moved into the component
+  CHECK(*entity.getComponent<OwningComp>().value == 42);
+
+  struct ReferencingComp : public Raz::Component {
+    explicit ReferencingComp(int) {}
+    explicit ReferencingComp(std::reference_wrapper<int> val) : value{ &val.get() } {}
+
+    int* value {};
+  };
+
+  // A reference wrapper is given as is to the component, not as a reference which would select another constructor
+  int referencedValue = 42;
+  commandBuffer.addComponent<ReferencingComp>(entity.getHandle(), std::ref(referencedValue));
+  commandBuffer.execute(world);
+  CHECK(entity.getComponent<ReferencingComp>().value == &referencedValue);
+}
+
+TEST_CASE("CommandBuffer move-only arguments") {
+  struct UniqueComp : public Raz::Component {
+    explicit UniqueComp(std::unique_ptr<int> val) : value{ std::move(val) } {}
+
+    std::unique_ptr<int> value;
+  };
+
+  Raz::World world;
+  Raz::Entity& entity = world.addEntity();
+
+  Raz::CommandBuffer commandBuffer;
+  commandBuffer.addComponent<UniqueComp>(entity.getHandle(), std::make_unique<int>(42));
+
+  // Move-only components can be recorded as well
+  Raz::Mesh mesh;
+  mesh.addSubmesh().getVertices().resize(3);
+  commandBuffer.addComponent<Raz::Mesh>(entity.getHandle(), std::move(mesh));
+
+  // The command buffer itself can be moved along with its commands
+  Raz::CommandBuffer movedCommandBuffer = std::move(commandBuffer);
+  CHECK(movedCommandBuffer.getCommandCount() == 2);
+
+  movedCommandBuffer.execute(world);
+
+  REQUIRE(entity.hasComponent<UniqueComp>());
+  CHECK(*entity.getComponent<UniqueComp>().value == 42);
+  REQUIRE(entity.hasComponent<Raz::Mesh>());
+  CHECK(entity.getComponent<Raz::Mesh>().getSubmeshes().size() == 1);
+  CHECK(entity.getComponent<Raz::Mesh>().recoverVertexCount() == 3);
+}
+
+TEST_CASE("World command buffers") {
+  Raz::World world;
+  auto& system = world.addSystem<RelinkCountingSystem>();
+
+  Raz::CommandBuffer& commandBuffer = world.getCommandBuffer();
+  CHECK(&world.getCommandBuffer() == &commandBuffer); // The same thread always gets the same buffer
+
+  for (int i = 0; i < 10; ++i) {
+    const Raz::CommandBuffer::PendingEntity pendingEntity = commandBuffer.addEntity();
+    commandBuffer.addComponent<PositionComp>(pendingEntity, static_cast<float>(i));
+  }
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  // Each thread records into its own buffer
+  Raz::Threading::parallelize([&world] () {
+    Raz::CommandBuffer& threadCommandBuffer = world.getCommandBuffer();
+    threadCommandBuffer.addComponent<PositionComp>(threadCommandBuffer.addEntity());
+  }, 4);
+#endif
+
+  CHECK(world.getEntities().empty());
+
+  // All buffers are executed on refresh, the system being notified only once despite all entities being linked to it
+  world.refresh();
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  CHECK(world.getEntities().size() == 14);
+#else
+  CHECK(world.getEntities().size() == 10);
+#endif
+  CHECK(system.getEntities().size() == world.getEntities().size());
+  CHECK(system.linkCount == world.getEntities().size());
+  CHECK(system.relinkCount == 1);
+  CHECK(commandBuffer.isEmpty());
+
+  // Refreshing again without any change doesn't notify the system
+  world.refresh();
+  CHECK(system.relinkCount == 1);
+
+  // Removing an entity directly notifies the system immediately
+  world.removeEntity(*world.getEntities().front());
+  CHECK(system.relinkCount == 2);
+
+  // Removing several entities through commands notifies the system only once, along with the entities linked during the same refresh
+  const std::size_t entityCount = world.getEntities().size();
+
+  for (std::size_t entityIndex = 0; entityIndex < 5; ++entityIndex)
+    commandBuffer.removeEntity(world.getEntities()[entityIndex]->getHandle());
+  commandBuffer.addComponent<PositionComp>(commandBuffer.addEntity());
+
+  world.refresh();
+  CHECK(world.getEntities().size() == entityCount - 4);
+  CHECK(system.getEntities().size() == world.getEntities().size());
+  CHECK(system.relinkCount == 3);
+}
+
+TEST_CASE("World command buffers order") {
+  Raz::World world;
+  world.addSystem<RecordingSystem<1>>().world = &world;
+  world.addSystem<RecordingSystem<2>>().world = &world;
+
+  // The calling thread's buffer is requested before any system's
+  Raz::CommandBuffer& commandBuffer = world.getCommandBuffer();
+
+  const auto checkOrder = [&world, &commandBuffer] () {
+    // The systems record their commands while being updated
+    world.update(0.f);
+    commandBuffer.addComponent<PositionComp>(commandBuffer.addEntity(), 0.f);
+    world.refresh();
+
+    // The systems' buffers are executed in the systems' order, then the threads' ones
+    const std::vector<Raz::Entity*>& entities = world.getEntities();
+    REQUIRE(entities.size() == 3);
+    CHECK(entities[0]->getComponent<PositionComp>().value == 1.f);
+    CHECK(entities[1]->getComponent<PositionComp>().value == 2.f);
+    CHECK(entities[2]->getComponent<PositionComp>().value == 0.f);
+
+    while (!world.getEntities().empty())
+      world.removeEntity(*world.getEntities().back());
+  };
+
+  checkOrder();
+
+  // The same order is kept when the systems are updated concurrently
+  world.enableParallelUpdate();
+  checkOrder();
+}
+
+TEST_CASE("World command buffers parallelized recording") {
+  Raz::World world;
+  world.addSystem<ParallelRecordingSystem<1>>().world = &world;
+  world.addSystem<ParallelRecordingSystem<2>>().world = &world;
+  world.enableParallelUpdate();
+
+  // Both systems being updated concurrently, a thread waiting for its system's actions may execute the other system's ones; the commands
+  //  must still be executed in the systems' order
+  for (int updateIndex = 0; updateIndex < 10; ++updateIndex) {
+    world.update(0.f);
+    world.refresh();
+
+    const std::vector<Raz::Entity*>& entities = world.getEntities();
+    REQUIRE(entities.size() == 16);
+
+    for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+      CHECK(entities[entityIndex]->getComponent<PositionComp>().value == (entityIndex < 8 ? 1.f : 2.f));
+
+    while (!world.getEntities().empty())
+      world.removeEntity(*world.getEntities().back());
+  }
+}
@@ -0,0 +1,78 @@
+#include "Catch.hpp"
+
+#include "RaZ/Data/AssetCache.hpp"
+
+TEST_CASE("AssetCache basic") {
+  Raz::AssetCache<int> cache;
+  CHECK(cache.getAssetCount() == 0);
+  CHECK(cache.getMemoryUsage() == 0);
+  CHECK(cache.find("asset") == nullptr);
+
+  const std::shared_ptr<int> asset = cache.insert("asset", std::make_shared<int>(42), 10);
+  REQUIRE(asset != nullptr);
+  CHECK(*asset == 42);
+  CHECK(cache.contains("asset"));
+  CHECK(cache.getAssetCount() == 1);
+  CHECK(cache.getMemoryUsage() == 10);
+  CHECK(cache.find("asset") == asset);
+
+  // Inserting an asset with an existing key keeps the already cached one
+  CHECK(cache.insert("asset", std::make_shared<int>(0), 20) == asset);
+  CHECK(cache.getMemoryUsage() == 10);
+
+  int loadCount = 0;
+  const auto loadAsset = [&loadCount] () { ++loadCount; return std::make_shared<int>(3); };
+  const auto computeMemorySize = [] (const int&) { return std::size_t(5); };
+
+  const std::shared_ptr<int> loadedAsset = cache.load("loaded", loadAsset, computeMemorySize);
+  CHECK(*loadedAsset == 3);
+  CHECK(cache.load("loaded", loadAsset, computeMemorySize) == loadedAsset);
+  CHECK(loadCount == 1);
+  CHECK(cache.getMemoryUsage() == 15);
+
+  // A removed asset remains valid while referenced
+  CHECK(cache.remove("asset"));
+  CHECK_FALSE(cache.remove("asset"));
+  CHECK_FALSE(cache.contains("asset"));
+  CHECK(*asset == 42);
+  CHECK(cache.getMemoryUsage() == 5);
+
+  cache.clear();
+  CHECK(cache.getAssetCount() == 0);
+  CHECK(cache.getMemoryUsage() == 0);
+  CHECK(*loadedAsset == 3);
+}
+
+TEST_CASE("AssetCache eviction") {
+  Raz::AssetCache<const int> cache(30);
+  CHECK(cache.getMemoryBudget() == 30);
+
+  cache.insert("first", std::make_shared<const int>(1), 10);
+  cache.insert("second", std::make_shared<const int>(2), 10);
+  std::shared_ptr<const int> third = cache.insert("third", std::make_shared<const int>(3), 10);
+  CHECK(cache.getMemoryUsage() == 30);
+
+  // Using the first asset makes the second the least recently used one, which is evicted when exceeding the budget
+  CHECK(cache.find("first") != nullptr);
+  const std::shared_ptr<const int> fourth = cache.insert("fourth", std::make_shared<const int>(4), 10);
+  CHECK(cache.getMemoryUsage() == 30);
+  CHECK(cache.contains("first"));
+  CHECK_FALSE(cache.contains("second"));
+  CHECK(cache.contains("third"));
+  CHECK(cache.contains("fourth"));
+
+  // Referenced assets are never evicted, even if exceeding the budget
+  cache.setMemoryBudget(0);
+  CHECK(cache.getAssetCount() == 2);
+  CHECK(cache.getMemoryUsage() == 20);
+  CHECK_FALSE(cache.contains("first"));
+
+  third.reset();
+  CHECK(cache.evict(10) == 1);
+  CHECK_FALSE(cache.contains("third"));
+  CHECK(cache.contains("fourth"));
+  CHECK(cache.getMemoryUsage() == 10);
+
+  CHECK(cache.evict() == 0);
+  CHECK(*fourth == 4);
+}
@@ -0,0 +1,143 @@
+#include "Catch.hpp"
+
+#include "RaZ/Data/AssetManager.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Data/ObjFormat.hpp"
+#include "RaZ/Render/MeshRenderer.hpp"
+#include "RaZ/Render/UploadQueue.hpp"
+
+#include <stdexcept>
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+TEST_CASE("AssetManager image") {
+  Raz::UploadQueue uploadQueue;
+  Raz::AssetManager assetManager(uploadQueue);
+
+  CHECK(assetManager.getRequestedTaskCount() == 0);
+  CHECK(assetManager.getProgress() == 1.f);
+  CHECK_FALSE(assetManager.isLoading());
+
+  const std::shared_future<Raz::ImageConstPtr> image        = assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png");
+  const std::shared_future<Raz::ImageConstPtr> sameImage    = assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png");
+  const std::shared_future<Raz::ImageConstPtr> flippedImage = assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png", true);
+
+  // Requesting the same image again does not load it twice, but a flipped one is different
+  CHECK(assetManager.getRequestedTaskCount() == 2);
+
+  assetManager.finishLoading();
+  CHECK(assetManager.getFinishedTaskCount() == 2);
+  CHECK(assetManager.getProgress() == 1.f);
+  CHECK_FALSE(assetManager.isLoading());
+
+  REQUIRE(image.get() != nullptr);
+  CHECK(image.get() == sameImage.get());
+  CHECK(image.get()->getWidth() == 2);
+  CHECK(image.get()->getHeight() == 2);
+  CHECK(*static_cast<const uint8_t*>(image.get()->getDataPtr()) == 191);
+
+  REQUIRE(flippedImage.get() != nullptr);
+  CHECK(flippedImage.get() != image.get());
+  CHECK(*flippedImage.get() != *image.get());
+  CHECK(*static_cast<const uint8_t*>(flippedImage.get()->getDataPtr()) == 239);
+
+  // An image already loaded is returned directly
+  CHECK(assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png").get() == image.get());
+  CHECK(assetManager.getRequestedTaskCount() == 2);
+}
+
+TEST_CASE("AssetManager cache") {
+  Raz::UploadQueue uploadQueue;
+  Raz::AssetManager assetManager(uploadQueue);
+
+  std::shared_future<Raz::ImageConstPtr> image = assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png", true);
+  assetManager.finishLoading();
+
+  const Raz::AssetCache<const Raz::Image>& imageCache = assetManager.getImageCache();
+  CHECK(imageCache.getAssetCount() == 1);
+  CHECK(imageCache.contains("[flipped] " RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png"));
+  CHECK(imageCache.getMemoryUsage() == 2 * 2 * 4); // 2x2 RGBA image
+
+  // The image being still referenced, it cannot be evicted
+  assetManager.getImageCache().setMemoryBudget(0);
+  CHECK(imageCache.getAssetCount() == 1);
+
+  image = {};
+  CHECK(assetManager.getImageCache().evict() == 1);
+  CHECK(imageCache.getAssetCount() == 0);
+  CHECK(imageCache.getMemoryUsage() == 0);
+
+  // Once evicted, the image is loaded again when requested
+  image = assetManager.loadImage(RAZ_TESTS_ROOT "assets/images/dëfàùltTêst.png", true);
+  CHECK(assetManager.getRequestedTaskCount() == 2);
+  assetManager.finishLoading();
+  CHECK(image.get() != nullptr);
+
+  // The meshes' data is shared between all the requests
+  const std::shared_future<Raz::ObjDataConstPtr> meshData     = assetManager.loadMeshData(RAZ_TESTS_ROOT "assets/meshes/çûbè_BP.obj");
+  const std::shared_future<Raz::ObjDataConstPtr> sameMeshData = assetManager.loadMeshData(RAZ_TESTS_ROOT "assets/meshes/çûbè_BP.obj");
+  CHECK(assetManager.getRequestedTaskCount() == 3);
+
+  assetManager.finishLoading();
+  REQUIRE(meshData.get() != nullptr);
+  CHECK(meshData.get() == sameMeshData.get());
+  CHECK(meshData.get()->mesh.recoverVertexCount() == 24);
+  CHECK(assetManager.getMeshDataCache().getMemoryUsage() == 24 * sizeof(Raz::Vertex) + 36 * sizeof(unsigned int));
+  CHECK(assetManager.loadMeshData(RAZ_TESTS_ROOT "assets/meshes/çûbè_BP.obj").get() == meshData.get());
+  CHECK(assetManager.getRequestedTaskCount() == 3);
+}
+
+TEST_CASE("AssetManager failure") {
+  Raz::UploadQueue uploadQueue;
+  Raz::AssetManager assetManager(uploadQueue);
+
+  const std::shared_future<Raz::ImageConstPtr> image = assetManager.loadImage("nonExisting.png");
+  std::future<std::pair<Raz::Mesh, Raz::MeshRenderer>> mesh = assetManager.loadMesh("nonExisting.obj");
+  CHECK(assetManager.getRequestedTaskCount() == 3);
+
+  // A failed loading is considered finished, its exception being held by the returned future
+  assetManager.finishLoading();
+  CHECK(assetManager.getFinishedTaskCount() == 3);
+  CHECK(uploadQueue.isEmpty());
+
+  CHECK_THROWS_AS(image.get(), std::invalid_argument);
+  CHECK_THROWS_AS(mesh.get(), std::invalid_argument);
+}
+
+TEST_CASE("AssetManager mesh") {
+  Raz::UploadQueue uploadQueue;
+  Raz::AssetManager assetManager(uploadQueue);
+
+  const std::shared_future<Raz::Texture2DPtr> baseColorMap = assetManager.loadTexture(RAZ_TESTS_ROOT "assets/meshes/../materials/../textures/ŔĜBŖĀ.png");
+  std::future<std::pair<Raz::Mesh, Raz::MeshRenderer>> meshData = assetManager.loadMesh(RAZ_TESTS_ROOT "assets/meshes/çûbè_CT.obj");
+
+  assetManager.finishLoading();
+
+  // 2 tasks for the mesh, plus 2 for each of its 6 distinct textures; the base color map being shared with the one requested beforehand
+  CHECK(assetManager.getRequestedTaskCount() == 14);
+  CHECK(assetManager.getProgress() == 1.f);
+  CHECK(uploadQueue.isEmpty()); // The textures' uploads are all executed, even for those already created along with the mesh
+  CHECK(assetManager.getTextureCache().getAssetCount() == 6);
+  CHECK(assetManager.getMeshDataCache().getAssetCount() == 1);
+
+  const auto [mesh, meshRenderer] = meshData.get();
+  CHECK(mesh.recoverVertexCount() == 24);
+  CHECK(mesh.recoverTriangleCount() == 12);
+  REQUIRE(meshRenderer.getMaterials().size() == 1);
+
+  const Raz::RenderShaderProgram& matProgram = meshRenderer.getMaterials().front().getProgram();
+  CHECK(matProgram.getAttribute<float>(Raz::MaterialAttribute::Metallic) == 0.5f);
+  CHECK(&matProgram.getTexture(Raz::MaterialTexture::BaseColor) == baseColorMap.get().get());
+
+  // Loading the same mesh again only creates it from the cached data & textures
+  std::future<std::pair<Raz::Mesh, Raz::MeshRenderer>> otherMeshData = assetManager.loadMesh(RAZ_TESTS_ROOT "assets/meshes/çûbè_CT.obj");
+  assetManager.finishLoading();
+  CHECK(assetManager.getRequestedTaskCount() == 15);
+
+  const auto [otherMesh, otherMeshRenderer] = otherMeshData.get();
+  CHECK(otherMesh.recoverVertexCount() == 24);
+  CHECK(&otherMeshRenderer.getMaterials().front().getProgram().getTexture(Raz::MaterialTexture::BaseColor) == baseColorMap.get().get());
+}
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -36,6 +36,24 @@ TEST_CASE("Bitset basic") {
 
   copy.resize(7);
   CHECK_FALSE(copy.getSize() == fullOnes.getSize());
+  CHECK(copy.getBits() == std::vector<bool>({ true, true, true, true, true, true, false }));
+
+  // Bitsets of different sizes are equal if the extra bits are all disabled
+  CHECK(copy == fullOnes);
+  CHECK(fullOnes == copy);
+
+  copy.setBit(6);
+  CHECK(copy != fullOnes);
+  CHECK(fullOnes != copy);
+
+  Raz::Bitset largeCopy = alternated1;
+  largeCopy.resize(200);
+  CHECK(largeCopy == alternated1);
+  CHECK(alternated1 == largeCopy);
+
+  largeCopy.setBit(150);
+  CHECK(largeCopy != alternated1);
+  CHECK(alternated1 != largeCopy);
 
   copy.reset();
   CHECK(copy.isEmpty());
@@ -94,6 +112,95 @@ TEST_CASE("Bitset shifts") {
   CHECK(shiftTest == alternated1);
 }
 
+TEST_CASE("Bitset queries") {
+  CHECK_FALSE(alternated1.andAny(alternated2));
+  CHECK(alternated1.andAny(fullOnes));
+  CHECK_FALSE(fullOnes.andAny(fullZeros));
+  CHECK_FALSE(alternated1.andAny(Raz::Bitset()));
+
+  CHECK(alternated1.isSubsetOf(fullOnes));
+  CHECK(fullZeros.isSubsetOf(alternated2));
+  CHECK_FALSE(alternated1.isSubsetOf(alternated2));
+  CHECK_FALSE(fullOnes.isSubsetOf(alternated1));
+  CHECK_FALSE(fullOnes.isSubsetOf(Raz::Bitset(3, true))); // The last 3 enabled bits are not part of the smaller bitset
+  CHECK(Raz::Bitset(3, true).isSubsetOf(fullOnes));
+
+  CHECK(alternated1.findFirstEnabledBit() == 0);
+  CHECK(alternated1.findFirstEnabledBit(1) == 2);
+  CHECK(alternated2.findFirstEnabledBit() == 1);
+  CHECK(alternated2.findFirstEnabledBit(5) == 5);
+  CHECK(fullZeros.findFirstEnabledBit() == fullZeros.getSize());
+  CHECK(fullOnes.findFirstEnabledBit(10) == fullOnes.getSize());
+}
+
+TEST_CASE("Bitset large") {
+  // Bitsets of more than 128 bits are stored out of the object, on multiple words
+  Raz::Bitset largeBitset(300);
+  CHECK(largeBitset.getSize() == 300);
+  CHECK(largeBitset.isEmpty());
+  CHECK(largeBitset.findFirstEnabledBit() == 300);
+
+  largeBitset.setBit(3);
+  largeBitset.setBit(130);
+  largeBitset.setBit(299);
+  CHECK(largeBitset.getEnabledBitCount() == 3);
+  CHECK(largeBitset[130]);
+  CHECK_FALSE(largeBitset[131]);
+
+  CHECK(largeBitset.findFirstEnabledBit() == 3);
+  CHECK(largeBitset.findFirstEnabledBit(4) == 130);
+  CHECK(largeBitset.findFirstEnabledBit(131) == 299);
+
+  const Raz::Bitset largeOnes(300, true);
+  CHECK(largeOnes.getEnabledBitCount() == 300);
+  CHECK((~largeOnes).isEmpty());
+  CHECK((largeBitset & largeOnes) == largeBitset);
+  CHECK((largeBitset | largeOnes) == largeOnes);
+  CHECK((largeBitset ^ largeOnes).getEnabledBitCount() == 297);
+  CHECK(largeBitset.andAny(largeOnes));
+  CHECK(largeBitset.isSubsetOf(largeOnes));
+  CHECK_FALSE(largeOnes.isSubsetOf(largeBitset));
+
+  // Setting a bit past the size extends the bitset
+  Raz::Bitset growingBitset = alternated1;
+  growingBitset.setBit(200);
+  CHECK(growingBitset.getSize() == 201);
+  CHECK(growingBitset.getEnabledBitCount() == 4);
+  CHECK(growingBitset.andAny(largeBitset) == false);
+
+  growingBitset.setBit(130);
+  CHECK(growingBitset.andAny(largeBitset));
+
+  // Shrinking then growing back must not restore the previously enabled bits
+  growingBitset.resize(100);
+  CHECK(growingBitset.getEnabledBitCount() == 3);
+  growingBitset.resize(201);
+  CHECK(growingBitset.getEnabledBitCount() == 3);
+
+  // Operations between bitsets of different sizes only modify the common bits
+  Raz::Bitset partialBitset = largeOnes;
+  partialBitset &= fullZeros;
+  CHECK(partialBitset.getSize() == 300);
+  CHECK(partialBitset.findFirstEnabledBit() == 6);
+  CHECK(partialBitset.getEnabledBitCount() == 294);
+
+  const Raz::Bitset movedBitset = std::move(partialBitset);
+  CHECK(movedBitset.getEnabledBitCount() == 294);
+
+  // Moving a bitset into itself leaves it unchanged, whether its words are stored inline or out of the object; the self-move is made
+  //  through a reference so that compilers do not warn about it
+  Raz::Bitset smallBitset = alternated1;
+  Raz::Bitset& smallBitsetRef = smallBitset;
+  smallBitset = std::move(smallBitsetRef);
+  CHECK(smallBitset == alternated1);
+
+  Raz::Bitset& largeBitsetRef = largeBitset;
+  largeBitset = std::move(largeBitsetRef);
+  CHECK(largeBitset.getSize() == 300);
+  CHECK(largeBitset.getEnabledBitCount() == 3);
+  CHECK(largeBitset[299]);
+}
+
 TEST_CASE("Bitset printing") {
   std::stringstream stream;
 
@@ -213,7 +213,7 @@ TEST_CASE("BvhSystem query") {
 
   CHECK(entity == &mesh1);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.f, 0.5f));
-  CHECK_THROWS(triangle1.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle1.contains(hit.position));
   CHECK(hit.normal == triangle1.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -221,7 +221,7 @@ TEST_CASE("BvhSystem query") {
 
   CHECK(entity == &mesh2);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.5f, 0.f));
-  CHECK_THROWS(triangle2.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle2.contains(hit.position));
   CHECK(hit.normal == triangle2.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -229,7 +229,7 @@ TEST_CASE("BvhSystem query") {
 
   CHECK(entity == &mesh3);
   CHECK(hit.position == Raz::Vec3f(-2.f, 0.f, 0.f));
-  CHECK_THROWS(triangle3.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle3.contains(hit.position));
   CHECK(hit.normal == triangle3.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -238,7 +238,7 @@ TEST_CASE("BvhSystem query") {
 
   CHECK(entity == &mesh1);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.f, 0.25f));
-  CHECK_THROWS(triangle1.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle1.contains(hit.position));
   CHECK(hit.normal == -triangle1.computeNormal());
   CHECK(hit.distance == 1.414213538f);
 
@@ -247,7 +247,7 @@ TEST_CASE("BvhSystem query") {
 
   CHECK(entity == &mesh2);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.375f, 0.f));
-  CHECK_THROWS(triangle2.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle2.contains(hit.position));
   CHECK(hit.normal == -triangle2.computeNormal());
   CHECK(hit.distance == 1.414213538f);
 
@@ -330,3 +330,23 @@ TEST_CASE("Mesh AABB") {
   CHECK(boundingBox.getMinPosition().strictlyEquals(box.getMinPosition()));
   CHECK(boundingBox.getMaxPosition().strictlyEquals(box.getMaxPosition()));
 }
+
+TEST_CASE("Mesh clone") {
+  Raz::Mesh mesh(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  mesh.addSubmesh().getVertices().emplace_back(Raz::Vertex{ Raz::Vec3f(2.f) });
+  mesh.computeBoundingBox();
+
+  const Raz::Mesh clonedMesh = mesh.clone();
+
+  REQUIRE(clonedMesh.getSubmeshes().size() == 2);
+  CHECK(clonedMesh.recoverVertexCount() == mesh.recoverVertexCount());
+  CHECK(clonedMesh.recoverTriangleCount() == mesh.recoverTriangleCount());
+  CHECK(clonedMesh.getSubmeshes().front().getVertices() == mesh.getSubmeshes().front().getVertices());
+  CHECK(clonedMesh.getSubmeshes().front().getTriangleIndices() == mesh.getSubmeshes().front().getTriangleIndices());
+  CHECK(clonedMesh.getSubmeshes().back().getBoundingBox() == mesh.getSubmeshes().back().getBoundingBox());
+  CHECK(clonedMesh.getBoundingBox() == mesh.getBoundingBox());
+
+  // The cloned data is independent from the original's
+  mesh.getSubmeshes().front().getVertices().front().position = Raz::Vec3f(42.f);
+  CHECK(clonedMesh.getSubmeshes().front().getVertices().front().position != Raz::Vec3f(42.f));
+}
@@ -603,6 +603,44 @@ TEST_CASE("ObjFormat load Cook-Torrance") {
   }
 }
 
+TEST_CASE("ObjFormat load data") {
+  // Loading the data only reads the files & does not require any graphics context
+  const Raz::ObjFormat::ObjData objData = Raz::ObjFormat::loadData(RAZ_TESTS_ROOT "assets/meshes/çûbè_CT.obj");
+
+  CHECK(objData.mesh.getSubmeshes().size() == 1);
+  CHECK(objData.mesh.recoverVertexCount() == 24);
+  CHECK(objData.mesh.recoverTriangleCount() == 12);
+
+  REQUIRE(objData.submeshMaterialIndices.size() == 1);
+  CHECK(objData.submeshMaterialIndices.front() == 0);
+
+  REQUIRE(objData.materials.size() == 1);
+
+  const Raz::ObjFormat::MaterialData& material = objData.materials.front();
+  CHECK(material.type == Raz::MaterialType::COOK_TORRANCE);
+
+  REQUIRE(material.vec3Attributes.size() == 2);
+  CHECK(material.vec3Attributes[0].first == Raz::MaterialAttribute::BaseColor);
+  CHECK(material.vec3Attributes[0].second == Raz::Vec3f(0.99f));
+  CHECK(material.vec3Attributes[1].first == Raz::MaterialAttribute::Emissive);
+  CHECK(material.vec3Attributes[1].second == Raz::Vec3f(0.75f));
+
+  REQUIRE(material.floatAttributes.size() == 2);
+  CHECK(material.floatAttributes[0].first == Raz::MaterialAttribute::Metallic);
+  CHECK(material.floatAttributes[0].second == 0.5f);
+  CHECK(material.floatAttributes[1].first == Raz::MaterialAttribute::Roughness);
+  CHECK(material.floatAttributes[1].second == 0.25f);
+
+  // The textures are only referenced, relatively to the MTL file
+  REQUIRE(material.textures.size() == 6);
+  CHECK(material.textures[0].first == Raz::MaterialTexture::BaseColor);
+  CHECK(material.textures[0].second == RAZ_TESTS_ROOT "assets/meshes/../materials/../textures/ŔĜBŖĀ.png");
+  CHECK(material.textures[2].first == Raz::MaterialTexture::Normal);
+  CHECK(material.textures[2].second == RAZ_TESTS_ROOT "assets/meshes/../materials/../textures/BƁḂɃ.png");
+  CHECK(material.textures[5].first == Raz::MaterialTexture::Ambient);
+  CHECK(material.textures[5].second == RAZ_TESTS_ROOT "assets/meshes/../materials/../textures/₁₀₀₁.png");
+}
+
 TEST_CASE("ObjFormat save") {
   const auto checkMeshData = [] (const Raz::Mesh& mesh) {
     CHECK(mesh.getSubmeshes().size() == 2);
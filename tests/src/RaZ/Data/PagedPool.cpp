@@ -0,0 +1,97 @@
+#include "Catch.hpp"
+
+#include "RaZ/Data/PagedPool.hpp"
+
+#include <vector>
+
+namespace {
+
+struct TestElement {
+  explicit TestElement(int val) : value{ val } { ++aliveCount; }
+  TestElement(const TestElement&) = delete;
+  TestElement(TestElement&&) noexcept = delete;
+
+  TestElement& operator=(const TestElement&) = delete;
+  TestElement& operator=(TestElement&&) noexcept = delete;
+
+  ~TestElement() { --aliveCount; }
+
+  int value {};
+
+  static inline int aliveCount = 0;
+};
+
+} // namespace
+
+TEST_CASE("PagedPool basic") {
+  Raz::PagedPool<TestElement, 4> pool;
+  CHECK(pool.isEmpty());
+  CHECK(pool.getCapacity() == 0);
+
+  pool.reserve(5);
+  CHECK(pool.getCapacity() == 8); // Pages are allocated entirely
+  CHECK(pool.isEmpty());
+
+  CHECK(pool.emplace(0).value == 0);
+  CHECK(pool.emplace(1).value == 1);
+  CHECK(pool.getSize() == 2);
+  CHECK(TestElement::aliveCount == 2);
+
+  pool.clear();
+  CHECK(pool.isEmpty());
+  CHECK(pool.getCapacity() == 8); // Clearing the pool keeps its pages
+  CHECK(TestElement::aliveCount == 0);
+}
+
+TEST_CASE("PagedPool stable references") {
+  Raz::PagedPool<TestElement, 4> pool;
+
+  std::vector<TestElement*> elements;
+
+  for (int i = 0; i < 10; ++i)
+    elements.emplace_back(&pool.emplace(i));
+
+  CHECK(pool.getSize() == 10);
+  CHECK(pool.getCapacity() == 12);
+
+  // Adding pages does not move the previously added elements
+  for (int i = 0; i < 10; ++i)
+    CHECK(elements[static_cast<std::size_t>(i)]->value == i);
+
+  pool.erase(*elements[3]);
+  pool.erase(*elements[7]);
+  CHECK(pool.getSize() == 8);
+  CHECK(TestElement::aliveCount == 8);
+
+  // The slots freed by the erased elements are reused
+  TestElement& reusedElem = pool.emplace(42);
+  CHECK((&reusedElem == elements[3] || &reusedElem == elements[7]));
+  CHECK(pool.getCapacity() == 12);
+
+  std::vector<int> values;
+  pool.forEach([&values] (const TestElement& element) { values.emplace_back(element.value); });
+
+  // Iterating follows the storage order, skipping the free slots
+  CHECK(values == std::vector<int>({ 0, 1, 2, 4, 5, 6, 42, 8, 9 }));
+}
+
+TEST_CASE("PagedPool move") {
+  Raz::PagedPool<TestElement, 4> pool;
+  TestElement& element = pool.emplace(3);
+
+  Raz::PagedPool<TestElement, 4> movedPool(std::move(pool));
+  CHECK(movedPool.getSize() == 1);
+  CHECK(pool.isEmpty());
+
+  // Moving the pool does not move the elements
+  movedPool.forEach([&element] (const TestElement& elem) { CHECK(&elem == &element); });
+
+  Raz::PagedPool<TestElement, 4> assignedPool;
+  assignedPool.emplace(4);
+  CHECK(TestElement::aliveCount == 2);
+
+  assignedPool = std::move(movedPool);
+  CHECK(TestElement::aliveCount == 1); // The previously held elements have been destroyed
+  CHECK(assignedPool.getSize() == 1);
+  CHECK(element.value == 3);
+}
@@ -0,0 +1,108 @@
+#include "Catch.hpp"
+
+#include "RaZ/Physics/Broadphase.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <initializer_list>
+#include <random>
+
+namespace {
+
+std::vector<Raz::AABB> createRandomBoxes(std::size_t boxCount) {
+  std::mt19937 randGen(42);
+  std::uniform_real_distribution<float> posDist(-20.f, 20.f);
+  std::uniform_real_distribution<float> sizeDist(0.f, 3.f);
+
+  std::vector<Raz::AABB> boxes;
+  boxes.reserve(boxCount);
+
+  for (std::size_t boxIndex = 0; boxIndex < boxCount; ++boxIndex) {
+    const Raz::Vec3f minPos(posDist(randGen), posDist(randGen), posDist(randGen));
+    boxes.emplace_back(minPos, minPos + Raz::Vec3f(sizeDist(randGen), sizeDist(randGen), sizeDist(randGen)));
+  }
+
+  return boxes;
+}
+
+/// Broadphase only defining how to find all the pairs, relying on the default way of finding those between two groups.
+class GenericBroadphase final : public Raz::Broadphase {
+public:
+  void computePairs(const std::vector<Raz::AABB>& boxes, std::vector<Raz::BroadphasePair>& pairs) override {
+    Raz::BruteForceBroadphase().computePairs(boxes, pairs);
+  }
+};
+
+} // namespace
+
+TEST_CASE("Broadphase pairs") {
+  const std::vector<Raz::AABB> boxes = {
+    Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f)),
+    Raz::AABB(Raz::Vec3f(5.f), Raz::Vec3f(6.f)),
+    Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.f)),
+    Raz::AABB(Raz::Vec3f(1.f, 2.f, 1.f), Raz::Vec3f(3.f)), // Only touching the third box
+    Raz::AABB(Raz::Vec3f(0.f, 10.f, 0.f), Raz::Vec3f(1.f, 11.f, 1.f)) // Overlapping the first box along X & Z, but not along Y
+  };
+  const std::vector<Raz::BroadphasePair> expectedPairs = { { 0, 2 }, { 2, 3 } };
+
+  std::vector<Raz::BroadphasePair> pairs = { { 42, 42 } };
+
+  Raz::BruteForceBroadphase bruteForce;
+  bruteForce.computePairs(boxes, pairs);
+  CHECK(pairs == expectedPairs);
+
+  Raz::SweepAndPruneBroadphase sweepAndPrune;
+  CHECK(sweepAndPrune.computeMemoryUsage() == 0);
+  sweepAndPrune.computePairs(boxes, pairs);
+  CHECK(pairs == expectedPairs);
+  CHECK(sweepAndPrune.computeMemoryUsage() > 0); // Its buffers are kept for the next calls
+
+  sweepAndPrune.computePairs({}, pairs);
+  CHECK(pairs.empty());
+}
+
+TEST_CASE("Broadphase consistency") {
+  const std::vector<Raz::AABB> boxes = createRandomBoxes(500);
+
+  std::vector<Raz::BroadphasePair> bruteForcePairs;
+  Raz::BruteForceBroadphase().computePairs(boxes, bruteForcePairs);
+  REQUIRE_FALSE(bruteForcePairs.empty());
+
+  // The sweep & prune must find exactly the same pairs, in the same order
+  std::vector<Raz::BroadphasePair> sweepAndPrunePairs;
+  Raz::SweepAndPruneBroadphase().computePairs(boxes, sweepAndPrunePairs);
+  CHECK(sweepAndPrunePairs == bruteForcePairs);
+}
+
+TEST_CASE("Broadphase group pairs") {
+  const std::vector<Raz::AABB> boxes = createRandomBoxes(500);
+  constexpr std::size_t firstGroupCount = 200;
+
+  std::vector<Raz::BroadphasePair> allPairs;
+  Raz::BruteForceBroadphase().computePairs(boxes, allPairs);
+
+  std::vector<Raz::BroadphasePair> expectedPairs;
+  for (const Raz::BroadphasePair& pair : allPairs) {
+    if (pair.first < firstGroupCount && pair.second >= firstGroupCount)
+      expectedPairs.emplace_back(pair);
+  }
+  REQUIRE_FALSE(expectedPairs.empty());
+  REQUIRE(expectedPairs.size() < allPairs.size());
+
+  Raz::BruteForceBroadphase bruteForce;
+  Raz::SweepAndPruneBroadphase sweepAndPrune;
+  GenericBroadphase generic;
+
+  for (Raz::Broadphase* broadphase : std::initializer_list<Raz::Broadphase*>{ &bruteForce, &sweepAndPrune, &generic }) {
+    std::vector<Raz::BroadphasePair> pairs = { { 42, 42 } };
+
+    broadphase->computeGroupPairs(boxes, firstGroupCount, pairs);
+    CHECK(pairs == expectedPairs);
+
+    // If either group is empty, no pair can be found
+    broadphase->computeGroupPairs(boxes, 0, pairs);
+    CHECK(pairs.empty());
+
+    broadphase->computeGroupPairs(boxes, boxes.size(), pairs);
+    CHECK(pairs.empty());
+  }
+}
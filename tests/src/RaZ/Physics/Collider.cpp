@@ -2,6 +2,8 @@
 
 #include "RaZ/Physics/Collider.hpp"
 
+#include <type_traits>
+
 TEST_CASE("Collider basic") {
   Raz::Collider collider(Raz::Plane(1.5f));
   CHECK(collider.getShapeType() == Raz::ShapeType::PLANE);
@@ -21,3 +23,87 @@ TEST_CASE("Collider basic") {
   CHECK(collider.getShapeType() == Raz::ShapeType::AABB);
   CHECK(collider.getShape<Raz::AABB>().computeCentroid() == Raz::Vec3f(0.f));
 }
+
+TEST_CASE("Collider copy") {
+  const Raz::Collider collider(Raz::Sphere(Raz::Vec3f(1.f), 2.f));
+
+  // The shape being held by value, the copy owns its own shape
+  Raz::Collider colliderCopy = collider;
+  CHECK(colliderCopy.getShapeType() == Raz::ShapeType::SPHERE);
+  CHECK(&colliderCopy.getShape() != &collider.getShape());
+
+  colliderCopy.getShape<Raz::Sphere>() = Raz::Sphere(Raz::Vec3f(1.f), 3.f);
+  CHECK(colliderCopy.getShape<Raz::Sphere>().getRadius() == 3.f);
+  CHECK(collider.getShape<Raz::Sphere>().getRadius() == 2.f);
+}
+
+TEST_CASE("Collider shape visit") {
+  Raz::Collider collider(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  // The visited shape is given with its actual type
+  const auto getShapeType = [] (const auto& shape) noexcept {
+    using ShapeT = std::decay_t<decltype(shape)>;
+
+    if constexpr (std::is_same_v<ShapeT, Raz::AABB>)
+      return Raz::ShapeType::AABB;
+    else if constexpr (std::is_same_v<ShapeT, Raz::Triangle>)
+      return Raz::ShapeType::TRIANGLE;
+    else
+      return shape.getType();
+  };
+
+  CHECK(collider.visitShape(getShapeType) == Raz::ShapeType::AABB);
+  CHECK(collider.visitShape([] (const auto& shape) noexcept { return shape.computeCentroid(); }) == Raz::Vec3f(0.f));
+
+  collider.setShape(Raz::Triangle(Raz::Vec3f(-1.f, 0.f, 0.f), Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(1.f, 0.f, 0.f)));
+  CHECK(collider.visitShape(getShapeType) == Raz::ShapeType::TRIANGLE);
+
+  collider.setShape(Raz::Plane(1.f));
+  CHECK(collider.visitShape(getShapeType) == Raz::ShapeType::PLANE);
+}
+
+TEST_CASE("Collider intersection") {
+  const Raz::Collider sphere(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  const Raz::Collider aabb(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.f)));
+  const Raz::Collider obb(Raz::OBB(Raz::Vec3f(2.5f), Raz::Vec3f(3.5f)));
+
+  CHECK(sphere.intersects(aabb));
+  CHECK(aabb.intersects(sphere));
+  CHECK_FALSE(aabb.intersects(obb)); // The box is beyond the other one's farthest corner
+  CHECK(aabb.intersects(Raz::OBB(Raz::Vec3f(1.5f), Raz::Vec3f(2.5f))));
+  CHECK_FALSE(sphere.intersects(obb));
+  CHECK_FALSE(obb.intersects(sphere));
+
+  CHECK(sphere.intersects(Raz::Sphere(Raz::Vec3f(1.5f, 0.f, 0.f), 1.f)));
+  CHECK_FALSE(sphere.intersects(Raz::Sphere(Raz::Vec3f(3.f, 0.f, 0.f), 1.f)));
+}
+
+TEST_CASE("Collider ray intersection") {
+  const Raz::Ray ray(Raz::Vec3f(0.f), Raz::Axis::Y);
+  Raz::RayHit hit;
+
+  const Raz::Collider line(Raz::Line(Raz::Vec3f(-1.f, 2.f, 0.f), Raz::Vec3f(1.f, 2.f, 0.f)));
+  CHECK(line.intersects(ray, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 2.f, 0.f));
+  CHECK(hit.distance == 2.f);
+
+  const Raz::Collider quad(Raz::Quad(Raz::Vec3f(-1.f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, 1.f), Raz::Vec3f(-1.f, 0.5f, 1.f)));
+  CHECK(quad.intersects(ray, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.5f, 0.f));
+  CHECK(hit.normal == -Raz::Axis::Y);
+  CHECK(hit.distance == 0.5f);
+
+  // Rotated by 90 degrees around the Z axis, the box's X & Y extents are swapped around its centroid, giving [ -1; 2; -0.5 ] & [ 1; 5; 0.5 ]
+  const Raz::Collider obb(Raz::OBB(Raz::Vec3f(-1.5f, 2.5f, -0.5f), Raz::Vec3f(1.5f, 4.5f, 0.5f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                                                          1.f,  0.f, 0.f,
+                                                                                                          0.f,  0.f, 1.f)));
+  CHECK(obb.intersects(ray, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.f, 2.f, 0.f)));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-Raz::Axis::Y));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(2.f));
+
+  const Raz::Ray missingRay(Raz::Vec3f(3.f, 0.f, 0.f), Raz::Axis::Y);
+  CHECK_FALSE(line.intersects(missingRay));
+  CHECK_FALSE(quad.intersects(missingRay));
+  CHECK_FALSE(obb.intersects(missingRay));
+}
@@ -1,4 +1,5 @@
 #include "Catch.hpp"
+#include "PhysicsTestUtils.hpp"
 
 #include "RaZ/World.hpp"
 #include "RaZ/Math/Transform.hpp"
@@ -6,15 +7,27 @@
 #include "RaZ/Physics/PhysicsSystem.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
 TEST_CASE("PhysicsSystem basic") {
   Raz::PhysicsSystem physics;
   CHECK(physics.getGravity() == Raz::Vec3f(0.f, -9.80665f, 0.f));
   CHECK(physics.getFriction() == 0.95f);
 
+  CHECK(physics.getSleepVelocity() == 0.2f);
+  CHECK(physics.getSleepDelay() == 0.5f);
+
   physics.setGravity(Raz::Vec3f(0.f));
   physics.setFriction(0.25f);
+  physics.setSleepVelocity(0.1f);
+  physics.setSleepDelay(1.f);
   CHECK(physics.getGravity() == Raz::Vec3f(0.f));
   CHECK(physics.getFriction() == 0.25f);
+  CHECK(physics.getSleepVelocity() == 0.1f);
+  CHECK(physics.getSleepDelay() == 1.f);
 }
 
 TEST_CASE("PhysicsSystem accepted components") {
@@ -31,6 +44,49 @@ TEST_CASE("PhysicsSystem accepted components") {
   CHECK(physics.containsEntity(collider));
 }
 
+TEST_CASE("PhysicsSystem integration") {
+  Raz::World world(11);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+  physics.setFriction(1.f);
+
+  // Enough rigid bodies are created so that some are integrated several at once & others one by one
+  std::vector<std::pair<Raz::Transform*, Raz::RigidBody*>> bodies;
+
+  for (int i = 0; i < 10; ++i) {
+    const auto value = static_cast<float>(i);
+
+    Raz::Entity& entity = world.addEntity();
+    auto& transform     = entity.addComponent<Raz::Transform>(Raz::Vec3f(value, 0.f, 0.f));
+    auto& rigidBody     = entity.addComponent<Raz::RigidBody>(value + 1.f, 0.f);
+    rigidBody.setForces(Raz::Vec3f((value + 1.f) * 2.f, 0.f, 0.f)); // Giving an acceleration of 2 along X
+    rigidBody.setVelocity(Raz::Vec3f(0.f, value, -1.f));
+
+    bodies.emplace_back(&transform, &rigidBody);
+  }
+
+  // A rigid body having neither velocity nor forces applied does not move
+  Raz::Entity& restingEntity = world.addEntity();
+  auto& restingTransform     = restingEntity.addComponent<Raz::Transform>(Raz::Vec3f(1.f));
+  restingEntity.addComponent<Raz::RigidBody>(1.f, 0.f);
+
+  world.refresh();
+  restingTransform.setUpdated(false);
+
+  physics.step(0.5f);
+
+  for (std::size_t i = 0; i < bodies.size(); ++i) {
+    const auto value = static_cast<float>(i);
+
+    CHECK(bodies[i].second->getVelocity().strictlyEquals(Raz::Vec3f(1.f, value, -1.f)));
+    CHECK(bodies[i].first->getPosition().strictlyEquals(Raz::Vec3f(value + 0.5f, value * 0.5f, -0.5f))); // Moved with the integrated velocity
+  }
+
+  CHECK(restingTransform.getPosition().strictlyEquals(Raz::Vec3f(1.f)));
+  CHECK_FALSE(restingTransform.hasUpdated()); // Its transform has not been modified
+}
+
 TEST_CASE("PhysicsSystem rigid bodies collision") {
   Raz::World world(4);
 
@@ -67,41 +123,472 @@ TEST_CASE("PhysicsSystem rigid bodies collision") {
   world.update(0.02f);
 
   // The particles have started moving downards
-  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.998638f, 0.f));
+  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.997276127f, 0.f));
   CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -0.163437635f, 0.f));
-  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.998638f, 0.f));
+  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.997276127f, 0.f));
   CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -0.163437635f, 0.f));
   CHECK(staticParticleTransform.getPosition().strictlyEquals(initParticlePos)); // The static particle still remains unchanged
   CHECK(staticParticleRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
 
   // Updating to right before the collision
-  world.update(0.44f);
+  world.update(0.42f);
 
-  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.0143348f, 0.f));
-  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -4.3641448f, 0.f));
-  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.0143348f, 0.f));
-  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -4.3641448f, 0.f));
+  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.050701201f, 0.f));
+  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -4.20429945f, 0.f));
+  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.050701201f, 0.f));
+  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -4.20429945f, 0.f));
   CHECK(staticParticleTransform.getPosition().strictlyEquals(initParticlePos));
   CHECK(staticParticleRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
 
-  // Collision with the floor happens on the next step
+  // Collision with the floor happens on the next step; the particles are brought onto it, then bounce off from there
   world.update(0.01f);
 
-  // Particles having collided with the floor, they now have an upward velocity
-  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.002f, 0.f));
-  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 4.29766f, 0.f)); // Having a high bounciness, the velocity has been almost fully reverted
-  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.002f, 0.f));
-  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 0.226192668f, 0.f)); // Having a low bounciness, the velocity has decreased dramatically
+  // Particles having collided with the floor, they are now lying on it with an upward velocity
+  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f));
+  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 4.14593792f, 0.f)); // Having a high bounciness, the velocity has been almost fully reverted
+  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f));
+  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 0.218207121f, 0.f)); // Having a low bounciness, the velocity has decreased dramatically
   CHECK(staticParticleTransform.getPosition().strictlyEquals(initParticlePos));
   CHECK(staticParticleRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
 
-  world.update(0.03f);
+  world.update(0.04f);
 
   // After more steps, due to the velocity difference, the two particles' positions have been desynchronized
-  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.139680699f, 0.f));
-  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 3.96358323f, 0.f));
-  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.00408647349f, 0.f));
-  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -0.100929342f, 0.f)); // The solid particle goes back downards almost instantly
+  CHECK(bouncyParticleTransform.getPosition() == Raz::Vec3f(0.f, 0.129846096f, 0.f));
+  CHECK(bouncyParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, 3.81211972f, 0.f));
+  CHECK(solidParticleTransform.getPosition() == Raz::Vec3f(0.f)); // The solid particle has fallen back onto the floor almost instantly
+  CHECK(solidParticleRigidBody.getVelocity() == Raz::Vec3f(0.f, -0.0545830764f, 0.f));
   CHECK(staticParticleTransform.getPosition().strictlyEquals(initParticlePos));
   CHECK(staticParticleRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
 }
+
+TEST_CASE("PhysicsSystem stacked rigid bodies") {
+  const auto simulateStack = [] (bool enableWarmStarting) {
+    Raz::World world(11);
+
+    auto& physics = world.addSystem<Raz::PhysicsSystem>();
+    physics.enableWarmStarting(enableWarmStarting);
+
+    world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+    // Each rigid body holds a box on top of which the next one lies
+    const Raz::Transform* topTransform = nullptr;
+
+    for (int i = 0; i < 10; ++i) {
+      Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, static_cast<float>(i) * 0.5f, 0.f));
+      entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+      entity.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.5f, 0.f, -0.5f), Raz::Vec3f(0.5f)));
+      topTransform = &entity.getComponent<Raz::Transform>();
+    }
+
+    world.refresh();
+
+    for (int i = 0; i < 10; ++i)
+      physics.step(0.02f);
+
+    CHECK(physics.getContactCount() == 10); // Each rigid body lies on the box below it, the lowest one lying on the floor
+
+    for (int i = 0; i < 40; ++i)
+      physics.step(0.02f);
+
+    return topTransform->getPosition().y();
+  };
+
+  const float warmStartedHeight = simulateStack(true);
+  const float coldStartedHeight = simulateStack(false);
+
+  // Reusing the impulses of the last step, the stack barely sinks, converging much better than when starting from scratch
+  CHECK_THAT(warmStartedHeight, IsNearlyEqualTo(4.5f, 0.05f));
+  CHECK(std::abs(4.5f - warmStartedHeight) < std::abs(4.5f - coldStartedHeight));
+}
+
+TEST_CASE("PhysicsSystem continuous collision") {
+  Raz::World world(5);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+  physics.setFriction(1.f);
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, 10.f)).addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  const auto createProjectile = [&world] (const Raz::Vec3f& position, const Raz::Vec3f& velocity, bool isContinuous) -> Raz::Entity& {
+    Raz::Entity& projectile = world.addEntityWithComponent<Raz::Transform>(position);
+    auto& rigidBody = projectile.addComponent<Raz::RigidBody>(1.f, 0.f);
+    rigidBody.setVelocity(velocity);
+    rigidBody.enableContinuousCollision(isContinuous);
+    return projectile;
+  };
+
+  SECTION("Passing by") {
+    // The projectiles pass diagonally right next to the sphere & the box, which they never hit
+    constexpr Raz::Vec3f velocity(100.f, -100.f, 0.f);
+    const Raz::Entity& discreteSphereProjectile   = createProjectile(Raz::Vec3f(-1.4f, 3.f, 0.f), velocity, false);
+    const Raz::Entity& continuousSphereProjectile = createProjectile(Raz::Vec3f(-1.4f, 3.f, 0.f), velocity, true);
+    const Raz::Entity& continuousBoxProjectile    = createProjectile(Raz::Vec3f(-0.5f, 3.f, 10.f), velocity, true);
+    world.refresh();
+
+    // Stepping at a low rate, a projectile travels over 7 units per step, the contacts being computed from far away
+    physics.step(0.05f);
+
+    // Only following their path shows that they do not hit anything; otherwise, a projectile is stopped by the tangent plane facing it
+    CHECK_FALSE(discreteSphereProjectile.getComponent<Raz::RigidBody>().getVelocity() == velocity);
+    CHECK(continuousSphereProjectile.getComponent<Raz::RigidBody>().getVelocity().strictlyEquals(velocity));
+    CHECK(continuousSphereProjectile.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(3.6f, -2.f, 0.f));
+    CHECK(continuousBoxProjectile.getComponent<Raz::RigidBody>().getVelocity().strictlyEquals(velocity));
+    CHECK(continuousBoxProjectile.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(4.5f, -2.f, 10.f));
+  }
+
+  SECTION("Hitting") {
+    // The projectiles hit the sphere & the box on their side
+    constexpr Raz::Vec3f velocity(100.f, 0.f, 0.f);
+    const Raz::Entity& discreteSphereProjectile   = createProjectile(Raz::Vec3f(-3.f, 0.8f, 0.f), velocity, false);
+    const Raz::Entity& continuousSphereProjectile = createProjectile(Raz::Vec3f(-3.f, 0.8f, 0.f), velocity, true);
+    const Raz::Entity& continuousBoxProjectile    = createProjectile(Raz::Vec3f(-3.f, 0.8f, 10.f), velocity, true);
+    world.refresh();
+
+    physics.step(0.05f);
+
+    // The continuous projectile is stopped along the sphere's normal where it hits it, then slides on the tangent plane at this point
+    constexpr Raz::Vec3f impactPos(-0.6f, 0.8f, 0.f);
+    constexpr Raz::Vec3f impactNormal(-0.6f, 0.8f, 0.f);
+    const Raz::Vec3f& continuousSpherePos = continuousSphereProjectile.getComponent<Raz::Transform>().getPosition();
+    CHECK_THAT((continuousSpherePos - impactPos).dot(impactNormal), IsNearlyEqualTo(0.f, 0.005f));
+    CHECK_THAT(continuousSphereProjectile.getComponent<Raz::RigidBody>().getVelocity().dot(impactNormal), IsNearlyEqualTo(0.f, 0.1f)); // Was -60
+
+    // The discrete one is stopped on the tangent plane at the closest point from where it started, far before the actual impact
+    const Raz::Vec3f& discreteSpherePos = discreteSphereProjectile.getComponent<Raz::Transform>().getPosition();
+    CHECK((discreteSpherePos - impactPos).dot(impactNormal) > 0.5f);
+
+    // The box projectile is stopped right on the box's face
+    CHECK_THAT(continuousBoxProjectile.getComponent<Raz::Transform>().getPosition().x(), IsNearlyEqualTo(-1.f, 0.001f));
+    CHECK(continuousBoxProjectile.getComponent<Raz::RigidBody>().getVelocity() == Raz::Vec3f(0.f));
+  }
+
+  SECTION("Bouncing") {
+    // A fast & bouncy projectile falls onto the box at a low rate
+    Raz::Entity& projectile   = createProjectile(Raz::Vec3f(0.f, 5.f, 10.f), Raz::Vec3f(0.f, -80.f, 0.f), true);
+    auto& projectileRigidBody = projectile.getComponent<Raz::RigidBody>();
+    projectileRigidBody.setBounciness(1.f);
+    world.refresh();
+
+    physics.step(0.1f);
+
+    // It bounces off where it hits the box, instead of from where it started
+    CHECK_THAT(projectile.getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(1.f, 0.001f));
+    CHECK(projectileRigidBody.getVelocity() == Raz::Vec3f(0.f, 80.f, 0.f));
+  }
+}
+
+TEST_CASE("PhysicsSystem broadphase") {
+  const auto simulateScene = [] (bool useBruteForce) {
+    Raz::World world(17);
+
+    auto& physics = world.addSystem<Raz::PhysicsSystem>();
+    CHECK(physics.computeMemoryUsage() == 0); // Nothing has been simulated yet
+
+    if (useBruteForce)
+      physics.setBroadphase<Raz::BruteForceBroadphase>();
+
+    world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+    // Falling particles, half of them being above spheres which they will hit before reaching the floor
+    std::vector<const Raz::Transform*> particleTransforms;
+
+    for (int i = 0; i < 8; ++i) {
+      const auto posX = static_cast<float>(i * 3);
+
+      Raz::Entity& particle = world.addEntity();
+      particleTransforms.emplace_back(&particle.addComponent<Raz::Transform>(Raz::Vec3f(posX, 2.f, 0.f)));
+      particle.addComponent<Raz::RigidBody>(1.f, 0.5f);
+
+      if (i % 2 == 0)
+        world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(posX, 0.f, 0.f)).addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+    }
+
+    for (int i = 0; i < 45; ++i)
+      world.update(0.02f);
+
+    // Only the particles' movement boxes overlapping the spheres are given as pairs; the floor plane is always checked
+    if (!useBruteForce)
+      CHECK(physics.getBroadphasePairCount() < 8);
+
+    CHECK(physics.computeMemoryUsage() > 0);
+
+    std::vector<Raz::Vec3f> particlePositions;
+
+    for (const Raz::Transform* transform : particleTransforms)
+      particlePositions.emplace_back(transform->getPosition());
+
+    return particlePositions;
+  };
+
+  const std::vector<Raz::Vec3f> positions = simulateScene(false);
+
+  // The particles above the spheres have bounced on them, the others having fallen further
+  CHECK(positions[0].y() > positions[1].y());
+  CHECK(positions[0].y() >= 1.f);
+
+  // The results do not depend on the chosen broadphase
+  CHECK(positions == simulateScene(true));
+}
+
+TEST_CASE("PhysicsSystem islands") {
+  const auto simulateClusters = [] (std::size_t clusterCount) {
+    Raz::World world(clusterCount * 2 + 1);
+
+    auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+    world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+    // Each cluster is made of a rigid body lying on the floor & holding a sphere collider, on which falls another rigid body
+    std::vector<std::pair<const Raz::Transform*, float>> transforms;
+
+    for (std::size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex) {
+      const auto posX = static_cast<float>(clusterIndex * 5);
+
+      Raz::Entity& holder = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(posX, 0.01f, 0.f));
+      holder.addComponent<Raz::RigidBody>(1.f, 0.f);
+      holder.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+      transforms.emplace_back(&holder.getComponent<Raz::Transform>(), posX);
+
+      Raz::Entity& particle = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(posX, 2.f, 0.f));
+      particle.addComponent<Raz::RigidBody>(1.f, 0.5f);
+      transforms.emplace_back(&particle.getComponent<Raz::Transform>(), posX);
+    }
+
+    world.refresh();
+
+    physics.step(0.02f);
+    CHECK(physics.getIslandCount() == clusterCount * 2); // The floor plane belonging to no rigid body, it never merges the rigid bodies' islands
+
+    std::size_t minIslandCount = clusterCount * 2;
+
+    for (int i = 0; i < 60; ++i) {
+      physics.step(0.02f);
+      minIslandCount = std::min(minIslandCount, physics.getIslandCount());
+    }
+
+    CHECK(minIslandCount == clusterCount); // When the particles hit the spheres, each cluster becomes a single island
+
+    // The positions are made relative to their cluster
+    std::vector<Raz::Vec3f> positions;
+
+    for (const auto& [transform, posX] : transforms)
+      positions.emplace_back(transform->getPosition() - Raz::Vec3f(posX, 0.f, 0.f));
+
+    return positions;
+  };
+
+  const std::vector<Raz::Vec3f> singleClusterPositions = simulateClusters(1);
+  const std::vector<Raz::Vec3f> clustersPositions      = simulateClusters(500); // Enough clusters are created for them to be solved in parallel
+
+  CHECK(singleClusterPositions[1].y() > 0.5f); // The particle has bounced on the sphere
+
+  // Each cluster being solved independently & in a fixed order, all of them end up exactly like a single one simulated alone
+  for (std::size_t positionIndex = 0; positionIndex < clustersPositions.size(); ++positionIndex)
+    CHECK(clustersPositions[positionIndex].strictlyEquals(singleClusterPositions[positionIndex % 2]));
+}
+
+TEST_CASE("PhysicsSystem sleeping rigid bodies") {
+  Raz::World world(4);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  // Rigid body lying on the floor & holding a sphere collider
+  Raz::Entity& holder   = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.01f, 0.f));
+  auto& holderRigidBody = holder.addComponent<Raz::RigidBody>(1.f, 0.f);
+  auto& holderTransform = holder.getComponent<Raz::Transform>();
+  holder.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+  world.refresh();
+
+  // The rigid body needs to be at rest for the whole sleep delay before falling asleep
+  for (int i = 0; i < 20; ++i)
+    physics.step(0.02f);
+
+  CHECK_FALSE(holderRigidBody.isSleeping());
+  CHECK(physics.getSleepingRigidBodyCount() == 0);
+
+  for (int i = 0; i < 10; ++i)
+    physics.step(0.02f);
+
+  CHECK(holderRigidBody.isSleeping());
+  CHECK(holderRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
+
+  // A sleeping rigid body is not simulated anymore
+  const Raz::Vec3f restingPos = holderTransform.getPosition();
+  holderTransform.setUpdated(false);
+
+  physics.step(0.02f);
+
+  CHECK(physics.getSleepingRigidBodyCount() == 1);
+  CHECK(holderTransform.getPosition().strictlyEquals(restingPos));
+  CHECK_FALSE(holderTransform.hasUpdated());
+
+  // Setting its velocity or its forces wakes it up
+  holderRigidBody.setVelocity(Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK_FALSE(holderRigidBody.isSleeping());
+
+  physics.step(0.02f);
+  CHECK(holderTransform.getPosition().y() > restingPos.y());
+
+  for (int i = 0; i < 60 && !holderRigidBody.isSleeping(); ++i)
+    physics.step(0.02f);
+
+  REQUIRE(holderRigidBody.isSleeping());
+
+  holderRigidBody.setForces(Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK_FALSE(holderRigidBody.isSleeping());
+  holderRigidBody.setForces(Raz::Vec3f(0.f));
+
+  for (int i = 0; i < 60 && !holderRigidBody.isSleeping(); ++i)
+    physics.step(0.02f);
+
+  REQUIRE(holderRigidBody.isSleeping());
+
+  // Another rigid body hitting its collider also wakes it up
+  Raz::Entity& particle   = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 2.f, 0.f));
+  auto& particleRigidBody = particle.addComponent<Raz::RigidBody>(1.f, 0.5f);
+  world.refresh();
+
+  for (int i = 0; i < 60 && holderRigidBody.isSleeping(); ++i)
+    physics.step(0.02f);
+
+  CHECK_FALSE(holderRigidBody.isSleeping());
+  CHECK_FALSE(particleRigidBody.isSleeping());
+  // The particle has bounced off the sphere, from its surface
+  CHECK(particle.getComponent<Raz::Transform>().getPosition().y() >= 0.5f);
+  CHECK(particleRigidBody.getVelocity().y() > 0.f);
+
+  // Rigid bodies never fall asleep with a sleep velocity of 0
+  physics.setSleepVelocity(0.f);
+
+  for (int i = 0; i < 100; ++i)
+    physics.step(0.02f);
+
+  CHECK_FALSE(holderRigidBody.isSleeping());
+  CHECK_FALSE(particleRigidBody.isSleeping());
+}
+
+TEST_CASE("PhysicsSystem sleeping rigid bodies support") {
+  Raz::World world(4);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  // Stack of boxes lying on the floor; rigid bodies being particles, each one is located at the bottom center of its box
+  std::vector<Raz::Entity*> boxes;
+
+  for (int i = 0; i < 3; ++i) {
+    Raz::Entity& box = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, static_cast<float>(i), 0.f));
+    box.addComponent<Raz::RigidBody>(1.f, 0.f);
+    box.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.5f, 0.f, -0.5f), Raz::Vec3f(0.5f, 1.f, 0.5f)));
+    boxes.emplace_back(&box);
+  }
+
+  world.refresh();
+
+  const auto waitForSleep = [&physics] (const std::vector<Raz::Entity*>& entities) {
+    const auto isSleeping = [] (const Raz::Entity* entity) { return entity->getComponent<Raz::RigidBody>().isSleeping(); };
+
+    for (int i = 0; i < 100 && !std::all_of(entities.cbegin(), entities.cend(), isSleeping); ++i)
+      physics.step(0.02f);
+
+    return std::all_of(entities.cbegin(), entities.cend(), isSleeping);
+  };
+
+  REQUIRE(waitForSleep(boxes));
+
+  // Moving the base out from under the stack wakes up the box resting on it, then the one above as the former falls
+  boxes[0]->getComponent<Raz::RigidBody>().setVelocity(Raz::Vec3f(0.f, 0.f, 20.f));
+
+  physics.step(0.02f);
+  CHECK_FALSE(boxes[1]->getComponent<Raz::RigidBody>().isSleeping());
+
+  for (int i = 0; i < 50; ++i)
+    physics.step(0.02f);
+
+  // The two other boxes are now stacked on the floor, instead of floating where they were
+  CHECK_THAT(boxes[1]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(0.f, 0.05f));
+  CHECK_THAT(boxes[2]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(1.f, 0.05f));
+
+  // The base sliding away, only the two others fall asleep again
+  REQUIRE(waitForSleep({ boxes[1], boxes[2] }));
+
+  // Removing the box the top one rests on wakes it up as well, even if another collider, far from it, is given the removed entity's ID
+  const std::size_t removedEntityId = boxes[1]->getId();
+  world.removeEntity(*boxes[1]);
+
+  Raz::Entity& replacingEntity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(100.f, 0.f, 0.f));
+  replacingEntity.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.5f, 0.f, -0.5f), Raz::Vec3f(0.5f, 1.f, 0.5f)));
+  REQUIRE(replacingEntity.getId() == removedEntityId);
+
+  world.refresh();
+
+  physics.step(0.02f);
+  CHECK_FALSE(boxes[2]->getComponent<Raz::RigidBody>().isSleeping());
+
+  for (int i = 0; i < 50; ++i)
+    physics.step(0.02f);
+
+  CHECK_THAT(boxes[2]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(0.f, 0.05f));
+}
+
+TEST_CASE("PhysicsSystem determinism") {
+  // Enough spheres are piled up for their islands to be solved in parallel
+  const auto simulate = [] () {
+    Raz::World world(301);
+
+    auto& physics = world.addSystem<Raz::PhysicsSystem>();
+    world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+    for (int layerIndex = 0; layerIndex < 6; ++layerIndex) {
+      // Each layer is slightly shifted, so that its spheres fall onto those of the layer below
+      const float layerOffset = static_cast<float>(layerIndex % 2) * 0.5f;
+
+      for (int sphereIndex = 0; sphereIndex < 50; ++sphereIndex) {
+        const Raz::Vec3f position(static_cast<float>(sphereIndex % 7) * 2.1f + layerOffset,
+                                  1.f + static_cast<float>(layerIndex) * 2.5f,
+                                  static_cast<float>(sphereIndex / 7) * 2.1f + layerOffset);
+
+        Raz::Entity& sphere = world.addEntityWithComponent<Raz::Transform>(position);
+        sphere.addComponent<Raz::RigidBody>(1.f, 0.5f);
+        sphere.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+      }
+    }
+
+    world.refresh();
+
+    for (int stepIndex = 0; stepIndex < 60; ++stepIndex)
+      physics.step(0.016666f);
+
+    return TestUtils::hashRigidBodyPositions(world);
+  };
+
+  const std::uint64_t referenceHash = simulate();
+
+  // Running the same simulation again gives the exact same positions
+  CHECK(simulate() == referenceHash);
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  // Simulating several worlds at once from different threads, the thread pool's threads are shared between them, thus processing different
+  //  islands than when simulated alone; the results must not depend on which thread processes which island
+  for (const std::size_t threadCount : { 2u, 4u }) {
+    std::vector<std::uint64_t> hashes(threadCount);
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+      threads.emplace_back([&simulate, &hashes, threadIndex] () { hashes[threadIndex] = simulate(); });
+
+    for (std::thread& thread : threads)
+      thread.join();
+
+    for (const std::uint64_t hash : hashes)
+      CHECK(hash == referenceHash);
+  }
+#endif
+}
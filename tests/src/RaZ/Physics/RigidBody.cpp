@@ -9,6 +9,8 @@ TEST_CASE("RigidBody basic") {
   CHECK(rigidBody.getBounciness() == 0.25f);
   CHECK(rigidBody.getForces() == Raz::Vec3f(0.f)); // No forces for now; gravity is computed when calculating the rigid body's acceleration
   CHECK(rigidBody.getVelocity() == Raz::Vec3f(0.f));
+  CHECK_FALSE(rigidBody.isSleeping());
+  CHECK_FALSE(rigidBody.isContinuousCollisionEnabled());
 
   rigidBody.setMass(10.1f);
   CHECK(rigidBody.getMass() == 10.1f);
@@ -30,4 +32,9 @@ TEST_CASE("RigidBody basic") {
 
   rigidBody.setVelocity(Raz::Vec3f(0.f, 1.12f, -3.f));
   CHECK(rigidBody.getVelocity() == Raz::Vec3f(0.f, 1.12f, -3.f));
+
+  rigidBody.enableContinuousCollision();
+  CHECK(rigidBody.isContinuousCollisionEnabled());
+  rigidBody.disableContinuousCollision();
+  CHECK_FALSE(rigidBody.isContinuousCollisionEnabled());
 }
@@ -48,6 +48,69 @@ TEST_CASE("RenderSystem accepted components") {
   CHECK(render.containsEntity(light));
 }
 
+TEST_CASE("RenderSystem upload queue") {
+  Raz::World world(2);
+
+  auto& render = world.addSystem<Raz::RenderSystem>(0, 0);
+  world.addEntityWithComponents<Raz::Camera, Raz::Transform>();
+
+  render.setUploadTimeBudget(0.f);
+  CHECK(render.getUploadTimeBudget() == 0.f);
+
+  int uploadCount = 0;
+  render.getUploadQueue().push([&uploadCount] () noexcept { ++uploadCount; });
+  render.getUploadQueue().push([&uploadCount] () noexcept { ++uploadCount; });
+
+  // Without any time budget, a single upload is executed per update
+  world.update(0.f);
+  CHECK(uploadCount == 1);
+
+  world.update(0.f);
+  CHECK(uploadCount == 2);
+  CHECK(render.getUploadQueue().isEmpty());
+}
+
+TEST_CASE("RenderSystem frame capture") {
+  Raz::World world(4);
+
+  auto& render = world.addSystem<Raz::RenderSystem>(0, 0);
+
+  Raz::Entity& camera = world.addEntityWithComponents<Raz::Camera, Raz::Transform>();
+  camera.getComponent<Raz::Transform>().setPosition(Raz::Vec3f(1.f, 2.f, 3.f));
+
+  Raz::Entity& mesh = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(4.f, 5.f, 6.f));
+  mesh.addComponent<Raz::MeshRenderer>();
+
+  Raz::Entity& light = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(7.f, 8.f, 9.f));
+  light.addComponent<Raz::Light>(Raz::LightType::POINT, 2.f, Raz::Vec3f(1.f, 0.f, 0.f));
+
+  world.refresh();
+  render.captureFrame();
+
+  const Raz::RenderPacket& renderPacket = render.getRenderPacket();
+  CHECK(renderPacket.cameraPosition == Raz::Vec3f(1.f, 2.f, 3.f));
+  CHECK(renderPacket.viewMatrix == camera.getComponent<Raz::Camera>().getViewMatrix());
+
+  REQUIRE(renderPacket.meshInstances.size() == 1);
+  CHECK(renderPacket.meshInstances.front().meshRenderer == &mesh.getComponent<Raz::MeshRenderer>());
+  CHECK(renderPacket.meshInstances.front().transformMatrix == mesh.getComponent<Raz::Transform>().computeTransformMatrix());
+
+  REQUIRE(renderPacket.lights.size() == 1);
+  CHECK(renderPacket.lights.front().position == Raz::Vec4f(7.f, 8.f, 9.f, 1.f));
+  CHECK(renderPacket.lights.front().color == Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK(renderPacket.lights.front().energy == 2.f);
+
+  // Moving the entities afterward does not modify the captured state
+  mesh.getComponent<Raz::MeshRenderer>().enable(false);
+  light.getComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f));
+  CHECK(renderPacket.meshInstances.size() == 1);
+  CHECK(renderPacket.lights.front().position == Raz::Vec4f(7.f, 8.f, 9.f, 1.f));
+
+  world.update(0.f);
+  CHECK(renderPacket.meshInstances.empty());
+  CHECK(renderPacket.lights.front().position == Raz::Vec4f(0.f, 0.f, 0.f, 1.f));
+}
+
 TEST_CASE("RenderSystem Cook-Torrance ball") {
   Raz::World world(7);
 
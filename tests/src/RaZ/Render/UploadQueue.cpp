@@ -0,0 +1,65 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/UploadQueue.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("UploadQueue execution") {
+  Raz::UploadQueue uploadQueue;
+  CHECK(uploadQueue.isEmpty());
+  CHECK(uploadQueue.execute(1.f) == 0);
+
+  std::vector<int> executionOrder;
+  std::future<int> firstResult = uploadQueue.push([&executionOrder] () { executionOrder.emplace_back(0); return 42; });
+  std::future<void> secondResult = uploadQueue.push([&executionOrder] () { executionOrder.emplace_back(1); });
+  std::future<void> thirdResult = uploadQueue.push([] () { throw std::runtime_error("Error: Upload failure"); });
+  CHECK(uploadQueue.getPendingUploadCount() == 3);
+
+  // With no time budget, a single upload is executed
+  CHECK(uploadQueue.execute(0.f) == 1);
+  CHECK(executionOrder == std::vector<int>({ 0 }));
+  CHECK(firstResult.get() == 42);
+
+  // The uploads are executed in the order they have been added
+  CHECK(uploadQueue.execute(1.f) == 2);
+  CHECK(executionOrder == std::vector<int>({ 0, 1 }));
+  CHECK(uploadQueue.isEmpty());
+  CHECK_NOTHROW(secondResult.get());
+  CHECK_THROWS_AS(thirdResult.get(), std::runtime_error);
+
+  // Cleared uploads are never executed, their futures being given an error instead
+  std::future<void> clearedResult = uploadQueue.push([&executionOrder] () { executionOrder.emplace_back(2); });
+  uploadQueue.clear();
+  CHECK(uploadQueue.executeAll() == 0);
+  CHECK(executionOrder.size() == 2);
+  CHECK_THROWS_AS(clearedResult.get(), std::future_error);
+}
+
+#if defined(RAZ_THREADS_AVAILABLE)
+TEST_CASE("UploadQueue asynchronous loading") {
+  Raz::UploadQueue uploadQueue;
+
+  // Data loaded on the I/O threads adds the uploads to be executed by the main thread
+  std::vector<std::future<std::future<std::thread::id>>> loadings;
+
+  for (int i = 0; i < 8; ++i) {
+    loadings.emplace_back(Raz::Threading::launchIoAsync([&uploadQueue] () {
+      Raz::Threading::sleep(1); // Simulating a file being read
+      return uploadQueue.push([] () noexcept { return std::this_thread::get_id(); });
+    }));
+  }
+
+  std::vector<std::future<std::thread::id>> uploads;
+
+  for (std::future<std::future<std::thread::id>>& loading : loadings)
+    uploads.emplace_back(loading.get());
+
+  CHECK(uploadQueue.executeAll() == 8);
+
+  for (std::future<std::thread::id>& upload : uploads)
+    CHECK(upload.get() == std::this_thread::get_id());
+}
+#endif
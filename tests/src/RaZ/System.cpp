@@ -9,8 +9,8 @@ class TestSystem : public Raz::System {
 public:
   TestSystem() { registerComponents<Raz::Transform>(); } // [ 0 1 ]
 
-  void linkEntity(const Raz::EntityPtr& entity) override { System::linkEntity(entity); }
-  void unlinkEntity(const Raz::EntityPtr& entity) override { System::unlinkEntity(entity); }
+  void linkEntity(Raz::Entity& entity) override { System::linkEntity(entity); }
+  void unlinkEntity(Raz::Entity& entity) override { System::unlinkEntity(entity); }
 
   bool update(float /* deltaTime */) override { return true; }
 };
@@ -24,7 +24,7 @@ TEST_CASE("System basic") {
   // If the system is supposed to contain the entity, link it
   // This operation is normally made into a World
   if (!(mesh->getEnabledComponents() & testSystem.getAcceptedComponents()).isEmpty())
-    testSystem.linkEntity(mesh);
+    testSystem.linkEntity(*mesh);
 
   CHECK_FALSE(testSystem.containsEntity(*mesh));
 
@@ -32,7 +32,7 @@ TEST_CASE("System basic") {
   transform->addComponent<Raz::Transform>();
 
   if (!(transform->getEnabledComponents() & testSystem.getAcceptedComponents()).isEmpty())
-    testSystem.linkEntity(transform);
+    testSystem.linkEntity(*transform);
 
   CHECK(testSystem.containsEntity(*transform));
 
@@ -41,7 +41,7 @@ TEST_CASE("System basic") {
 
   // Unlink the entity if none of the components match
   if ((transform->getEnabledComponents() & testSystem.getAcceptedComponents()).isEmpty())
-    testSystem.unlinkEntity(transform);
+    testSystem.unlinkEntity(*transform);
 
   CHECK_FALSE(testSystem.containsEntity(*transform));
 
@@ -50,7 +50,81 @@ TEST_CASE("System basic") {
 
   // The entity will not be linked since there's no component to be matched
   if (!(emptyEntity->getEnabledComponents() & testSystem.getAcceptedComponents()).isEmpty())
-    testSystem.linkEntity(emptyEntity);
+    testSystem.linkEntity(*emptyEntity);
 
   CHECK_FALSE(testSystem.containsEntity(*emptyEntity));
 }
+
+TEST_CASE("System entities linking") {
+  TestSystem testSystem {};
+
+  const Raz::EntityPtr entity0 = Raz::Entity::create(0);
+  const Raz::EntityPtr entity1 = Raz::Entity::create(1);
+  const Raz::EntityPtr entity2 = Raz::Entity::create(2);
+
+  testSystem.linkEntity(*entity0);
+  testSystem.linkEntity(*entity1);
+  testSystem.linkEntity(*entity2);
+  testSystem.linkEntity(*entity1); // Linking an already linked entity does nothing
+
+  CHECK(testSystem.containsEntity(*entity0));
+  CHECK(testSystem.containsEntity(*entity1));
+  CHECK(testSystem.containsEntity(*entity2));
+
+  // Unlinking an entity doesn't affect the others
+  testSystem.unlinkEntity(*entity0);
+
+  CHECK_FALSE(testSystem.containsEntity(*entity0));
+  CHECK(testSystem.containsEntity(*entity1));
+  CHECK(testSystem.containsEntity(*entity2));
+
+  testSystem.unlinkEntity(*entity0); // Unlinking a non-linked entity does nothing
+  testSystem.unlinkEntity(*entity2);
+
+  CHECK(testSystem.containsEntity(*entity1));
+  CHECK_FALSE(testSystem.containsEntity(*entity2));
+
+  testSystem.unlinkEntity(*entity1);
+  CHECK_FALSE(testSystem.containsEntity(*entity1));
+}
+
+TEST_CASE("System conflicts") {
+  struct TestComp1 : public Raz::Component {};
+  struct TestComp2 : public Raz::Component {};
+
+  class AccessSystem : public Raz::System {
+  public:
+    void readComp1() { registerReadComponents<TestComp1>(); }
+    void readComp2() { registerReadComponents<TestComp2>(); }
+    void writeComp1() { registerWrittenComponents<TestComp1>(); }
+  };
+
+  AccessSystem undeclaredSystem;
+  AccessSystem comp1Reader;
+  AccessSystem otherComp1Reader;
+  AccessSystem comp1Writer;
+  AccessSystem comp2Reader;
+
+  comp1Reader.readComp1();
+  otherComp1Reader.readComp1();
+  comp1Writer.writeComp1();
+  comp2Reader.readComp2();
+
+  CHECK_FALSE(undeclaredSystem.hasDeclaredAccesses());
+  CHECK(comp1Reader.hasDeclaredAccesses());
+  CHECK(comp1Writer.hasDeclaredAccesses());
+
+  // A system which has not declared its accesses conflicts with any other
+  CHECK(undeclaredSystem.conflictsWith(comp1Reader));
+  CHECK(comp2Reader.conflictsWith(undeclaredSystem));
+
+  // Reading the same components concurrently is safe
+  CHECK_FALSE(comp1Reader.conflictsWith(otherComp1Reader));
+
+  // Writing a component conflicts with any other access to it, but not with accesses to other components
+  CHECK(comp1Writer.conflictsWith(comp1Reader));
+  CHECK(comp1Reader.conflictsWith(comp1Writer));
+  CHECK(comp1Writer.conflictsWith(comp1Writer));
+  CHECK_FALSE(comp1Writer.conflictsWith(comp2Reader));
+  CHECK_FALSE(comp2Reader.conflictsWith(comp1Writer));
+}
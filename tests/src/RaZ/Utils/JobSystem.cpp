@@ -0,0 +1,151 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/JobSystem.hpp"
+
+#include <stdexcept>
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+TEST_CASE("JobSystem basic") {
+  Raz::JobSystem jobSystem;
+
+  const Raz::JobHandle invalidJob;
+  CHECK_FALSE(invalidJob.isValid());
+  CHECK(invalidJob.isFinished());
+  CHECK_NOTHROW(jobSystem.wait(invalidJob)); // Waiting for an invalid job returns immediately
+
+  std::atomic<int> value = 0;
+  const Raz::JobHandle job = jobSystem.addJob([&value] () noexcept { ++value; });
+  CHECK(job.isValid());
+
+  jobSystem.wait(job);
+  CHECK(job.isFinished());
+  CHECK(value == 1);
+
+  // A job depending on one already finished is executed right away
+  const Raz::JobHandle continuation = jobSystem.addContinuation(job, [&value] () noexcept { ++value; });
+  jobSystem.wait(continuation);
+  CHECK(value == 2);
+
+  CHECK_FALSE(Raz::JobSystem::getCurrentJob().isValid());
+}
+
+TEST_CASE("JobSystem dependencies") {
+  Raz::JobSystem jobSystem;
+
+  // Jobs forming a frame-like graph, each recording the order in which it has been executed:
+  // culling -> skinning ----------------> draw list
+  //         -> physics -> BVH refit ---^
+  std::atomic<int> executionIndex = 0;
+  int cullingIndex  = -1;
+  int skinningIndex = -1;
+  int physicsIndex  = -1;
+  int bvhRefitIndex = -1;
+  int drawListIndex = -1;
+
+  const Raz::JobHandle culling  = jobSystem.addJob([&] () { Raz::Threading::sleep(5); cullingIndex = executionIndex++; });
+  const Raz::JobHandle skinning = jobSystem.addJob([&] () { skinningIndex = executionIndex++; }, { culling });
+  const Raz::JobHandle physics  = jobSystem.addJob([&] () { Raz::Threading::sleep(5); physicsIndex = executionIndex++; }, { culling });
+  const Raz::JobHandle bvhRefit = jobSystem.addContinuation(physics, [&] () { bvhRefitIndex = executionIndex++; });
+  const Raz::JobHandle drawList = jobSystem.addJob([&] () { drawListIndex = executionIndex++; }, std::vector<Raz::JobHandle>{ skinning, bvhRefit });
+
+  jobSystem.wait(drawList);
+
+  CHECK(culling.isFinished());
+  CHECK(skinning.isFinished());
+  CHECK(physics.isFinished());
+  CHECK(bvhRefit.isFinished());
+
+  CHECK(cullingIndex == 0);
+  CHECK(skinningIndex > cullingIndex);
+  CHECK(physicsIndex > cullingIndex);
+  CHECK(bvhRefitIndex > physicsIndex);
+  CHECK(drawListIndex == 4);
+}
+
+TEST_CASE("JobSystem children") {
+  Raz::JobSystem jobSystem;
+
+  constexpr int childCount = 100;
+  std::atomic<int> finishedChildCount = 0;
+  int finishedChildCountAtContinuation = 0;
+  bool isCurrentJobValid = false;
+
+  const Raz::JobHandle parent = jobSystem.addJob([&] () {
+    const Raz::JobHandle currentJob = Raz::JobSystem::getCurrentJob();
+    isCurrentJobValid = currentJob.isValid();
+
+    for (int i = 0; i < childCount; ++i) {
+      jobSystem.addChildJob(currentJob, [&finishedChildCount] () {
+        Raz::Threading::sleep(1);
+        ++finishedChildCount;
+      });
+    }
+  });
+
+  // The parent is considered finished only once all its children are, which is what the continuation waits for
+  const Raz::JobHandle continuation = jobSystem.addContinuation(parent, [&] () { finishedChildCountAtContinuation = finishedChildCount; });
+
+  jobSystem.wait({ parent, continuation });
+  CHECK(isCurrentJobValid);
+  CHECK(finishedChildCount == childCount);
+  CHECK(finishedChildCountAtContinuation == childCount);
+}
+
+TEST_CASE("JobSystem nested waiting") {
+  // With a single thread, a job waiting for another must execute it itself for the program not to be stuck
+  Raz::ThreadPool threadPool(1);
+  Raz::JobSystem jobSystem(threadPool);
+
+  std::atomic<int> value = 0;
+
+  const Raz::JobHandle job = jobSystem.addJob([&] () {
+    const Raz::JobHandle innerJob = jobSystem.addJob([&value] () noexcept { ++value; });
+    jobSystem.wait(innerJob);
+
+    ++value;
+  });
+
+  jobSystem.wait(job);
+  CHECK(value == 2);
+}
+
+TEST_CASE("JobSystem exceptions") {
+  Raz::JobSystem jobSystem;
+  bool isContinuationExecuted = false;
+
+  const Raz::JobHandle parent = jobSystem.addJob([&jobSystem] () {
+    jobSystem.addChildJob(Raz::JobSystem::getCurrentJob(), [] () { throw std::runtime_error("Error: Child job failure"); });
+  });
+  const Raz::JobHandle continuation = jobSystem.addContinuation(parent, [&isContinuationExecuted] () noexcept { isContinuationExecuted = true; });
+
+  // The exception thrown by the child is rethrown when waiting for its parent, while the jobs depending on it are still executed
+  CHECK_THROWS_AS(jobSystem.wait(parent), std::runtime_error);
+  CHECK_NOTHROW(jobSystem.wait(continuation));
+  CHECK(isContinuationExecuted);
+}
+
+TEST_CASE("JobSystem destruction") {
+  std::atomic<int> value = 0;
+
+  {
+    Raz::JobSystem jobSystem;
+
+    const Raz::JobHandle job = jobSystem.addJob([&jobSystem, &value] () {
+      for (int i = 0; i < 10; ++i)
+        jobSystem.addChildJob(Raz::JobSystem::getCurrentJob(), [&value] () noexcept { ++value; });
+    });
+
+    for (int i = 0; i < 10; ++i) {
+      jobSystem.addContinuation(job, [&jobSystem, &value] () {
+        jobSystem.addJob([&value] () noexcept { ++value; });
+        ++value;
+      });
+    }
+  }
+
+  // The job system waits for all its jobs to be finished before being destroyed, including those added by the continuations
+  CHECK(value == 30);
+}
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -73,6 +73,57 @@ TEST_CASE("Ray-point intersection") {
   CHECK_FALSE(ray3.intersects(topRightPoint));
 }
 
+TEST_CASE("Ray-line intersection") {
+  //     line1                  line2         line3
+  //   [ -1; 2 ] - [ 1; 2 ]   [ 0; 3 ]-[ 0; 5 ]   [ -10; -10 ]-[ 6; 6 ]
+  //
+  //        ^
+  //        |
+  //        x < [ 0; 0 ]
+  const Raz::Line line1(Raz::Vec3f(-1.f, 2.f, 0.f), Raz::Vec3f(1.f, 2.f, 0.f));
+  const Raz::Line line2(Raz::Vec3f(0.f, 3.f, 0.f), Raz::Vec3f(0.f, 5.f, 0.f)); // Aligned with ray1
+  const Raz::Line line3(Raz::Vec3f(-10.f, -10.f, 0.f), Raz::Vec3f(6.f, 6.f, 0.f)); // Containing all rays' origins
+  const Raz::Line line4(Raz::Vec3f(0.f, 1.f, -1.f), Raz::Vec3f(0.f, 1.f, 1.f)); // Crossing ray1 along Z
+  const Raz::Line line5(Raz::Vec3f(0.5f, 1.f, -1.f), Raz::Vec3f(0.5f, 1.f, 1.f)); // Passing beside ray1 along Z
+
+  Raz::RayHit hit;
+
+  CHECK(ray1.intersects(line1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 2.f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::Y);
+  CHECK(hit.distance == 2.f);
+
+  CHECK_FALSE(ray2.intersects(line1)); // The line ends before reaching ray2
+  CHECK_FALSE(ray3.intersects(line1));
+
+  CHECK(ray1.intersects(line2, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 3.f, 0.f)); // The line's closest extremity is hit first
+  CHECK(hit.distance == 3.f);
+
+  CHECK(ray1.intersects(line3, &hit)); // The line crosses ray1's origin
+  CHECK(hit.position == ray1.getOrigin());
+  CHECK(hit.distance == 0.f);
+
+  CHECK(ray2.intersects(line3, &hit));
+  CHECK(hit.position == ray2.getOrigin());
+  CHECK(hit.distance == 0.f);
+
+  CHECK(ray3.intersects(line3, &hit));
+  CHECK(hit.position == ray3.getOrigin());
+  CHECK(hit.distance == 0.f);
+
+  CHECK(ray1.intersects(line4, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK(hit.distance == 1.f);
+
+  CHECK_FALSE(ray1.intersects(line5));
+  CHECK_FALSE(ray3.intersects(line4)); // The line is behind ray3
+
+  // The check can be made from the shape as well
+  CHECK(line4.intersects(ray1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 1.f, 0.f));
+}
+
 TEST_CASE("Ray-plane intersection") {
   //       Plane 1      |      Plane 2      |      Plane 3      |      Plane 4
   //                    |                   |                   |
@@ -204,6 +255,41 @@ TEST_CASE("Ray-triangle intersection") {
   CHECK_THAT(hit.distance, IsNearlyEqualTo(3.5355341f));
 }
 
+TEST_CASE("Ray-quad intersection") {
+  // quad1 is laying flat slightly above 0, centered on the origin; quad2 is laying at the same height, but only along [ 0.6; 1 ] on X
+  const Raz::Quad quad1(Raz::Vec3f(-1.f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, 1.f), Raz::Vec3f(-1.f, 0.5f, 1.f));
+  const Raz::Quad quad2(Raz::Vec3f(0.6f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, -1.f), Raz::Vec3f(1.f, 0.5f, 1.f), Raz::Vec3f(0.6f, 0.5f, 1.f));
+
+  Raz::RayHit hit;
+
+  CHECK(ray1.intersects(quad1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.5f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::Y);
+  CHECK(hit.distance == 0.5f);
+
+  CHECK(ray2.intersects(quad1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.5f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::Y);
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(2.1213205f));
+
+  CHECK(ray3.intersects(quad1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.5f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(0.7071068f));
+
+  // The rays reach quad2's plane outside of its edges
+  CHECK_FALSE(ray1.intersects(quad2));
+  CHECK_FALSE(ray2.intersects(quad2));
+  CHECK_FALSE(ray3.intersects(quad2));
+
+  // A ray parallel to the quad never intersects it
+  CHECK_FALSE(Raz::Ray(Raz::Vec3f(-2.f, 0.5f, 0.f), Raz::Axis::X).intersects(quad1));
+
+  // The check can be made from the shape as well
+  CHECK(quad1.intersects(ray1, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.5f, 0.f));
+}
+
 TEST_CASE("Ray-AABB intersection") {
   //         _______________________
   //        /|                    /|
@@ -275,6 +361,38 @@ TEST_CASE("Ray-AABB intersection") {
   //CHECK(hit.distance == 0.f);
 }
 
+TEST_CASE("Ray-OBB intersection") {
+  // Rotated by 90 degrees around the Z axis, the box's X & Y extents are swapped around its centroid, giving [ 0.5; -0.5; 0 ] & [ 1.5; 1.5; 1 ]
+  const Raz::OBB obb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                            1.f,  0.f, 0.f,
+                                                                            0.f,  0.f, 1.f));
+
+  Raz::RayHit hit;
+
+  const Raz::Ray bottomRay(Raz::Vec3f(1.f, -5.f, 0.5f), Raz::Axis::Y);
+  CHECK(bottomRay.intersects(obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(1.f, -0.5f, 0.5f)));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-Raz::Axis::Y));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(4.5f));
+
+  const Raz::Ray rightRay(Raz::Vec3f(3.f, 1.f, 0.5f), -Raz::Axis::X);
+  CHECK(rightRay.intersects(obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(1.5f, 1.f, 0.5f)));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::X));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(1.5f));
+
+  // This ray would hit the box if it was not rotated
+  const Raz::Ray leftRay(Raz::Vec3f(0.2f, -5.f, 0.5f), Raz::Axis::Y);
+  CHECK_FALSE(leftRay.intersects(obb));
+  CHECK(leftRay.intersects(Raz::AABB(obb.getMinPosition(), obb.getMaxPosition())));
+
+  CHECK_FALSE(ray1.intersects(obb));
+
+  // The check can be made from the shape as well
+  CHECK(obb.intersects(bottomRay, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(1.f, -0.5f, 0.5f)));
+}
+
 TEST_CASE("Point projection") {
   const Raz::Vec3f topPoint(0.f, 2.f, 0.f);
   const Raz::Vec3f topRightPoint(2.f, 2.f, 0.f);
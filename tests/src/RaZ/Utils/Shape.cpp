@@ -413,6 +413,34 @@ TEST_CASE("Triangle translation") {
   CHECK(triangle1Copy.getThirdPos() == triangle1.getThirdPos());
 }
 
+TEST_CASE("Triangle point projection") {
+  CHECK(triangle1.computeProjection(triangle1.computeCentroid()) == triangle1.computeCentroid());
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 5.f, 0.f)) == Raz::Vec3f(0.f, 0.5f, 0.f)); // Above the face
+  CHECK(triangle1.computeProjection(Raz::Vec3f(-5.f, 0.f, 5.f)) == triangle1.getFirstPos()); // Closest to a vertex
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 1.f, 10.f)) == Raz::Vec3f(0.f, 0.5f, 3.f)); // Closest to an edge
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 0.f, -10.f)) == triangle1.getThirdPos());
+
+  CHECK(triangle2.computeProjection(Raz::Vec3f(-2.f, 0.f, 0.f)) == Raz::Vec3f(0.5f, 0.f, 0.f));
+  CHECK(triangle2.computeProjection(Raz::Vec3f(0.5f, -3.f, 0.f)) == Raz::Vec3f(0.5f, -0.5f, 0.f));
+
+  CHECK(triangle1.contains(triangle1.computeCentroid()));
+  CHECK_FALSE(triangle1.contains(Raz::Vec3f(0.f)));
+}
+
+TEST_CASE("Quad point projection") {
+  const Raz::Quad quad(Raz::Vec3f(-1.f, 0.f, -1.f), Raz::Vec3f(1.f, 0.f, -1.f), Raz::Vec3f(1.f, 0.f, 1.f), Raz::Vec3f(-1.f, 0.f, 1.f));
+
+  CHECK(quad.computeProjection(Raz::Vec3f(0.5f, 2.f, -0.5f)) == Raz::Vec3f(0.5f, 0.f, -0.5f));
+  CHECK(quad.computeProjection(Raz::Vec3f(-0.5f, -2.f, 0.5f)) == Raz::Vec3f(-0.5f, 0.f, 0.5f));
+  CHECK(quad.computeProjection(Raz::Vec3f(3.f, 1.f, 3.f)) == quad.getRightBottomPos());
+  CHECK(quad.computeProjection(Raz::Vec3f(-3.f, 0.f, 0.f)) == Raz::Vec3f(-1.f, 0.f, 0.f));
+
+  CHECK(quad.contains(quad.computeCentroid()));
+  CHECK(quad.contains(quad.getLeftTopPos()));
+  CHECK_FALSE(quad.contains(Raz::Vec3f(0.f, 0.1f, 0.f)));
+  CHECK_FALSE(quad.contains(Raz::Vec3f(1.5f, 0.f, 0.f)));
+}
+
 TEST_CASE("Triangle bounding box") {
   CHECK(triangle1.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-3.f, 0.5f, -6.f), Raz::Vec3f(3.f, 0.5f, 3.f)));
   CHECK(triangle2.computeBoundingBox() == Raz::AABB(Raz::Vec3f(0.5f, -0.5f, -3.f), Raz::Vec3f(0.5f, 3.f, 3.f)));
@@ -549,6 +577,139 @@ TEST_CASE("AABB bounding box") {
   CHECK(aabb3.computeBoundingBox() == aabb3);
 }
 
+TEST_CASE("OBB bounding box") {
+  const Raz::OBB unrotatedObb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f));
+  CHECK(unrotatedObb.computeBoundingBox() == Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f)));
+
+  // Rotated by 90 degrees around the Z axis, the box's X & Y extents are swapped around its centroid
+  const Raz::OBB rotatedObb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                                   1.f,  0.f, 0.f,
+                                                                                   0.f,  0.f, 1.f));
+  CHECK(rotatedObb.computeBoundingBox() == Raz::AABB(Raz::Vec3f(0.5f, -0.5f, 0.f), Raz::Vec3f(1.5f, 1.5f, 1.f)));
+}
+
+TEST_CASE("OBB point containment") {
+  // Rotated by 90 degrees around the Z axis, the box's X & Y extents are swapped around its centroid, giving [ 0.5; -0.5; 0 ] & [ 1.5; 1.5; 1 ]
+  const Raz::OBB rotatedObb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                                   1.f,  0.f, 0.f,
+                                                                                   0.f,  0.f, 1.f));
+
+  CHECK(rotatedObb.contains(rotatedObb.computeCentroid()));
+  CHECK(rotatedObb.contains(Raz::Vec3f(1.f, 1.4f, 0.5f)));
+  CHECK(rotatedObb.contains(Raz::Vec3f(1.5f, 1.5f, 1.f))); // Corner
+  CHECK_FALSE(rotatedObb.contains(Raz::Vec3f(1.8f, 0.5f, 0.5f))); // Would be contained if the box was not rotated
+  CHECK_FALSE(rotatedObb.contains(Raz::Vec3f(1.f, 1.f, 1.1f)));
+}
+
+TEST_CASE("OBB point projection") {
+  const Raz::OBB rotatedObb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                                   1.f,  0.f, 0.f,
+                                                                                   0.f,  0.f, 1.f));
+
+  CHECK(rotatedObb.computeProjection(Raz::Vec3f(1.f, 1.f, 0.5f)) == Raz::Vec3f(1.f, 1.f, 0.5f)); // Already inside the box
+  CHECK(rotatedObb.computeProjection(Raz::Vec3f(1.f, 3.f, 0.5f)) == Raz::Vec3f(1.f, 1.5f, 0.5f));
+  CHECK(rotatedObb.computeProjection(Raz::Vec3f(3.f, 0.5f, 0.5f)) == Raz::Vec3f(1.5f, 0.5f, 0.5f));
+  CHECK(rotatedObb.computeProjection(Raz::Vec3f(5.f)) == Raz::Vec3f(1.5f, 1.5f, 1.f));
+  CHECK(rotatedObb.computeProjection(Raz::Vec3f(-5.f)) == Raz::Vec3f(0.5f, -0.5f, 0.f));
+}
+
+TEST_CASE("Shape support points") {
+  CHECK(line1.computeSupport(Raz::Axis::X) == line1.getEndPos());
+  CHECK(line1.computeSupport(-Raz::Axis::X) == line1.getBeginPos());
+  CHECK_THROWS(plane1.computeSupport(Raz::Axis::Y)); // A plane being infinite, it has no support point
+  CHECK(sphere1.computeSupport(Raz::Vec3f(0.f, 2.f, 0.f)) == Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK(sphere2.computeSupport(Raz::Vec3f(0.f)) == sphere2.getCenter());
+  CHECK(triangle1.computeSupport(-Raz::Axis::Z) == triangle1.getThirdPos());
+  CHECK(aabb2.computeSupport(Raz::Vec3f(-1.f, 1.f, -1.f)) == Raz::Vec3f(2.f, 5.f, -5.f));
+
+  // Rotated by 90 degrees around the Z axis, the box's farthest corner along X is the one which was the farthest along Y
+  const Raz::OBB rotatedObb(Raz::Vec3f(0.f), Raz::Vec3f(2.f, 1.f, 1.f), Raz::Mat3f(0.f, -1.f, 0.f,
+                                                                                   1.f,  0.f, 0.f,
+                                                                                   0.f,  0.f, 1.f));
+  CHECK(rotatedObb.computeSupport(Raz::Vec3f(1.f, 1.f, 1.f)) == Raz::Vec3f(1.5f, 1.5f, 1.f));
+  CHECK(rotatedObb.computeSupport(Raz::Vec3f(-1.f, -1.f, -1.f)) == Raz::Vec3f(0.5f, -0.5f, 0.f));
+}
+
+TEST_CASE("Convex shapes intersection") {
+  CHECK(line1.intersects(line2)); // Both lines start from the same point
+  CHECK_FALSE(line1.intersects(line3));
+  CHECK(line3.intersects(line4));
+  CHECK(line4.intersects(triangle1)); // The line crosses the triangle's plane at (0.5, 0.5, 0), inside the triangle
+
+  CHECK(triangle1.intersects(triangle2)); // The standing triangle crosses the flat one
+  CHECK_FALSE(triangle1.intersects(triangle3));
+  CHECK_FALSE(triangle2.intersects(triangle3));
+  CHECK(triangle2.intersects(aabb1));
+  CHECK_FALSE(triangle1.intersects(aabb3));
+
+  CHECK(plane1.intersects(triangle2));
+  CHECK_FALSE(plane1.intersects(triangle3));
+
+  // A box right next to another one only touches it when rotated, its corners then extending farther
+  const Raz::OBB obb(Raz::Vec3f(0.6f, -0.5f, -0.5f), Raz::Vec3f(1.6f, 0.5f, 0.5f));
+  CHECK_FALSE(aabb1.intersects(obb));
+
+  const Raz::OBB rotatedObb(Raz::Vec3f(0.6f, -0.5f, -0.5f), Raz::Vec3f(1.6f, 0.5f, 0.5f), Raz::Mat3f(0.70710677f, -0.70710677f, 0.f,
+                                                                                                     0.70710677f,  0.70710677f, 0.f,
+                                                                                                     0.f,          0.f,         1.f));
+  CHECK(aabb1.intersects(rotatedObb));
+  CHECK(obb.intersects(rotatedObb));
+  CHECK(sphere1.intersects(rotatedObb));
+  CHECK_FALSE(sphere3.intersects(rotatedObb));
+}
+
+TEST_CASE("Convex shapes contact") {
+  Raz::ShapeContact contact;
+
+  // Separated shapes give their distance & closest points
+  CHECK_FALSE(sphere1.computeContact(Raz::Sphere(Raz::Vec3f(3.f, 0.f, 0.f), 1.f), contact));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(1.f, 0.001f));
+  CHECK_THAT(contact.normal, IsNearlyEqualToVector(-Raz::Axis::X, 0.001f)); // Pointing from the second shape towards the first
+  CHECK_THAT(contact.firstPoint, IsNearlyEqualToVector(Raz::Vec3f(1.f, 0.f, 0.f), 0.001f));
+  CHECK_THAT(contact.secondPoint, IsNearlyEqualToVector(Raz::Vec3f(2.f, 0.f, 0.f), 0.001f));
+
+  const Raz::OBB rotatedObb(Raz::Vec3f(1.5f, -0.5f, -0.5f), Raz::Vec3f(2.5f, 0.5f, 0.5f), Raz::Mat3f(0.70710677f, -0.70710677f, 0.f,
+                                                                                                     0.70710677f,  0.70710677f, 0.f,
+                                                                                                     0.f,          0.f,         1.f));
+  CHECK_FALSE(aabb1.computeContact(rotatedObb, contact));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(2.f - 0.70710677f - 0.5f, 0.001f));
+  CHECK_THAT(contact.normal, IsNearlyEqualToVector(-Raz::Axis::X, 0.001f));
+  CHECK_THAT(contact.firstPoint.x(), IsNearlyEqualTo(0.5f, 0.001f));
+  CHECK_THAT(contact.secondPoint, IsNearlyEqualToVector(Raz::Vec3f(2.f - 0.70710677f, 0.f, contact.secondPoint.z()), 0.001f));
+
+  // Penetrating shapes give their penetration depth, as a negative separation, & their deepest points
+  CHECK(aabb1.computeContact(Raz::AABB(Raz::Vec3f(0.3f, -0.5f, -0.5f), Raz::Vec3f(1.3f, 0.5f, 0.5f)), contact));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(-0.2f, 0.001f));
+  CHECK_THAT(contact.normal, IsNearlyEqualToVector(-Raz::Axis::X, 0.001f));
+  CHECK_THAT(contact.firstPoint.x(), IsNearlyEqualTo(0.5f, 0.001f));
+  CHECK_THAT(contact.secondPoint.x(), IsNearlyEqualTo(0.3f, 0.001f));
+
+  // The box is pushed downward, out of the triangle crossing its upper part
+  const Raz::Triangle triangle(Raz::Vec3f(-3.f, 0.4f, 3.f), Raz::Vec3f(3.f, 0.4f, 3.f), Raz::Vec3f(0.f, 0.4f, -6.f));
+  CHECK(aabb1.computeContact(triangle, contact));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(-0.1f, 0.001f));
+  CHECK_THAT(contact.normal, IsNearlyEqualToVector(-Raz::Axis::Y, 0.001f));
+
+  CHECK(sphere1.computeContact(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 1.f), contact));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(-0.5f, 0.01f));
+  CHECK_THAT(contact.normal, IsNearlyEqualToVector(-Raz::Axis::Y, 0.01f));
+
+  // Deep & nearly concentric spheres, whose penetration is almost the same in every direction, keep the EPA from converging; the
+  //  penetration along the found direction is then given, which can only overestimate the actual one, by at most twice the centers' distance
+  const Raz::Vec3f centersOffset(0.003f, 0.01f, 0.002f);
+  CHECK(sphere1.computeContact(Raz::Sphere(centersOffset, 1.f), contact));
+  CHECK(contact.separation <= centersOffset.computeLength() - 2.f);
+  CHECK(contact.separation >= -centersOffset.computeLength() - 2.f);
+  CHECK_THAT(contact.normal.computeLength(), IsNearlyEqualTo(1.f, 0.001f));
+  CHECK_THAT(contact.separation, IsNearlyEqualTo(contact.normal.dot(contact.firstPoint - contact.secondPoint), 0.001f));
+
+  // Overlapping coplanar triangles can be separated along their normal without moving; they are only touching
+  const Raz::Triangle coplanarTriangle(Raz::Vec3f(-1.f, 0.5f, 1.f), Raz::Vec3f(1.f, 0.5f, 1.f), Raz::Vec3f(0.f, 0.5f, -1.f));
+  CHECK(triangle1.computeContact(coplanarTriangle, contact));
+  CHECK(contact.separation == 0.f);
+  CHECK_THAT(std::abs(contact.normal.y()), IsNearlyEqualTo(1.f, 0.001f));
+}
+
 TEST_CASE("AABB equality") {
   CHECK(aabb1 == aabb1);
   CHECK(aabb2 == aabb2);
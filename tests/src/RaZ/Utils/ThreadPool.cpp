@@ -3,6 +3,8 @@
 #include "RaZ/Utils/Threading.hpp"
 #include "RaZ/Utils/ThreadPool.hpp"
 
+#include <array>
+
 #ifdef RAZ_THREADS_AVAILABLE
 
 TEST_CASE("ThreadPool basic") {
@@ -17,4 +19,75 @@ TEST_CASE("ThreadPool basic") {
   CHECK(i == 3);
 }
 
+TEST_CASE("ThreadPool action") {
+  Raz::ThreadPool::Action emptyAction;
+  CHECK(emptyAction.isEmpty());
+
+  int value = 0;
+
+  // A small callable is stored inline, while a larger one is allocated; both must behave the same
+  Raz::ThreadPool::Action smallAction([&value] () { ++value; });
+  std::array<int, 64> largeCapture {};
+  largeCapture.back() = 2;
+  Raz::ThreadPool::Action largeAction([&value, largeCapture] () { value += largeCapture.back(); });
+
+  CHECK_FALSE(smallAction.isEmpty());
+  CHECK_FALSE(largeAction.isEmpty());
+
+  smallAction();
+  largeAction();
+  CHECK(value == 3);
+
+  Raz::ThreadPool::Action movedAction = std::move(largeAction);
+  CHECK(largeAction.isEmpty()); // NOLINT(bugprone-use-after-move)
+  movedAction();
+  CHECK(value == 5);
+
+  movedAction = std::move(smallAction);
+  movedAction();
+  CHECK(value == 6);
+}
+
+TEST_CASE("ThreadPool nested actions") {
+  Raz::ThreadPool pool(4);
+  CHECK(pool.getThreadCount() == 4);
+
+  constexpr int actionCount = 16;
+  constexpr int nestedActionCount = 2048; // Twice as many as a worker's deque can hold
+  std::atomic<int> executedCount = 0;
+
+  // The actions added from a worker are pushed into its own deque, from which the other workers can steal
+  // More actions than a deque can hold are added by each worker, which must then be executed right away
+  for (int i = 0; i < actionCount; ++i) {
+    pool.addAction([&pool, &executedCount] () {
+      for (int j = 0; j < nestedActionCount; ++j)
+        pool.addAction([&executedCount] () noexcept { ++executedCount; });
+
+      ++executedCount;
+    });
+  }
+
+  // The calling thread helps executing the pending actions while waiting
+  pool.executeUntil([&executedCount] () { return (executedCount == actionCount * (nestedActionCount + 1)); });
+  CHECK(executedCount == actionCount * (nestedActionCount + 1));
+  CHECK_FALSE(pool.executePendingAction());
+}
+
+TEST_CASE("ThreadPool waiting worker") {
+  // With a single thread, a worker waiting for an action it has added would never see it executed if it was simply blocking
+  Raz::ThreadPool pool(1);
+  std::atomic<bool> isNestedActionExecuted = false;
+  std::atomic<bool> isActionExecuted = false;
+
+  pool.addAction([&] () {
+    pool.addAction([&isNestedActionExecuted] () noexcept { isNestedActionExecuted = true; });
+    pool.executeUntil([&isNestedActionExecuted] () { return isNestedActionExecuted.load(); });
+    isActionExecuted = true;
+  });
+
+  pool.executeUntil([&isActionExecuted] () { return isActionExecuted.load(); });
+  CHECK(isNestedActionExecuted);
+  CHECK(isActionExecuted);
+}
+
 #endif // RAZ_THREADS_AVAILABLE
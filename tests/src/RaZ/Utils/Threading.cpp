@@ -2,8 +2,12 @@
 
 #include "RaZ/Utils/Threading.hpp"
 
+#include <algorithm>
+#include <memory>
 #include <numeric>
 #include <random>
+#include <stdexcept>
+#include <string>
 
 #ifdef RAZ_THREADS_AVAILABLE
 
@@ -45,6 +49,25 @@ TEST_CASE("Threading async basic") {
   res.wait();
 
   CHECK(res.get() == 42);
+
+  // The arguments are moved into the action, which is executed by the default thread pool
+  std::thread::id threadId {};
+  auto value = std::make_unique<int>(21);
+  std::future<int> product = Raz::Threading::launchAsync([&threadId] (std::unique_ptr<int> val, int factor) noexcept {
+    threadId = std::this_thread::get_id();
+    return *val * factor;
+  }, std::move(value), 2);
+
+  CHECK(product.get() == 42);
+  CHECK(threadId != std::this_thread::get_id());
+
+  // I/O operations are executed on a dedicated pool
+  CHECK(Raz::Threading::getIoThreadPool().getThreadCount() >= 1);
+  CHECK(&Raz::Threading::getIoThreadPool() != &Raz::Threading::getDefaultThreadPool());
+
+  std::future<void> ioResult = Raz::Threading::launchIoAsync([&threadId] () noexcept { threadId = std::this_thread::get_id(); });
+  ioResult.get();
+  CHECK(threadId != std::this_thread::get_id());
 }
 
 TEST_CASE("Threading simple parallelization") {
@@ -111,4 +134,167 @@ TEST_CASE("Threading iterator parallelization - indivisible size") {
   CHECK(sumBeforeIncrement + values.size() == sumAfterIncrement);
 }
 
+TEST_CASE("Threading parallelization splitting") {
+  // Each index must be given to exactly one thread, including when the range doesn't start at 0 & can't be evenly divided
+  std::vector<std::atomic<int>> indexCounts(13);
+
+  Raz::Threading::parallelize(3, 13, [&indexCounts] (const Raz::Threading::IndexRange& range) noexcept {
+    for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+      ++indexCounts[i];
+  }, 3);
+
+  for (std::size_t i = 0; i < indexCounts.size(); ++i)
+    CHECK(indexCounts[i] == (i < 3 ? 0 : 1));
+
+  std::vector<int> values(10);
+  Raz::Threading::parallelize(values, [] (const auto& range) noexcept {
+    for (int& value : range)
+      ++value;
+  }, 3);
+
+  CHECK(std::all_of(values.cbegin(), values.cend(), [] (int value) { return (value == 1); }));
+
+  CHECK(Raz::Threading::Details::computeSplitRange(10, 3, 0).beginIndex == 0);
+  CHECK(Raz::Threading::Details::computeSplitRange(10, 3, 0).endIndex == 4);
+  CHECK(Raz::Threading::Details::computeSplitRange(10, 3, 1).endIndex == 7);
+  CHECK(Raz::Threading::Details::computeSplitRange(10, 3, 2).endIndex == 10);
+}
+
+TEST_CASE("Threading parallelization exceptions") {
+  // An exception thrown by any action is rethrown on the calling thread once all of them are finished, the others being still executed
+  std::atomic<int> executedCount = 0;
+
+  CHECK_THROWS_AS(Raz::Threading::parallelize([&executedCount] () {
+    if (executedCount++ == 0)
+      throw std::runtime_error("Error: Action failure");
+  }, 4), std::runtime_error);
+  CHECK(executedCount == 4);
+
+  executedCount = 0;
+
+  CHECK_THROWS_AS(Raz::Threading::parallelize({
+    [&executedCount] () noexcept { ++executedCount; },
+    [] () { throw std::runtime_error("Error: Action failure"); },
+    [&executedCount] () noexcept { ++executedCount; }
+  }), std::runtime_error);
+  CHECK(executedCount == 2);
+
+  CHECK_THROWS_AS(Raz::Threading::parallelize(0, 10, [] (const Raz::Threading::IndexRange& range) {
+    if (range.beginIndex == 0)
+      throw std::runtime_error("Error: Action failure");
+  }, 3), std::runtime_error);
+
+  std::vector<int> values(10);
+  CHECK_THROWS_AS(Raz::Threading::parallelize(values, [] (const auto&) { throw std::runtime_error("Error: Action failure"); }, 3), std::runtime_error);
+
+  // The threads remain usable afterward
+  executedCount = 0;
+  Raz::Threading::parallelize([&executedCount] () noexcept { ++executedCount; }, 4);
+  CHECK(executedCount == 4);
+}
+
+TEST_CASE("Threading parallel for") {
+  std::vector<int> values(2083);
+  fillRandom(values);
+
+  const std::size_t sumBeforeIncrement = computeSum(values);
+
+  // With an index range, chunks of the given grain size
+  std::atomic<std::size_t> maxChunkSize = 0;
+
+  Raz::Threading::parallelFor(0, values.size(), [&values, &maxChunkSize] (const Raz::Threading::IndexRange& range) noexcept {
+    std::size_t chunkSize = maxChunkSize;
+    while (chunkSize < range.endIndex - range.beginIndex && !maxChunkSize.compare_exchange_weak(chunkSize, range.endIndex - range.beginIndex));
+
+    for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+      ++values[i];
+  }, 100);
+
+  CHECK(maxChunkSize == 100);
+
+  // With a collection, chunks of an automatically chosen size
+  Raz::Threading::parallelFor(values, [] (const auto& range) noexcept {
+    for (int& value : range)
+      ++value;
+  });
+
+  CHECK(computeSum(values) == sumBeforeIncrement + values.size() * 2);
+
+  // Empty ranges do nothing
+  bool isCalled = false;
+  Raz::Threading::parallelFor(10, 10, [&isCalled] (const Raz::Threading::IndexRange&) noexcept { isCalled = true; });
+  Raz::Threading::parallelFor(std::vector<int>(), [&isCalled] (const auto&) noexcept { isCalled = true; });
+  CHECK_FALSE(isCalled);
+
+  // An exception thrown by any chunk is rethrown on the calling thread
+  CHECK_THROWS_AS(Raz::Threading::parallelFor(0, 1000, [] (const Raz::Threading::IndexRange& range) {
+    if (range.beginIndex >= 500)
+      throw std::runtime_error("Error: Chunk failure");
+  }, 10), std::runtime_error);
+}
+
+TEST_CASE("Threading parallel reduce") {
+  std::vector<int> values(100'003);
+  fillRandom(values);
+
+  const std::size_t sum = Raz::Threading::parallelReduce(0, values.size(), static_cast<std::size_t>(0), [&values] (const Raz::Threading::IndexRange& range) {
+    return std::accumulate(values.cbegin() + static_cast<std::ptrdiff_t>(range.beginIndex),
+                           values.cbegin() + static_cast<std::ptrdiff_t>(range.endIndex),
+                           static_cast<std::size_t>(0));
+  }, std::plus<>(), 1000);
+  CHECK(sum == computeSum(values));
+
+  CHECK(Raz::Threading::parallelReduce(5, 5, 42, [] (const Raz::Threading::IndexRange&) { return 0; }, std::plus<>()) == 42);
+
+  // The chunks are reduced in order, thus giving the right result even with a non-commutative operation
+  const std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+  const std::string reducedAlphabet = Raz::Threading::parallelReduce(0, alphabet.size(), std::string(), [&alphabet] (const Raz::Threading::IndexRange& range) {
+    return alphabet.substr(range.beginIndex, range.endIndex - range.beginIndex);
+  }, std::plus<>(), 3);
+  CHECK(reducedAlphabet == alphabet);
+}
+
+TEST_CASE("Threading parallel scan") {
+  for (const std::size_t valueCount : { 1, 7, 1000, 65'537 }) {
+    std::vector<int> values(valueCount);
+    fillRandom(values);
+
+    std::vector<int> expectedValues(valueCount);
+    std::partial_sum(values.cbegin(), values.cend(), expectedValues.begin());
+
+    std::vector<int> scannedValues(valueCount);
+    Raz::Threading::parallelScan(values.cbegin(), values.cend(), scannedValues.begin());
+    CHECK(scannedValues == expectedValues);
+
+    // Scanning in place, with a small grain size
+    Raz::Threading::parallelScan(values.begin(), values.end(), values.begin(), std::plus<>(), 3);
+    CHECK(values == expectedValues);
+  }
+
+  std::vector<int> values = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+  Raz::Threading::parallelScan(values.begin(), values.end(), values.begin(), [] (int first, int second) { return std::max(first, second); }, 2);
+  CHECK(values == std::vector<int>({ 3, 3, 4, 4, 5, 9, 9, 9, 9, 9, 9 }));
+}
+
+TEST_CASE("Threading parallel sort") {
+  std::vector<int> emptyValues;
+  CHECK_NOTHROW(Raz::Threading::parallelSort(emptyValues.begin(), emptyValues.end()));
+
+  for (const std::size_t valueCount : { 1, 7, 1000, 100'003 }) {
+    std::vector<int> values(valueCount);
+    fillRandom(values);
+
+    std::vector<int> expectedValues = values;
+    std::sort(expectedValues.begin(), expectedValues.end());
+
+    std::vector<int> sortedValues = values;
+    Raz::Threading::parallelSort(sortedValues.begin(), sortedValues.end());
+    CHECK(sortedValues == expectedValues);
+
+    // With a small grain size, many chunks have to be merged
+    Raz::Threading::parallelSort(values.begin(), values.end(), std::greater<>(), 10);
+    CHECK(std::equal(values.cbegin(), values.cend(), expectedValues.crbegin()));
+  }
+}
+
 #endif // RAZ_THREADS_AVAILABLE
@@ -0,0 +1,114 @@
+#include "Catch.hpp"
+
+#include "RaZ/View.hpp"
+#include "RaZ/World.hpp"
+
+#include <atomic>
+
+namespace {
+
+struct Position : public Raz::Component {
+  explicit Position(int val = 0) : value{ val } {}
+
+  int value;
+};
+
+struct Velocity : public Raz::Component {
+  explicit Velocity(int val = 0) : value{ val } {}
+
+  int value;
+};
+
+} // namespace
+
+TEST_CASE("View basic") {
+  Raz::World world(3);
+
+  Raz::Entity& entity0 = world.addEntity();
+  entity0.addComponents<Position, Velocity>();
+  Raz::Entity& entity1 = world.addEntityWithComponent<Position>();
+  Raz::Entity& entity2 = world.addEntity();
+
+  // A view is populated with the already existing entities on creation
+  Raz::View<Position, Velocity>& view = world.view<Position, Velocity>();
+  CHECK(view.getSize() == 1);
+  CHECK(view.containsEntity(entity0));
+  CHECK_FALSE(view.containsEntity(entity1));
+  CHECK_FALSE(view.containsEntity(entity2));
+
+  // Fetching the same view again returns the existing one
+  CHECK(&world.view<Position, Velocity>() == &view);
+  CHECK(world.view<Position>().getSize() == 2);
+
+  // The view is updated as soon as components are added or removed
+  entity1.addComponent<Velocity>();
+  CHECK(view.getSize() == 2);
+  CHECK(view.containsEntity(entity1));
+
+  entity0.removeComponent<Position>();
+  CHECK(view.getSize() == 1);
+  CHECK_FALSE(view.containsEntity(entity0));
+
+  // Disabled entities are not part of the view
+  entity1.disable();
+  CHECK(view.isEmpty());
+
+  entity1.enable();
+  CHECK(view.containsEntity(entity1));
+
+  // Removing an entity removes it from the view
+  entity2.addComponents<Position, Velocity>();
+  CHECK(view.getSize() == 2);
+
+  world.removeEntity(entity2);
+  CHECK(view.getSize() == 1);
+  CHECK(view.containsEntity(entity1));
+}
+
+TEST_CASE("View iteration") {
+  Raz::World world(10);
+
+  for (int i = 0; i < 10; ++i) {
+    Raz::Entity& entity = world.addEntityWithComponent<Position>(i);
+
+    if (i % 2 == 0)
+      entity.addComponent<Velocity>(i);
+  }
+
+  Raz::View<Position, Velocity>& view = world.view<Position, Velocity>();
+  REQUIRE(view.getSize() == 5);
+
+  // Iterating yields references to the components
+  for (auto [position, velocity] : view)
+    position.value += velocity.value;
+
+  view.forEach([] (const Raz::Entity& entity, const Position& position, const Velocity& velocity) {
+    CHECK(position.value == velocity.value * 2);
+    CHECK(entity.getComponent<Position>().value == position.value);
+  });
+
+  // Replacing a component updates the reference held by the view
+  view.begin().getEntity().addComponent<Velocity>(100);
+  CHECK(std::get<Velocity&>(*view.begin()).value == 100);
+}
+
+TEST_CASE("View parallel iteration") {
+  Raz::World world(1000);
+
+  for (int i = 0; i < 1000; ++i)
+    world.addEntityWithComponent<Position>(i);
+
+  Raz::View<Position>& view = world.view<Position>();
+
+  std::atomic<int> positionSum = 0;
+  view.parallelForEach([&positionSum] (Position& position) {
+    positionSum += position.value;
+    position.value *= 2;
+  }, 16);
+
+  CHECK(positionSum == 499500);
+
+  int doubledPositionSum = 0;
+  view.forEach([&doubledPositionSum] (const Position& position) { doubledPositionSum += position.value; });
+  CHECK(doubledPositionSum == 999000);
+}
@@ -1,6 +1,122 @@
 #include "Catch.hpp"
 
 #include "RaZ/World.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+struct AcceptedComp : public Raz::Component {};
+struct IgnoredComp : public Raz::Component {};
+struct CounterComp : public Raz::Component { int value = 0; };
+
+class CountingSystem final : public Raz::System {
+public:
+  CountingSystem() { registerComponents<AcceptedComp>(); }
+
+  const std::vector<Raz::Entity*>& getEntities() const { return m_entities; }
+
+  void linkEntity(Raz::Entity& entity) override { System::linkEntity(entity); ++linkCount; }
+  void unlinkEntity(Raz::Entity& entity) override { System::unlinkEntity(entity); ++unlinkCount; }
+
+  std::size_t linkCount = 0;
+  std::size_t unlinkCount = 0;
+};
+
+class ScheduledSystem : public Raz::System {
+public:
+  explicit ScheduledSystem(bool writesComponent, bool requiresMainThread = false) {
+    if (writesComponent)
+      registerWrittenComponents<AcceptedComp>();
+    else
+      registerReadComponents<AcceptedComp>();
+
+    if (requiresMainThread)
+      requireMainThread();
+  }
+
+  bool update(float /* deltaTime */) override {
+    const int runningCount = ++s_runningCount;
+    int maxRunningCount    = s_maxRunningCount;
+    while (runningCount > maxRunningCount && !s_maxRunningCount.compare_exchange_weak(maxRunningCount, runningCount)) {}
+
+    // Waiting a bit to give other systems the opportunity to be updated at the same time
+    Raz::Threading::sleep(20);
+
+    threadId    = std::this_thread::get_id();
+    updateOrder = s_updateCounter++;
+
+    --s_runningCount;
+    return (++updateCount < 2);
+  }
+
+  std::thread::id threadId {};
+  int updateOrder = -1;
+  int updateCount = 0;
+
+  static inline std::atomic<int> s_updateCounter = 0;
+  static inline std::atomic<int> s_runningCount = 0; ///< Number of systems being updated at the same time.
+  static inline std::atomic<int> s_maxRunningCount = 0;
+};
+
+class SteppingSystem : public Raz::System {
+public:
+  bool step(float deltaTime) override {
+    ++stepCount;
+    lastStepTime = deltaTime;
+    return true;
+  }
+
+  std::size_t stepCount = 0;
+  float lastStepTime = 0.f;
+};
+
+class CustomSteppingSystem final : public SteppingSystem {};
+
+class SimulatedSystem final : public Raz::System {
+public:
+  SimulatedSystem() { registerComponents<CounterComp>(); }
+
+  bool update(float /* deltaTime */) override {
+    if (throwOnUpdate)
+      throw std::runtime_error("Error: Simulation failure");
+
+    for (Raz::Entity* entity : m_entities)
+      ++entity->getComponent<CounterComp>().value;
+
+    return (++updateCount < 3);
+  }
+
+  void captureFrame() override { ++captureCount; }
+
+  int updateCount = 0;
+  int captureCount = 0;
+  bool throwOnUpdate = false;
+};
+
+class CapturingSystem final : public Raz::System {
+public:
+  CapturingSystem() { registerComponents<CounterComp>(); requireMainThread(); }
+
+  bool update(float /* deltaTime */) override {
+    renderedValues.emplace_back(capturedValue);
+    return true;
+  }
+
+  void captureFrame() override { capturedValue = m_entities.front()->getComponent<CounterComp>().value; }
+
+  int capturedValue = -1;
+  std::vector<int> renderedValues;
+};
+
+struct WriterSystem final : public ScheduledSystem { WriterSystem() : ScheduledSystem(true) {} };
+struct ReaderSystem1 final : public ScheduledSystem { ReaderSystem1() : ScheduledSystem(false) {} };
+struct ReaderSystem2 final : public ScheduledSystem { ReaderSystem2() : ScheduledSystem(false, true) {} };
+
+} // namespace
 
 TEST_CASE("World entities manipulation") {
   Raz::World world(3);
@@ -18,22 +134,37 @@ TEST_CASE("World entities manipulation") {
 
   CHECK(world.getEntities().size() == 3);
 
+  const Raz::EntityHandle entity0Handle = entity0.getHandle();
+  const Raz::EntityHandle entity2Handle = entity2.getHandle();
+  CHECK(world.recoverEntity(entity0Handle) == &entity0);
+
   world.removeEntity(entity0);
 
+  // The last entity is moved in place of the removed one
   CHECK(world.getEntities().size() == 2);
-  CHECK(world.getEntities()[0]->getId() == 1);
-  CHECK(world.getEntities()[1]->getId() == 2);
+  CHECK(world.getEntities()[0]->getId() == 2);
+  CHECK(world.getEntities()[1]->getId() == 1);
 
-  world.removeEntity(entity2);
+  // The handle of a removed entity is stale
+  CHECK_FALSE(world.hasEntity(entity0Handle));
+  CHECK(world.recoverEntity(entity0Handle) == nullptr);
+  CHECK_THROWS(world.removeEntity(entity0Handle));
+
+  world.removeEntity(entity2Handle);
 
   CHECK(world.getEntities().size() == 1);
   CHECK(world.getEntities()[0]->getId() == 1);
 
-  [[maybe_unused]] Raz::Entity& entity4 = world.addEntity();
+  const Raz::Entity& entity4 = world.addEntity();
 
+  // The indices of removed entities are reused, the generation telling them apart
   CHECK(world.getEntities().size() == 2);
   CHECK(world.getEntities()[0]->getId() == 1);
-  CHECK(world.getEntities()[1]->getId() == 3); // The entity indices are always growing
+  CHECK(world.getEntities()[1]->getId() == 2);
+  CHECK(entity4.getGeneration() == 1);
+  CHECK(entity4.getHandle() != entity2Handle);
+  CHECK_FALSE(world.hasEntity(entity2Handle));
+  CHECK(world.recoverEntity(entity4.getHandle()) == &entity4);
 
   // The entity removal is made by checking the pointers; if it isn't owned by this world, it throws an exception
   Raz::Entity extEntity(0);
@@ -77,6 +208,39 @@ TEST_CASE("World get entities with components") {
   CHECK(world.recoverEntitiesWithComponents<TestComp1>().front() == &entity1); // Still has the first component
 }
 
+TEST_CASE("World component storage") {
+  struct TestComp : public Raz::Component {
+    explicit TestComp(int val) : value{ val } {}
+    int value {};
+  };
+
+  Raz::World world;
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<TestComp>(0);
+  const TestComp& comp0 = entity0.getComponent<TestComp>();
+  CHECK(world.getComponentStorage().getComponentCount<TestComp>() == 1);
+
+  // Adding many other components of the same type does not move the existing ones
+  for (int i = 1; i < 1000; ++i)
+    world.addEntityWithComponent<TestComp>(i);
+
+  CHECK(world.getComponentStorage().getComponentCount<TestComp>() == 1000);
+  CHECK(&entity0.getComponent<TestComp>() == &comp0);
+  CHECK(comp0.value == 0);
+
+  // Replacing a component destroys the previous one
+  entity0.addComponent<TestComp>(entity0.getComponent<TestComp>().value + 1);
+  CHECK(entity0.getComponent<TestComp>().value == 1);
+  CHECK(world.getComponentStorage().getComponentCount<TestComp>() == 1000);
+
+  entity0.removeComponent<TestComp>();
+  CHECK(world.getComponentStorage().getComponentCount<TestComp>() == 999);
+
+  // Removing an entity releases its components
+  world.removeEntity(*world.getEntities().back());
+  CHECK(world.getComponentStorage().getComponentCount<TestComp>() == 998);
+}
+
 TEST_CASE("World refresh") {
   Raz::World world(3);
 
@@ -132,4 +296,206 @@ TEST_CASE("World refresh") {
   CHECK(world.getEntities()[0]->getId() == 2);
   CHECK(world.getEntities()[1]->getId() == 1);
   CHECK(world.getEntities()[2]->getId() == 0);
+
+  // Removing an entity keeps the enabled ones packed together, and adding an enabled entity places it before the disabled ones
+  // The new entity reuses the index of the removed one
+
+  world.removeEntity(entity2);
+  const Raz::Entity& entity3 = world.addEntity(true);
+
+  // [ 2; 1; 0d ] -> [ 1; 0d ] -> [ 1; 2; 0d ]
+
+  CHECK(entity3.getId() == 2);
+  CHECK(world.getEntities()[0]->getId() == 1);
+  CHECK(world.getEntities()[1]->getId() == 2);
+  CHECK(world.getEntities()[2]->getId() == 0);
+}
+
+TEST_CASE("World incremental refresh") {
+  Raz::World world(3);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<AcceptedComp>();
+  Raz::Entity& entity1 = world.addEntity();
+
+  // A system added after the entities still gets them linked on the next refresh
+  const auto& system = world.addSystem<CountingSystem>();
+  world.refresh();
+
+  CHECK(system.linkCount == 1);
+  CHECK(system.containsEntity(entity0));
+  CHECK_FALSE(system.containsEntity(entity1));
+
+  // Nothing changed since the last refresh, no entity must be checked again
+  world.refresh();
+  CHECK(system.linkCount == 1);
+  CHECK(system.unlinkCount == 0);
+
+  // Adding a component the system doesn't accept doesn't link the entity
+  entity1.addComponent<IgnoredComp>();
+  world.refresh();
+  CHECK(system.linkCount == 1);
+  CHECK_FALSE(system.containsEntity(entity1));
+
+  entity1.addComponent<AcceptedComp>();
+  world.refresh();
+  CHECK(system.linkCount == 2);
+  CHECK(system.containsEntity(entity1));
+
+  entity0.removeComponent<AcceptedComp>();
+  world.refresh();
+  CHECK(system.unlinkCount == 1);
+  CHECK_FALSE(system.containsEntity(entity0));
+  REQUIRE(system.getEntities().size() == 1);
+  CHECK(system.getEntities().front() == &entity1);
+
+  // A disabled entity is left untouched until it gets enabled again
+  entity0.disable();
+  entity0.addComponent<AcceptedComp>();
+  world.refresh();
+  CHECK_FALSE(system.containsEntity(entity0));
+
+  entity0.enable();
+  world.refresh();
+  CHECK(system.containsEntity(entity0));
+
+  // Removing a modified entity before refreshing must not leave it pending
+  Raz::Entity& entity2 = world.addEntityWithComponent<AcceptedComp>();
+  world.removeEntity(entity2);
+  world.refresh();
+  CHECK(system.linkCount == 3);
+  CHECK(system.getEntities().size() == 2);
+
+  // Moving the world keeps the entities bound to it
+  Raz::World movedWorld(std::move(world));
+  entity1.removeComponent<AcceptedComp>();
+  movedWorld.refresh();
+  CHECK_FALSE(movedWorld.getSystem<CountingSystem>().containsEntity(entity1));
+  CHECK(movedWorld.getSystem<CountingSystem>().containsEntity(entity0));
+}
+
+TEST_CASE("World parallel update") {
+  Raz::World world;
+  world.enableParallelUpdate();
+  CHECK(world.isParallelUpdateEnabled());
+
+  const auto& writer  = world.addSystem<WriterSystem>();
+  const auto& reader1 = world.addSystem<ReaderSystem1>();
+  const auto& reader2 = world.addSystem<ReaderSystem2>();
+
+  CHECK(world.update(0.f));
+
+  // The writer conflicts with both readers and must have been updated first, alone; the readers can be updated together
+  CHECK(writer.updateOrder == 0);
+  CHECK(reader1.updateOrder > 0);
+  CHECK(reader2.updateOrder > 0);
+  // Whether the readers are actually updated at the same time depends on the threads' availability, the calling one possibly updating both
+  CHECK(ScheduledSystem::s_maxRunningCount <= 2);
+
+  // A system requiring the main thread is always updated on the calling one
+  CHECK(reader2.threadId == std::this_thread::get_id());
+
+  // Each system becomes inactive after two updates
+  CHECK_FALSE(world.update(0.f));
+  CHECK(writer.updateCount == 2);
+  CHECK(reader1.updateCount == 2);
+  CHECK(reader2.updateCount == 2);
+}
+
+TEST_CASE("World frame pipelining") {
+  Raz::World world;
+  world.enableFramePipelining();
+  CHECK(world.isFramePipeliningEnabled());
+
+#if defined(RAZ_THREADS_AVAILABLE) && !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  auto& simulated = world.addSystem<SimulatedSystem>();
+  auto& capturing = world.addSystem<CapturingSystem>();
+
+  const Raz::Entity& entity = world.addEntityWithComponent<CounterComp>();
+
+  // Each frame, the main thread system works from the state captured at the end of the previous frame's simulation
+  CHECK(world.update(0.f));
+  CHECK(world.update(0.f));
+  world.waitForSimulation();
+
+  CHECK(entity.getComponent<CounterComp>().value == 2);
+  CHECK(capturing.renderedValues == std::vector<int>({ 0, 1 }));
+
+  // Only the systems requiring the main thread capture the frame
+  CHECK(simulated.captureCount == 0);
+
+  // A simulated system becoming inactive is only known once its simulation is finished
+  CHECK(world.update(0.f));
+  CHECK(world.update(0.f));
+  world.waitForSimulation();
+  CHECK(simulated.updateCount == 3);
+  CHECK(entity.getComponent<CounterComp>().value == 3);
+  CHECK(capturing.renderedValues == std::vector<int>({ 0, 1, 2, 3 }));
+
+  // Moving the world while it is being simulated is safe, the simulation being tied to the systems
+  Raz::World throwingWorld;
+  throwingWorld.enableFramePipelining();
+  throwingWorld.addSystem<SimulatedSystem>().throwOnUpdate = true;
+  throwingWorld.update(0.f);
+
+  Raz::World movedWorld(std::move(throwingWorld));
+
+  // An exception thrown during the simulation is rethrown when waiting for it
+  CHECK_THROWS(movedWorld.waitForSimulation());
+  CHECK_NOTHROW(movedWorld.waitForSimulation());
+#endif
+}
+
+TEST_CASE("World fixed step update") {
+  Raz::World world;
+
+  auto& defaultSystem = world.addSystem<SteppingSystem>();
+
+  // Without any given time information, the world computes the default steps itself, without any maximum
+  world.update(0.1f);
+  CHECK(defaultSystem.stepCount == 6);
+  CHECK(defaultSystem.lastStepTime == 0.016666f);
+  CHECK_THAT(defaultSystem.getInterpolationAlpha(), IsNearlyEqualTo(0.00024f, 0.00001f));
+
+  Raz::FrameTimeInfo timeInfo;
+  timeInfo.deltaTime          = 0.5f;
+  timeInfo.substepTime        = 0.1f;
+  timeInfo.substepCount       = 2;
+  timeInfo.maxSubstepCount    = 3;
+  timeInfo.interpolationAlpha = 0.25f;
+
+  // The systems using the default step time execute as many steps as given, regardless of the delta time
+  defaultSystem.stepCount = 0;
+  world.update(timeInfo);
+  CHECK(defaultSystem.stepCount == 2);
+  CHECK(defaultSystem.lastStepTime == 0.1f);
+  CHECK(defaultSystem.getInterpolationAlpha() == 0.25f);
+
+  CHECK_THROWS(defaultSystem.setStepRate(-1.f));
+
+  auto& customSystem = world.addSystem<CustomSteppingSystem>();
+  customSystem.setStepRate(10.f);
+  CHECK(customSystem.getStepTime() == 0.1f);
+
+  // A system with its own step rate executes steps from its own remaining time, while the one using the default step time still executes
+  //  the given ones in the same update
+  timeInfo.deltaTime = 0.25f;
+  world.update(timeInfo);
+  CHECK(defaultSystem.stepCount == 4);
+  CHECK(defaultSystem.lastStepTime == 0.1f);
+  CHECK(defaultSystem.getInterpolationAlpha() == 0.25f);
+  CHECK(customSystem.stepCount == 2);
+  CHECK(customSystem.lastStepTime == 0.1f);
+  CHECK_THAT(customSystem.getInterpolationAlpha(), IsNearlyEqualTo(0.5f));
+
+  // Past the maximum number of steps, the remaining whole steps are dropped instead of being executed on the next frames
+  timeInfo.deltaTime = 1.f;
+  world.update(timeInfo);
+  CHECK(defaultSystem.stepCount == 6);
+  CHECK(customSystem.stepCount == 5);
+  CHECK(customSystem.getInterpolationAlpha() < 1.f);
+
+  timeInfo.deltaTime = 0.f;
+  world.update(timeInfo);
+  CHECK(defaultSystem.stepCount == 8);
+  CHECK(customSystem.stepCount == 5);
 }